@@ -36,6 +36,42 @@
 #define ILI9488_SPI_TIMEOUT_MS			( 10 )	// [ms]
 #define ILI9488_SPI_EN_CLK()			__HAL_RCC_SPI1_CLK_ENABLE()
 
+// GRAM line buffer size in pixels
+// NOTE: Each pixel takes 3 bytes (RGB666) of RAM. Color fills are
+// pre-expanded into this buffer and pushed over SPI in bursts of
+// that size, therefore bigger buffer means less SPI transactions.
+// One display column (320 pixels) is a good compromise.
+// Size: 960 B
+#define ILI9488_GRAM_BUF_SIZE_PX		( 320 )
+
+// Enable DMA transfers of GRAM data (0/1)
+// NOTE: When enabled GRAM writes are not blocking. Two line
+// buffers are used as ping-pong pair, therefore RAM usage
+// of GRAM buffer is doubled. User must call ili9488_dma_hndl()
+// from ILI9488_SPI_DMA_IRQ interrupt routine!
+#define ILI9488_SPI_DMA_EN				( 0 )
+#define ILI9488_SPI_DMA_STREAM			( DMA2_Stream3 )
+#define ILI9488_SPI_DMA_CHANNEL			( DMA_CHANNEL_3 )
+#define ILI9488_SPI_DMA_IRQ				( DMA2_Stream3_IRQn )
+#define ILI9488_SPI_DMA_IRQ_PRIO		( 5 )
+#define ILI9488_SPI_DMA_EN_CLK()		__HAL_RCC_DMA2_CLK_ENABLE()
+
+
+// **********************************************************
+// 	TRANSPORT
+// **********************************************************
+
+// Use STM32 HAL transport (0/1)
+// NOTE: When disabled transport must be provided by user
+// with ili9488_set_transport() before ili9488_init(). This
+// way display stack can run off-target, e.g. on host with
+// ILI9488 emulator.
+#define ILI9488_HAL_TRANSPORT_EN		( 1 )
+
+// Enable ILI9488 emulator (0/1)
+// NOTE: Only for host builds! Emulated GRAM takes 450 kB of RAM.
+#define ILI9488_EMU_EN					( 0 )
+
 
 // **********************************************************
 // 	GPIO PINS
@@ -88,6 +124,25 @@
 // Flip display landscape orientation (0/1)
 #define ILI9488_DISPLAY_FLIP			( 0 )
 
+// Portrait orientation (0/1)
+// NOTE: Display then has 320 pages and 480 columns. Panel
+// scrolls only along its 480 px side, therefore terminal
+// mode of printf requires portrait orientation.
+#define ILI9488_DISPLAY_PORTRAIT		( 0 )
+
+
+// **********************************************************
+// 	PIXEL FORMAT
+// **********************************************************
+
+// Use 3-bit (8 colors) pixel format (0/1)
+// NOTE: Two pixels are packed in one byte, therefore GRAM
+// transfers are 6 times shorter than with 18-bit format.
+// Only black, blue, green, turquoise, red, purple, yellow and
+// white are covered. Other colors (grays) are written in
+// 18-bit format, display is switched between formats on the fly.
+#define ILI9488_PIXEL_FORMAT_3_BIT_EN	( 0 )
+
 
 // **********************************************************
 // 	DISPLAY FONTS
@@ -116,6 +171,143 @@
 // Size: 6,68 kB
 #define ILI9488_FONT_24_USE_EN			( 1 )
 
+// Number of compiled fonts (0 - 2)
+// NOTE: Fonts are compiled from TTF or BDF with
+// tools/ili9488_fontconv.c, generated sources must be added
+// to build. Fonts are selected with eILI9488_FONT_USER_0 and
+// eILI9488_FONT_USER_1, below are names given to compiler.
+#define ILI9488_FONT_USER_NUM			( 0 )
+#define ILI9488_FONT_USER_0				g_font_user_0
+#define ILI9488_FONT_USER_1				g_font_user_1
+
+
+// **********************************************************
+// 	POLYGON FILL
+// **********************************************************
+
+// Maximum number of polygon points
+// NOTE: Each takes 8 B of stack while filling
+#define ILI9488_POLYGON_POINT_NUM		( 16 )
+
+
+// **********************************************************
+// 	ANTI-ALIASING
+// **********************************************************
+//
+//	Anti-aliased lines, circles and text blend coverage of
+//	every pixel between color and known background color.
+//	Frame renderer blends with strip buffer instead, so there
+//	background does not have to be known.
+
+// Enable anti-aliased drawing (0/1)
+#define ILI9488_AA_EN					( 0 )
+
+// Number of blend steps from background to color
+// NOTE: Blend table takes 3 B of RAM per step
+#define ILI9488_AA_LEVELS				( 16 )
+
+
+// **********************************************************
+// 	GLYPH CACHE
+// **********************************************************
+//
+//	Glyphs already encoded into GRAM data are kept in RAM
+// 	and reused for same character, font and colors. Least
+//	recently used glyph is evicted when cache is full.
+
+// Enable glyph cache (0/1)
+#define ILI9488_GLYPH_CACHE_EN			( 0 )
+
+// Cache size in bytes
+// NOTE: Glyph takes width x height x 3 bytes in 18-bit and
+// half a byte per pixel in 3-bit format, e.g. 252 B for font
+// 12 and 1224 B for font 24 in 18-bit format.
+#define ILI9488_GLYPH_CACHE_SIZE		( 4096 )
+
+// Maximum number of cached glyphs
+// NOTE: Each takes 28 B of RAM
+#define ILI9488_GLYPH_CACHE_ENTRIES		( 32 )
+
+
+// **********************************************************
+// 	FRAME RENDERER
+// **********************************************************
+//
+//	Drawing between ili9488_frame_begin() and ili9488_frame_end()
+//	is recorded instead of written to display. At frame end
+//	areas of objects changed since previous frame are merged,
+//	rasterised strip by strip into RAM and sent to display,
+//	each pixel once.
+
+// Enable frame renderer (0/1)
+#define ILI9488_RENDER_EN				( 0 )
+
+// Strip height in columns
+// NOTE: Strip buffer takes 480 x height x 3 bytes of RAM,
+// e.g. 23 kB for 16 columns.
+#define ILI9488_RENDER_STRIP_SIZE		( 16 )
+
+// Maximum number of draw commands in frame
+// NOTE: Each takes 88 B of RAM, as previous frame is kept
+#define ILI9488_RENDER_CMD_NUM			( 64 )
+
+// Text storage of frame in bytes
+// NOTE: Also holds points of polylines, 4 B each. Takes twice
+// as much RAM, as previous frame is kept.
+#define ILI9488_RENDER_TEXT_SIZE		( 512 )
+
+// Maximum number of invalidated regions in frame
+// NOTE: Each takes 8 B of RAM
+#define ILI9488_RENDER_DIRTY_NUM		( 16 )
+
+// Cost of sending one region in pixels
+// NOTE: Overlapping or adjacent regions are merged when their
+// bounding region costs no more than sending both. Higher
+// value merges more eagerly, 0 merges only when no extra
+// pixels are sent. Covers address window and memory write
+// commands plus DMA setup, roughly 64 pixels.
+#define ILI9488_RENDER_AREA_COST		( 64 )
+
+
+// **********************************************************
+// 	DISPLAY LIST
+// **********************************************************
+//
+//	Items added to display list are kept by driver. Changing
+//	an item invalidates its old and new area, which are
+//	redrawn by frame renderer on ili9488_list_refresh().
+//
+//	NOTE: Requires ILI9488_RENDER_EN, with at least as many
+//	commands as there are items.
+
+// Enable display list (0/1)
+#define ILI9488_LIST_EN					( 0 )
+
+// Maximum number of items
+// NOTE: Up to 255
+#define ILI9488_LIST_ITEM_NUM			( 32 )
+
+// Maximum length of text item, including terminator
+#define ILI9488_LIST_TEXT_SIZE			( 24 )
+
+
+// **********************************************************
+// 	COMPRESSED IMAGES
+// **********************************************************
+//
+//	RLE and LZ bitmaps are decoded straight into GRAM write,
+//	image is never held in RAM. Use tools/ili9488_imgconv.c
+//	to compress images.
+
+// Enable compressed images (0/1)
+#define ILI9488_IMAGE_EN				( 0 )
+
+// LZ window in pixels
+// NOTE: Takes 3 B of RAM per pixel. Must be at least the
+// window used when compressing, copying from previous
+// column needs image height, e.g. 320 in landscape.
+#define ILI9488_IMAGE_LZ_WINDOW			( 512 )
+
 
 // **********************************************************
 // 	DISPLAY BRIGHTNESS CONTROL
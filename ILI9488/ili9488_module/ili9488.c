@@ -14,6 +14,9 @@
 #include "ili9488_module/ili9488_driver.h"
 #include "ili9488_config.h"
 #include "ili9488_font.h"
+#include "ili9488_glyph_cache.h"
+#include "ili9488_render.h"
+#include "ili9488_region.h"
 
 // Strings
 #include <stdio.h>
@@ -39,6 +42,15 @@ typedef struct
 	uint16_t col;
 } ili9488_cursor_t;
 
+// Scrolling terminal
+typedef struct
+{
+	uint16_t	size;		// Size of scrolling area in columns
+	uint16_t	offset;		// Frame memory column shown at column 0
+	uint8_t		line;		// Height of line in columns
+	bool		enable;
+} ili9488_terminal_t;
+
 
 //////////////////////////////////////////////////////////////
 //	VARIABLES
@@ -50,6 +62,12 @@ static ili9488_pen_t g_stringPen;
 // Cursor
 static ili9488_cursor_t g_stringCursor;
 
+// Terminal
+static ili9488_terminal_t g_terminal;
+
+// Display orientation
+static ili9488_orientation_t g_orientation;
+
 // Initialization flag
 static bool gb_is_init;
 
@@ -57,9 +75,11 @@ static bool gb_is_init;
 //////////////////////////////////////////////////////////////
 // FUNCTIONS PROTOTYPES
 //////////////////////////////////////////////////////////////
-static ili9488_status_t ili9488_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t p_size, const uint16_t c_size, const ili9488_color_t color, const uint8_t radius);
+static ili9488_status_t ili9488_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t p_size, const uint16_t c_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
 static ili9488_status_t ili9488_fill_rectangle		(const uint16_t page, const uint16_t col, const uint16_t p_size, const uint16_t c_size, const ili9488_color_t color);
 static ili9488_status_t ili9488_fill_circle			(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color);
+static ili9488_status_t ili9488_fill_bordered_circle	(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
+static ili9488_status_t ili9488_terminal_new_line		(uint16_t * const p_col);
 
 
 //////////////////////////////////////////////////////////////
@@ -67,6 +87,38 @@ static ili9488_status_t ili9488_fill_circle			(const uint16_t page, const uint16
 //////////////////////////////////////////////////////////////
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Set display transport
+*
+*	NOTE: Must be called before "ili9488_init". If never
+*	called STM32 HAL transport is used.
+*
+*	param:		p_transport - Pointer to transport interface
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_set_transport(const ili9488_transport_t * const p_transport)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Not jet initialized
+	if ( false == gb_is_init )
+	{
+		status = ili9488_low_if_set_transport( p_transport );
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Transport can not be changed after init!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
 //////////////////////////////////////////////////////////////
 /*
 *			Initialize display
@@ -93,9 +145,12 @@ ili9488_status_t ili9488_init(void)
 			gb_is_init = true;
 		}
 
+		// Orientation set by driver
+		status |= ili9488_driver_get_orientation( &g_orientation );
+
 		// Init string pen
-		g_stringPen.bg_color = eILI9488_COLOR_BLACK;
-		g_stringPen.fg_color = eILI9488_COLOR_WHITE;
+		g_stringPen.bg_color = ILI9488_COLOR_BLACK;
+		g_stringPen.fg_color = ILI9488_COLOR_WHITE;
 		g_stringPen.font_opt = eILI9488_FONT_16;
 
 		// Init string cursor
@@ -122,10 +177,17 @@ ili9488_status_t ili9488_set_background(const ili9488_color_t color)
 	// Check if init
 	if ( true == gb_is_init )
 	{
-		status |= ili9488_driver_fill_rectangle(0, 0, ILI9488_DISPLAY_SIZE_PAGE, ILI9488_DISPLAY_SIZE_COLUMN, color );
+		if ( true == ili9488_render_is_open() )
+		{
+			status |= ili9488_render_rect( 0, 0, ili9488_driver_get_page_size(), ili9488_driver_get_col_size(), color );
+		}
+		else
+		{
+			status |= ili9488_driver_fill_rectangle(0, 0, ili9488_driver_get_page_size(), ili9488_driver_get_col_size(), color );
 
-		// NOTE: This is mandatory only first time background is set. Don't know why...
-		status |= ili9488_driver_fill_rectangle(0, 0, 3, ILI9488_DISPLAY_SIZE_COLUMN, color );
+			// NOTE: This is mandatory only first time background is set. Don't know why...
+			status |= ili9488_driver_fill_rectangle(0, 0, 3, ili9488_driver_get_col_size(), color );
+		}
 	}
 	else
 	{
@@ -187,7 +249,14 @@ ili9488_status_t ili9488_set_string(const char* str, const uint16_t page, const
 
 	if ( true == gb_is_init )
 	{
-		status = ili9488_driver_set_string( str, page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_text( str, strlen( str ), page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+		}
+		else
+		{
+			status = ili9488_driver_set_string( str, page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+		}
 	}
 	else
 	{
@@ -215,10 +284,123 @@ bool ili9488_is_init(void)
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Set display orientation
+*
+*	Orientation is set up by display controller, so drawing
+*	costs the same in all of them. Terminal mode is disabled
+*	and cursor outside new display size is moved to origin.
+*
+*	param:		orientation - Orientation of display
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_set_orientation(const ili9488_orientation_t orientation)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		status |= ili9488_set_terminal( false );
+		status |= ili9488_driver_set_orientation( orientation );
+
+		// Recorded frame no longer matches display
+		ili9488_render_reset();
+
+		if ( eILI9488_OK == status )
+		{
+			g_orientation = orientation;
+		}
+
+		if 	(	( g_stringCursor.page >= ili9488_driver_get_page_size() )
+			||	( g_stringCursor.col >= ili9488_driver_get_col_size() ))
+		{
+			g_stringCursor.page = 0;
+			g_stringCursor.col = 0;
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get display orientation
+*
+*	param:		none
+*	return:		orientation - Orientation of display
+*/
+//////////////////////////////////////////////////////////////
+ili9488_orientation_t ili9488_get_orientation(void)
+{
+	return g_orientation;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get display width
+*
+*	param:		none
+*	return:		Number of pages in current orientation
+*/
+//////////////////////////////////////////////////////////////
+uint16_t ili9488_get_width(void)
+{
+	return ili9488_driver_get_page_size();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get display height
+*
+*	param:		none
+*	return:		Number of columns in current orientation
+*/
+//////////////////////////////////////////////////////////////
+uint16_t ili9488_get_height(void)
+{
+	return ili9488_driver_get_col_size();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Map point between display orientations
+*
+*	param:		from 	- Orientation of input point
+*	param:		to 		- Orientation of output point
+*	param:		page 	- Input page (x) coordinate
+*	param:		col 	- Input column (y) coordinate
+*	param:		p_page 	- Pointer to output page (x) coordinate
+*	param:		p_col 	- Pointer to output column (y) coordinate
+*	return:		status 	- Error if input point is not on display
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_map_point(const ili9488_orientation_t from, const ili9488_orientation_t to, const uint16_t page, const uint16_t col, uint16_t * const p_page, uint16_t * const p_col)
+{
+	return ili9488_driver_map_point( from, to, page, col, p_page, p_col );
+}
+
+
 //////////////////////////////////////////////////////////////
 /*
 *			Set cursor for printf functionality
 *
+*	NOTE: In terminal mode column is rounded down to start
+*	of line and must be inside scrolling area.
+*
 *	param:		page 	- Cursor page (x) coordinate
 *	param:		col 	- Cursor column (y) coordinate
 *	return:		status 	- Status of operation
@@ -232,11 +414,17 @@ ili9488_status_t ili9488_set_cursor(const uint16_t page, const uint16_t col)
 	if ( true == gb_is_init )
 	{
 		// Check limits
-		if 	(	( page < ILI9488_DISPLAY_SIZE_PAGE )
-			&& 	( col < ILI9488_DISPLAY_SIZE_PAGE ))
+		if 	(	( page < ili9488_driver_get_page_size() )
+			&& 	( col < ili9488_driver_get_col_size() )
+			&&	(( false == g_terminal.enable ) || ( col < g_terminal.size )))
 		{
 			g_stringCursor.page = page;
 			g_stringCursor.col = col;
+
+			if ( true == g_terminal.enable )
+			{
+				g_stringCursor.col -= ( col % g_terminal.line );
+			}
 		}
 		else
 		{
@@ -265,6 +453,15 @@ ili9488_status_t ili9488_set_cursor(const uint16_t page, const uint16_t col)
 /*
 *			Print formated string to display
 *
+*	In terminal mode new line at the end of scrolling area
+*	scrolls display up for one line instead of redrawing
+*	it, and text is placed into frame memory column
+*	shifted for scrolling offset.
+*
+*	Inside frame text is recorded as string. Terminal mode
+*	scrolls display directly, so it is not supported inside
+*	frame.
+*
 *	param:		format - Formated string
 *	return:		status 	- Status of operation
 */
@@ -275,53 +472,163 @@ ili9488_status_t ili9488_printf(const char *format, ...)
 	va_list args;
 	static uint8_t str[128];
 	uint8_t ch_num;
-	uint16_t page_walker;
 	uint16_t col_walker;
-	uint8_t font_width;
 	uint8_t font_height;
 	ili9488_font_opt_t font_opt;
 	uint8_t i;
+	uint8_t line_start;
+	uint16_t col;
+	bool is_frame;
 
 	// Check if init
 	if ( true == gb_is_init )
 	{
-		// Taking args from stack
-		va_start(args, format);
-		vsprintf((char*) str, format, args);
-		va_end(args);
+		is_frame = ili9488_render_is_open();
 
-		// Get font
-		font_opt = g_stringPen.font_opt;
+		if (( true == is_frame ) && ( true == g_terminal.enable ))
+		{
+			status = eILI9488_ERROR;
 
-		// Set page/col
-		page_walker = g_stringCursor.page;
-		col_walker = g_stringCursor.col;
+			ILI9488_DBG_PRINT( "Terminal not supported inside frame!" );
+		}
+		else
+		{
+			// Taking args from stack
+			va_start(args, format);
+			vsprintf((char*) str, format, args);
+			va_end(args);
 
-		// Get font width
-		font_width = ili9488_font_get_width( font_opt );
-		font_height = ili9488_font_get_height( font_opt );
+			// Get font
+			font_opt = g_stringPen.font_opt;
 
-		// Get number of chars
-		ch_num = strlen((const char*) &str );
+			// Set col
+			col_walker = g_stringCursor.col;
 
-		// Get line break indexes inside strings
-		for ( i = 0; i < ch_num; i++ )
-		{
-			// Ignore new line
-			if (( '\r' == str[i] ) || ( '\n' == str[i] ))
+			// Get font height
+			font_height = ili9488_font_get_height( font_opt );
+
+			// Get number of chars
+			ch_num = strlen((const char*) &str );
+
+			// Every line is drawn as single strip
+			line_start = 0;
+
+			for ( i = 0; i <= ch_num; i++ )
 			{
-				col_walker += font_height;
-				g_stringCursor.col = col_walker;
-				page_walker = g_stringCursor.page;
+				if (( '\r' == str[i] ) || ( '\n' == str[i] ) || ( '\0' == str[i] ))
+				{
+					// Set chars
+					if ( i > line_start )
+					{
+						col = col_walker;
+
+						if ( true == g_terminal.enable )
+						{
+							col = (( col_walker + g_terminal.offset ) % g_terminal.size );
+						}
+
+						if ( true == is_frame )
+						{
+							status |= ili9488_render_text((const char*) &str[ line_start ], ( i - line_start ), g_stringCursor.page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+						}
+						else
+						{
+							status |= ili9488_driver_set_chars((const char*) &str[ line_start ], ( i - line_start ), g_stringCursor.page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+						}
+					}
+
+					// New line
+					if ( '\0' != str[i] )
+					{
+						if ( true == g_terminal.enable )
+						{
+							status |= ili9488_terminal_new_line( &col_walker );
+						}
+						else
+						{
+							col_walker += font_height;
+						}
+
+						g_stringCursor.col = col_walker;
+					}
+
+					line_start = ( i + 1U );
+				}
 			}
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
 
-			// Set chars
-			else
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Enable/disable terminal mode of printf
+*
+*	Terminal uses hardware vertical scrolling, so that only
+*	new line is written to display on scroll. Lines are
+*	as high as current font, which must not be changed
+*	while terminal is enabled. Scrolling is supported in
+*	portrait orientation only.
+*
+*	NOTE: Frame memory is not cleared on disable, thus set
+*	background afterwards to get rid of shifted content.
+*
+*	param:		enable	- Enable terminal mode
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_set_terminal(const bool enable)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint8_t line;
+	uint16_t size;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( true == enable )
+		{
+			line = ili9488_font_get_height( g_stringPen.font_opt );
+			size = (( ili9488_driver_get_col_size() / line ) * line );
+
+			status |= ili9488_driver_set_scroll_area( size );
+			status |= ili9488_driver_set_scroll_offset( 0U );
+
+			if ( eILI9488_OK == status )
 			{
-				ili9488_driver_set_char( str[ i ], page_walker, col_walker, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
-				page_walker += font_width;
+				g_terminal.size = size;
+				g_terminal.offset = 0U;
+				g_terminal.line = line;
+				g_terminal.enable = true;
+
+				g_stringCursor.page = 0U;
+				g_stringCursor.col = 0U;
 			}
 		}
+		else if ( true == g_terminal.enable )
+		{
+			status |= ili9488_driver_set_scroll_offset( 0U );
+			status |= ili9488_driver_set_mode( eILI9488_MODE_NORMAL );
+
+			g_terminal.enable = false;
+			g_terminal.offset = 0U;
+
+			g_stringCursor.page = 0U;
+			g_stringCursor.col = 0U;
+		}
+		else
+		{
+			// No actions...
+		}
 	}
 	else
 	{
@@ -335,6 +642,40 @@ ili9488_status_t ili9488_printf(const char *format, ...)
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Move terminal cursor to new line
+*
+*	At the end of scrolling area display is scrolled for one
+*	line and line that comes in is cleared.
+*
+*	param:		p_col	- Pointer to cursor column
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_terminal_new_line(uint16_t * const p_col)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	if (( *p_col + ( 2U * g_terminal.line )) <= g_terminal.size )
+	{
+		*p_col += g_terminal.line;
+	}
+	else
+	{
+		// Clear line that comes in
+		status |= ili9488_driver_fill_rectangle( 0U, g_terminal.offset, ili9488_driver_get_page_size(), g_terminal.line, g_stringPen.bg_color );
+
+		g_terminal.offset = (( g_terminal.offset + g_terminal.line ) % g_terminal.size );
+		status |= ili9488_driver_set_scroll_offset( g_terminal.offset );
+
+		*p_col = ( g_terminal.size - g_terminal.line );
+	}
+
+	return status;
+}
+
+
 //////////////////////////////////////////////////////////////
 /*
 *			Draw rectangle
@@ -380,17 +721,14 @@ ili9488_status_t ili9488_draw_rectangle(const ili9488_rect_attr_t * const p_rect
 			// Draw Border
 			if ( true == p_rectanegle_attr -> border.enable )
 			{
-				// Fill border
-				status |= ili9488_fill_round_rectangle( s_page, s_col, page_size, col_size, border_color, radius );
-
-				// Fill without border
-				status |= ili9488_fill_round_rectangle( s_page + border_width, s_col + border_width, page_size - 2U * border_width, col_size - 2U * border_width, fill_color, radius );
+				// Border and interior in single pass, without fill only border
+				status |= ili9488_fill_round_rectangle( s_page, s_col, page_size, col_size, radius, border_width, p_rectanegle_attr -> fill.enable, fill_color, border_color );
 			}
 
 			// Rounded & Filled
 			else if ( true == p_rectanegle_attr -> fill.enable )
 			{
-				status |= ili9488_fill_round_rectangle( s_page, s_col, page_size, col_size, fill_color, radius );
+				status |= ili9488_fill_round_rectangle( s_page, s_col, page_size, col_size, radius, 0U, true, fill_color, fill_color );
 			}
 
 			else
@@ -405,11 +743,8 @@ ili9488_status_t ili9488_draw_rectangle(const ili9488_rect_attr_t * const p_rect
 			// With border
 			if ( true == p_rectanegle_attr -> border.enable )
 			{
-				// Fill border
-				status |= ili9488_fill_rectangle( s_page, s_col, page_size, col_size, border_color );
-
-				// Fill without border
-				status |= ili9488_fill_rectangle( s_page + border_width, s_col + border_width, page_size - ( 2U * border_width ), col_size - ( 2U * border_width ), fill_color );
+				// Border bands and interior in single pass, without fill only border
+				status |= ili9488_fill_round_rectangle( s_page, s_col, page_size, col_size, 0U, border_width, p_rectanegle_attr -> fill.enable, fill_color, border_color );
 			}
 
 			// Filled
@@ -440,31 +775,33 @@ ili9488_status_t ili9488_draw_rectangle(const ili9488_rect_attr_t * const p_rect
 /*
 *			Fill round rectangle
 *
-*	param:		page 	- Page start
-*	param:		col 	- Column start
-*	param:		p_size 	- Page size
-*	param:		c_size 	- Column i+size
-*	param:		color 	- Color of rectange
-*	param:		radius 	- Size of radius
+*	param:		page 			- Page start
+*	param:		col 			- Column start
+*	param:		p_size 			- Page size
+*	param:		c_size 			- Column size
+*	param:		radius 			- Size of radius, 0 for simple rectangle
+*	param:		border_width 	- Width of border, 0 for no border
+*	param:		fill_en 		- Fill inside of border
+*	param:		fill_color 		- Color of rectangle
+*	param:		border_color 	- Color of border
 *	return:		status 	- Status of operation
 */
 //////////////////////////////////////////////////////////////
-static ili9488_status_t ili9488_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t p_size, const uint16_t c_size, const ili9488_color_t color, const uint8_t radius)
+static ili9488_status_t ili9488_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t p_size, const uint16_t c_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
 {
 	ili9488_status_t status = eILI9488_OK;
 
 	// Check if init
 	if ( gb_is_init )
 	{
-		// Combinations with rectanangles and cicles to produce rounded rectangle
-		status |= ili9488_fill_rectangle( page ,	 		col + radius, p_size + 1, 	c_size - 2 * radius, 				color );
-		status |= ili9488_fill_rectangle( page + radius, 	col, p_size - 2 * radius, 	radius, 							color );
-		status |= ili9488_fill_rectangle( page + radius, 	col + c_size - radius, 		p_size - 2 * radius, radius + 1,	color );
-
-		status |= ili9488_fill_circle( page + radius, 			col + radius, 			radius, color );
-		status |= ili9488_fill_circle( page + radius, 			col + c_size - radius, 	radius, color );
-		status |= ili9488_fill_circle( page + p_size - radius, 	col + radius,			radius, color );
-		status |= ili9488_fill_circle( page + p_size  - radius,	col + c_size - radius, 	radius, color );
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_round_rect( page, col, p_size, c_size, radius, border_width, fill_en, fill_color, border_color );
+		}
+		else if ( eILI9488_OK != ili9488_driver_fill_round_rectangle( page, col, p_size, c_size, radius, border_width, fill_en, fill_color, border_color ))
+		{
+			status = eILI9488_ERROR;
+		}
 	}
 	else
 	{
@@ -497,7 +834,11 @@ ili9488_status_t ili9488_fill_rectangle(const uint16_t page, const uint16_t col,
 	// Check if init
 	if ( true == gb_is_init )
 	{
-		if ( eILI9488_OK != ili9488_driver_fill_rectangle(page, col, p_size, c_size, color ))
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_rect( page, col, p_size, c_size, color );
+		}
+		else if ( eILI9488_OK != ili9488_driver_fill_rectangle(page, col, p_size, c_size, color ))
 		{
 			status = eILI9488_ERROR;
 		}
@@ -550,11 +891,8 @@ ili9488_status_t ili9488_draw_circle(const ili9488_circ_attr_t * const p_circle_
 		// Circle with border
 		if ( true == p_circle_attr -> border.enable )
 		{
-			// Fill border
-			status |= ili9488_fill_circle( s_page, s_col, radius, border_color );
-
-			// Fill background
-			status |= ili9488_fill_circle( s_page, s_col, radius - border_width, fill_color );
+			// Border ring and interior in single pass, without fill only border
+			status |= ili9488_fill_bordered_circle( s_page, s_col, radius, border_width, p_circle_attr -> fill.enable, fill_color, border_color );
 		}
 
 		// Simple filled circle
@@ -599,7 +937,11 @@ static ili9488_status_t ili9488_fill_circle(const uint16_t page, const uint16_t
 	// Check if init
 	if ( true == gb_is_init )
 	{
-		if ( eILI9488_OK != ili9488_driver_fill_circle(page, col, radius, color ))
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_circle( page, col, radius, color );
+		}
+		else if ( eILI9488_OK != ili9488_driver_fill_circle(page, col, radius, color ))
 		{
 			status = eILI9488_ERROR;
 		}
@@ -618,20 +960,30 @@ static ili9488_status_t ili9488_fill_circle(const uint16_t page, const uint16_t
 
 //////////////////////////////////////////////////////////////
 /*
-*			Set up display backlight
+*			Fill circle with border
 *
-*	param: 		brightness 	- Brightness value from 0.0 - 1.0
-*	return:		status 		- Status of operation
+*	param: 		page 			- Center page
+*	param: 		col 			- Center column
+*	param: 		radius			- Size of radius
+*	param: 		border_width 	- Width of border
+*	param: 		fill_en 		- Fill inside of border
+*	param: 		fill_color 		- Color of circle
+*	param: 		border_color 	- Color of border
+*	return:		status 	- Status of operation
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_set_backlight(const float32_t brightness)
+static ili9488_status_t ili9488_fill_bordered_circle(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
 {
 	ili9488_status_t status = eILI9488_OK;
 
 	// Check if init
 	if ( true == gb_is_init )
 	{
-		if ( eILI9488_OK != ili9488_low_if_set_led( brightness ))
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_bordered_circle( page, col, radius, border_width, fill_en, fill_color, border_color );
+		}
+		else if ( eILI9488_OK != ili9488_driver_fill_bordered_circle( page, col, radius, border_width, fill_en, fill_color, border_color ))
 		{
 			status = eILI9488_ERROR;
 		}
@@ -648,6 +1000,875 @@ ili9488_status_t ili9488_set_backlight(const float32_t brightness)
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Draw bitmap
+*
+*	param: 		p_bitmap 	- Pointer to bitmap
+*	param: 		page 		- Start page
+*	param: 		col 		- Start column
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_draw_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_bitmap( p_bitmap, page, col );
+		}
+		else
+		{
+			status = ili9488_driver_draw_bitmap( p_bitmap, page, col );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw line
+*
+*	param: 		page_s 		- Start page
+*	param: 		col_s 		- Start column
+*	param: 		page_e 		- End page
+*	param: 		col_e 		- End column
+*	param: 		color 		- Color of line
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_draw_line(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color)
+{
+	ili9488_point_t points[2];
+
+	points[0].page = page_s;
+	points[0].col = col_s;
+	points[1].page = page_e;
+	points[1].col = col_e;
+
+	return ili9488_draw_polyline( points, 2U, color );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw polyline
+*
+*	param: 		p_points 	- Pointer to points, joined in order
+*	param: 		num 		- Number of points
+*	param: 		color 		- Color of line
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_draw_polyline(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_polyline( p_points, num, color );
+		}
+		else
+		{
+			status = ili9488_driver_draw_polyline( p_points, num, color );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill triangle
+*
+*	param: 		p_points 	- Pointer to three corner points
+*	param: 		color 		- Color of triangle
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_fill_triangle(const ili9488_point_t * const p_points, const ili9488_color_t color)
+{
+	return ili9488_fill_polygon( p_points, 3U, eILI9488_FILL_EVEN_ODD, color );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill polygon
+*
+*	param: 		p_points 	- Pointer to corner points, joined in order
+*	param: 		num 		- Number of points
+*	param: 		rule 		- Fill rule of self intersecting polygon
+*	param: 		color 		- Color of polygon
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_fill_polygon(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_polygon( p_points, num, rule, color );
+		}
+		else
+		{
+			status = ili9488_driver_fill_polygon( p_points, num, rule, color );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw arc
+*
+*	Angles are in degrees clockwise from page axis, 0 to
+*	360. Arc goes from start to end angle and wraps over 0
+*	when end is before start.
+*
+*	param: 		page 		- Center page
+*	param: 		col 		- Center column
+*	param: 		radius 		- Outer radius
+*	param: 		width 		- Width of ring towards center, 1 for thin arc
+*	param: 		angle_s 	- Start angle
+*	param: 		angle_e 	- End angle
+*	param: 		color 		- Color of arc
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_draw_arc(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_arc( page, col, radius, width, angle_s, angle_e, color );
+		}
+		else
+		{
+			status = ili9488_driver_fill_arc( page, col, radius, width, angle_s, angle_e, color );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill pie slice
+*
+*	param: 		page 		- Center page
+*	param: 		col 		- Center column
+*	param: 		radius 		- Radius
+*	param: 		angle_s 	- Start angle
+*	param: 		angle_e 	- End angle
+*	param: 		color 		- Color of slice
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_fill_pie(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color)
+{
+	return ili9488_draw_arc( page, col, radius, ( radius + 1U ), angle_s, angle_e, color );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Update arc of gauge
+*
+*	Gauge arc starts at start angle and is drawn up to its
+*	value angle with foreground color, rest with background.
+*	Only arc between old and new value angle is filled,
+*	with foreground when value grows and background when
+*	it drops, so only pixels that change color are sent.
+*
+*	param: 		page 		- Center page
+*	param: 		col 		- Center column
+*	param: 		radius 		- Outer radius
+*	param: 		width 		- Width of ring towards center
+*	param: 		angle_s 	- Start angle of gauge, 0 to 360
+*	param: 		angle_old 	- Angle of old value, 0 to 360
+*	param: 		angle_new 	- Angle of new value, 0 to 360
+*	param: 		fg_color 	- Color up to value
+*	param: 		bg_color 	- Color after value
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_update_arc(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_old, const uint16_t angle_new, const ili9488_color_t fg_color, const ili9488_color_t bg_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint16_t sweep_old;
+	uint16_t sweep_new;
+
+	if 	(	( angle_s > 360U )
+		||	( angle_old > 360U )
+		||	( angle_new > 360U ))
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Updating arc invalid angle..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Sweep from start of gauge
+		sweep_old = (( angle_old >= angle_s ) ? ((uint16_t)( angle_old - angle_s )) : ((uint16_t)( angle_old + 360U - angle_s )));
+		sweep_new = (( angle_new >= angle_s ) ? ((uint16_t)( angle_new - angle_s )) : ((uint16_t)( angle_new + 360U - angle_s )));
+
+		if ( sweep_new > sweep_old )
+		{
+			status = ili9488_draw_arc( page, col, radius, width, angle_old, angle_new, fg_color );
+		}
+		else if ( sweep_new < sweep_old )
+		{
+			status = ili9488_draw_arc( page, col, radius, width, angle_new, angle_old, bg_color );
+		}
+		else
+		{
+			// No actions...
+		}
+	}
+
+	return status;
+}
+
+
+#if ( ILI9488_AA_EN )
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased line
+	*
+	*	Edge pixels are blended with background color, in frame
+	*	with what is already drawn below.
+	*
+	*	param: 		page_s 		- Start page
+	*	param: 		col_s 		- Start column
+	*	param: 		page_e 		- End page
+	*	param: 		col_e 		- End column
+	*	param: 		color 		- Color of line
+	*	param: 		bg_color 	- Background color
+	*	return:		status 		- Status of operation
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_draw_line_aa(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		// Check if init
+		if ( true == gb_is_init )
+		{
+			if ( true == ili9488_render_is_open() )
+			{
+				status = ili9488_render_line_aa( page_s, col_s, page_e, col_e, color, bg_color );
+			}
+			else
+			{
+				status = ili9488_driver_draw_line_aa( page_s, col_s, page_e, col_e, color, bg_color );
+			}
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Module not initialized!" );
+			ILI9488_ASSERT( 0 );
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased circle
+	*
+	*	param: 		page 		- Center page
+	*	param: 		col 		- Center column
+	*	param: 		radius 		- Radius of circle
+	*	param: 		fill_en 	- Fill interior, otherwise one pixel wide edge
+	*	param: 		color 		- Color of circle
+	*	param: 		bg_color 	- Background color
+	*	return:		status 		- Status of operation
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_draw_circle_aa(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		// Check if init
+		if ( true == gb_is_init )
+		{
+			if ( true == ili9488_render_is_open() )
+			{
+				status = ili9488_render_circle_aa( page, col, radius, fill_en, color, bg_color );
+			}
+			else
+			{
+				status = ili9488_driver_draw_circle_aa( page, col, radius, fill_en, color, bg_color );
+			}
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Module not initialized!" );
+			ILI9488_ASSERT( 0 );
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Display anti-aliased string
+	*
+	*	String is drawn with string pen at half of font size,
+	*	e.g. 12 pixels high with font 24, starting exactly at
+	*	given page.
+	*
+	*	param: 		str 	- String to display
+	*	param: 		page 	- Start page
+	*	param: 		col 	- Start column
+	*	return:		status 	- Status of operation
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_set_string_aa(const char* str, const uint16_t page, const uint16_t col)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		// Check if init
+		if ( true == gb_is_init )
+		{
+			if ( true == ili9488_render_is_open() )
+			{
+				status = ili9488_render_text_aa( str, strlen( str ), page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+			}
+			else
+			{
+				status = ili9488_driver_set_chars_aa( str, strlen( str ), page, col, g_stringPen.fg_color, g_stringPen.bg_color, g_stringPen.font_opt );
+			}
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Module not initialized!" );
+			ILI9488_ASSERT( 0 );
+		}
+
+		return status;
+	}
+
+#else
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased line
+	*
+	*	Anti-aliasing is disabled (ILI9488_AA_EN), nothing is
+	*	drawn.
+	*
+	*	param: 		page_s 		- Start page
+	*	param: 		col_s 		- Start column
+	*	param: 		page_e 		- End page
+	*	param: 		col_e 		- End column
+	*	param: 		color 		- Color of line
+	*	param: 		bg_color 	- Background color
+	*	return:		status 		- Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_draw_line_aa(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		(void) page_s;
+		(void) col_s;
+		(void) page_e;
+		(void) col_e;
+		(void) color;
+		(void) bg_color;
+
+		ILI9488_DBG_PRINT( "Anti-aliasing not enabled..." );
+
+		return eILI9488_ERROR;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased circle
+	*
+	*	Anti-aliasing is disabled (ILI9488_AA_EN), nothing is
+	*	drawn.
+	*
+	*	param: 		page 		- Center page
+	*	param: 		col 		- Center column
+	*	param: 		radius 		- Radius of circle
+	*	param: 		fill_en 	- Fill interior, otherwise one pixel wide edge
+	*	param: 		color 		- Color of circle
+	*	param: 		bg_color 	- Background color
+	*	return:		status 		- Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_draw_circle_aa(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		(void) page;
+		(void) col;
+		(void) radius;
+		(void) fill_en;
+		(void) color;
+		(void) bg_color;
+
+		ILI9488_DBG_PRINT( "Anti-aliasing not enabled..." );
+
+		return eILI9488_ERROR;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Display anti-aliased string
+	*
+	*	Anti-aliasing is disabled (ILI9488_AA_EN), nothing is
+	*	drawn.
+	*
+	*	param: 		str 	- String to display
+	*	param: 		page 	- Start page
+	*	param: 		col 	- Start column
+	*	return:		status 	- Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_set_string_aa(const char* str, const uint16_t page, const uint16_t col)
+	{
+		(void) str;
+		(void) page;
+		(void) col;
+
+		ILI9488_DBG_PRINT( "Anti-aliasing not enabled..." );
+
+		return eILI9488_ERROR;
+	}
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set up display backlight
+*
+*	param: 		brightness 	- Brightness value from 0.0 - 1.0
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_set_backlight(const float32_t brightness)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check if init
+	if ( true == gb_is_init )
+	{
+		if ( eILI9488_OK != ili9488_low_if_set_led( brightness ))
+		{
+			status = eILI9488_ERROR;
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get status of GRAM transfer
+*
+*	param: 		none
+*	return:		true if transfer to display is in progress
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_is_busy(void)
+{
+	return ili9488_low_if_is_busy();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Wait for GRAM transfer to finish
+*
+*	Reports error of non-blocking transfer that failed after
+*	drawing function already returned.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_wait(void)
+{
+	return ili9488_low_if_wait();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set GRAM transfer complete callback
+*
+*	NOTE: In DMA mode callback is called from interrupt!
+*
+*	param: 		pf_cb - Pointer to callback, NULL to disable
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_set_tx_cplt_callback(const pf_ili9488_tx_cplt_cb_t pf_cb)
+{
+	ili9488_low_if_set_tx_cplt_cb( pf_cb );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			DMA interrupt handler
+*
+*	NOTE: Must be called from ILI9488_SPI_DMA_IRQ interrupt
+*	routine when ILI9488_SPI_DMA_EN is enabled.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_dma_hndl(void)
+{
+	ili9488_low_if_dma_hndl();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get address window statistics
+*
+*	Every cursor setup counts column and page boundary
+*	separately, either as hit (command skipped) or miss.
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_get_window_stats(ili9488_window_stats_t * const p_stats)
+{
+	ili9488_driver_get_window_stats( p_stats );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset address window statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_reset_window_stats(void)
+{
+	ili9488_driver_reset_window_stats();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get glyph cache statistics
+*
+*	NOTE: All zeros if ILI9488_GLYPH_CACHE_EN is disabled.
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_get_glyph_cache_stats(ili9488_glyph_cache_stats_t * const p_stats)
+{
+	#if ( ILI9488_GLYPH_CACHE_EN )
+		ili9488_glyph_cache_get_stats( p_stats );
+	#else
+		memset( p_stats, 0, sizeof( ili9488_glyph_cache_stats_t ));
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset glyph cache statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_reset_glyph_cache_stats(void)
+{
+	#if ( ILI9488_GLYPH_CACHE_EN )
+		ili9488_glyph_cache_reset_stats();
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove all glyphs from glyph cache
+*
+*	Frees cache RAM, e.g. after font or pen change, when
+*	cached glyphs will not be drawn anymore. Statistics are
+*	kept.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_clear_glyph_cache(void)
+{
+	#if ( ILI9488_GLYPH_CACHE_EN )
+		ili9488_glyph_cache_clear();
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Begin frame
+*
+*	Until "ili9488_frame_end" is called background, rectangle,
+*	circle, string and printf calls are only recorded. Frame must
+*	record complete scene, as areas not covered by any
+*	command are rendered black. Only areas of objects that
+*	changed since previous frame are sent to display.
+*
+*	NOTE: "ili9488_printf" in terminal mode returns error
+*	inside frame. Without ILI9488_RENDER_EN all calls draw
+*	directly.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_frame_begin(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	if ( true == gb_is_init )
+	{
+		#if ( ILI9488_RENDER_EN )
+			ili9488_render_begin( true );
+		#endif
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Module not initialized!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Invalidate area of frame
+*
+*	Objects that changed since previous frame are invalidated
+*	automatically. This is needed only for areas changed
+*	outside of frames, e.g. by terminal.
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_frame_invalidate(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	#if ( ILI9488_RENDER_EN )
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_invalidate( page, col, page_size, col_size );
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Frame not started!" );
+		}
+	#else
+		(void) page;
+		(void) col;
+		(void) page_size;
+		(void) col_size;
+	#endif
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			End frame
+*
+*	Recorded commands are rasterised strip by strip and
+*	invalidated areas are sent to display.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_frame_end(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	#if ( ILI9488_RENDER_EN )
+		if ( true == ili9488_render_is_open() )
+		{
+			status = ili9488_render_end();
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Frame not started!" );
+		}
+	#endif
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get frame renderer statistics
+*
+*	NOTE: All zeros if ILI9488_RENDER_EN is disabled.
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_get_render_stats(ili9488_render_stats_t * const p_stats)
+{
+	#if ( ILI9488_RENDER_EN )
+		ili9488_render_get_stats( p_stats );
+	#else
+		memset( p_stats, 0, sizeof( ili9488_render_stats_t ));
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset frame renderer statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_reset_render_stats(void)
+{
+	#if ( ILI9488_RENDER_EN )
+		ili9488_render_reset_stats();
+	#endif
+}
+
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get region tracker statistics
+*
+*	NOTE: All zeros if ILI9488_RENDER_EN is disabled.
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_get_region_stats(ili9488_region_stats_t * const p_stats)
+{
+	#if ( ILI9488_RENDER_EN )
+		ili9488_region_get_stats( p_stats );
+	#else
+		memset( p_stats, 0, sizeof( ili9488_region_stats_t ));
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset region tracker statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_reset_region_stats(void)
+{
+	#if ( ILI9488_RENDER_EN )
+		ili9488_region_reset_stats();
+	#endif
+}
+
 //////////////////////////////////////////////////////////////
 // END OF FILE
 //////////////////////////////////////////////////////////////
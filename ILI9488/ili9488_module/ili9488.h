@@ -30,21 +30,70 @@ typedef enum
 } ili9488_status_t;
 
 
-// Colors
+// Color
+//
+// NOTE: Packed as 0x00RRGGBB, display shows 6 MSBs of each
+// channel in 18-bit format.
+typedef uint32_t ili9488_color_t;
+
+// Color from 8-bit channels
+#define ILI9488_COLOR_RGB888(r,g,b)		((ili9488_color_t)((((uint32_t)( r ) & 0xFFU ) << 16U ) | (((uint32_t)( g ) & 0xFFU ) << 8U ) | ((uint32_t)( b ) & 0xFFU )))
+
+// Color from RGB565 code, missing LSBs are copied from MSBs
+#define ILI9488_COLOR_RGB565(code)		ILI9488_COLOR_RGB888(	((((code) >> 8U ) & 0xF8U ) | (((code) >> 13U ) & 0x07U )),	\
+																((((code) >> 3U ) & 0xFCU ) | (((code) >> 9U ) & 0x03U )),	\
+																((((code) << 3U ) & 0xF8U ) | (((code) >> 2U ) & 0x07U )))
+
+// Channels of color
+#define ILI9488_COLOR_R(color)			((uint8_t)(((color) >> 16U ) & 0xFFU ))
+#define ILI9488_COLOR_G(color)			((uint8_t)(((color) >> 8U ) & 0xFFU ))
+#define ILI9488_COLOR_B(color)			((uint8_t)((color) & 0xFFU ))
+
+// Named colors
+#define ILI9488_COLOR_BLACK				ILI9488_COLOR_RGB888( 0x00U, 0x00U, 0x00U )
+#define ILI9488_COLOR_BLUE				ILI9488_COLOR_RGB888( 0x00U, 0x00U, 0xFCU )
+#define ILI9488_COLOR_GREEN				ILI9488_COLOR_RGB888( 0x00U, 0xFCU, 0x00U )
+#define ILI9488_COLOR_TURQUOISE			ILI9488_COLOR_RGB888( 0x00U, 0xFCU, 0xFCU )
+#define ILI9488_COLOR_RED				ILI9488_COLOR_RGB888( 0xFCU, 0x00U, 0x00U )
+#define ILI9488_COLOR_PURPLE			ILI9488_COLOR_RGB888( 0xFCU, 0x00U, 0xFCU )
+#define ILI9488_COLOR_YELLOW			ILI9488_COLOR_RGB888( 0xFCU, 0xFCU, 0x00U )
+#define ILI9488_COLOR_WHITE				ILI9488_COLOR_RGB888( 0xFCU, 0xFCU, 0xFCU )
+#define ILI9488_COLOR_LIGHT_GRAY		ILI9488_COLOR_RGB888( 0xDCU, 0xDCU, 0xDCU )
+#define ILI9488_COLOR_GRAY				ILI9488_COLOR_RGB888( 0x80U, 0x80U, 0x80U )
+
+// Named colors of former color enum
+//
+// NOTE: Deprecated, kept only so that old code compiles.
+// They are packed colors now, not 0..9 indexes, thus must
+// not be used as index or stored in a byte.
+#define eILI9488_COLOR_BLACK			ILI9488_COLOR_BLACK
+#define eILI9488_COLOR_BLUE				ILI9488_COLOR_BLUE
+#define eILI9488_COLOR_GREEN			ILI9488_COLOR_GREEN
+#define eILI9488_COLOR_TURQUOISE		ILI9488_COLOR_TURQUOISE
+#define eILI9488_COLOR_RED				ILI9488_COLOR_RED
+#define eILI9488_COLOR_PURPLE			ILI9488_COLOR_PURPLE
+#define eILI9488_COLOR_YELLOW			ILI9488_COLOR_YELLOW
+#define eILI9488_COLOR_WHITE			ILI9488_COLOR_WHITE
+#define eILI9488_COLOR_LIGHT_GRAY		ILI9488_COLOR_LIGHT_GRAY
+#define eILI9488_COLOR_GRAY				ILI9488_COLOR_GRAY
+
+// Display orientation
+//
+// NOTE: Mirrored orientations have page axis reversed,
+// they are meant for panels viewed through mirror.
 typedef enum
 {
-	eILI9488_COLOR_BLACK = 0,
-	eILI9488_COLOR_BLUE,
-	eILI9488_COLOR_GREEN,
-	eILI9488_COLOR_TURQUOISE,
-	eILI9488_COLOR_RED,
-	eILI9488_COLOR_PURPLE,
-	eILI9488_COLOR_YELLOW,
-	eILI9488_COLOR_WHITE,
-	eILI9488_COLOR_LIGHT_GRAY,
-	eILI9488_COLOR_GRAY,
-
-} ili9488_color_t;
+	eILI9488_ORIENTATION_LANDSCAPE = 0,
+	eILI9488_ORIENTATION_LANDSCAPE_FLIP,
+	eILI9488_ORIENTATION_PORTRAIT,
+	eILI9488_ORIENTATION_PORTRAIT_FLIP,
+	eILI9488_ORIENTATION_LANDSCAPE_MIRROR,
+	eILI9488_ORIENTATION_LANDSCAPE_FLIP_MIRROR,
+	eILI9488_ORIENTATION_PORTRAIT_MIRROR,
+	eILI9488_ORIENTATION_PORTRAIT_FLIP_MIRROR,
+
+	eILI9488_ORIENTATION_NUM_OF,
+} ili9488_orientation_t;
 
 // Font options
 typedef enum
@@ -55,9 +104,67 @@ typedef enum
 	eILI9488_FONT_20,
 	eILI9488_FONT_24,
 
+	// Compiled fonts
+	eILI9488_FONT_USER_0,
+	eILI9488_FONT_USER_1,
+
 	eILI9488_FONT_NUM_OF,
 } ili9488_font_opt_t;
 
+// Bitmap pixel formats
+typedef enum
+{
+	eILI9488_BITMAP_RGB888 = 0,		// 3 bytes per pixel: R, G, B
+	eILI9488_BITMAP_RGB565,			// 2 bytes per pixel, high byte first
+	eILI9488_BITMAP_MONO,			// 1 bit per pixel: 1 - fg, 0 - bg color
+	eILI9488_BITMAP_INDEX_2,		// 2 bit palette index per pixel
+	eILI9488_BITMAP_INDEX_4,		// 4 bit palette index per pixel
+	eILI9488_BITMAP_INDEX_8,		// 8 bit palette index per pixel
+	eILI9488_BITMAP_RLE,			// Run length compressed RGB888
+	eILI9488_BITMAP_LZ,				// Run length and LZ compressed RGB888
+
+	eILI9488_BITMAP_NUM_OF,
+} ili9488_bitmap_format_t;
+
+// Bitmap
+//
+// NOTE: Pixels are stored line by line, starting at start
+// page and column, with pages running fastest. Formats
+// below 8 bits per pixel start each line at new byte and
+// keep first pixel in MSB. Compressed formats keep pixels
+// in GRAM order instead, with columns running fastest.
+typedef struct
+{
+	const uint8_t *			p_data;		// Pixels
+	uint16_t				width;		// Size in pages
+	uint16_t				height;		// Size in columns
+	ili9488_bitmap_format_t	format;		// Pixel format
+	const uint8_t *			p_palette;	// Palette of index formats, 3 bytes per entry: R, G, B
+	ili9488_color_t			fg_color;	// Colors of mono format
+	ili9488_color_t			bg_color;
+	uint32_t				size;		// Size of compressed data in bytes
+} ili9488_bitmap_t;
+
+// Point of display
+typedef struct
+{
+	uint16_t	page;
+	uint16_t	col;
+} ili9488_point_t;
+
+// Polygon fill rule
+typedef enum
+{
+	eILI9488_FILL_EVEN_ODD = 0,		// Inside when crossing odd number of edges
+	eILI9488_FILL_NON_ZERO,			// Inside when edges wind around
+} ili9488_fill_rule_t;
+
+// Display list item handle
+typedef uint16_t ili9488_item_t;
+
+// Invalid display list item
+#define ILI9488_ITEM_INVALID		( 0xFFFFU )
+
 // Rectangle attributes
 typedef struct
 {
@@ -122,6 +229,82 @@ typedef struct
 
 } ili9488_circ_attr_t;
 
+// Address window statistics
+typedef struct
+{
+	uint32_t hits;		// Boundary commands skipped, as already programmed
+	uint32_t misses;	// Boundary commands sent
+} ili9488_window_stats_t;
+
+// Glyph cache statistics
+typedef struct
+{
+	uint32_t hits;		// Glyphs taken from cache
+	uint32_t misses;	// Glyphs not found in cache
+	uint32_t evictions;	// Glyphs evicted to make space
+	uint32_t glyphs;	// Glyphs currently in cache
+	uint32_t used;		// Used cache in bytes
+} ili9488_glyph_cache_stats_t;
+
+// Frame renderer statistics
+typedef struct
+{
+	uint32_t frames;	// Frames rendered
+	uint32_t strips;	// Strips flushed to display
+	uint32_t commands;	// Commands rasterised into strips
+	uint32_t pixels;	// Pixels flushed to display
+} ili9488_render_stats_t;
+
+// Region tracker statistics
+typedef struct
+{
+	uint32_t frames;		// Frames tracked
+	uint32_t rects;			// Invalidated rectangles
+	uint32_t merges;		// Rectangles merged into others
+	uint32_t regions;		// Regions redrawn after merging
+	uint32_t pixels;		// Pixels redrawn
+	uint32_t overdraw;		// Pixels redrawn but not invalidated, cost of merging
+	uint32_t saved;			// Pixels not redrawn compared to full frames
+	uint32_t last_pixels;	// Pixels redrawn in last frame
+	uint32_t last_saved;	// Pixels not redrawn in last frame
+} ili9488_region_stats_t;
+
+// GRAM transfer complete callback
+typedef void (*pf_ili9488_tx_cplt_cb_t)(void);
+
+// SPI interface status
+typedef enum
+{
+	eILI9488_SPI_OK = 0,
+	eILI9488_SPI_ERROR,
+} ili9488_spi_status_t;
+
+// Spi functions
+typedef ili9488_spi_status_t (*pf_spi_tx_t) (const uint8_t * p_data, const uint32_t size);
+typedef ili9488_spi_status_t (*pf_spi_rx_t) (uint8_t * const p_data, const uint32_t size);
+
+// Transport interface
+//
+// Display is accessed only through this functions, therefore
+// complete display stack can run on any platform. If not set
+// STM32 HAL transport is used.
+//
+// NOTE: Line state "true" means high level. When burst started
+// with "pf_transmit_async" is finished transport must call
+// "ili9488_low_if_tx_cplt_hndl".
+typedef struct
+{
+	ili9488_status_t	(*pf_init)			(void);							// Interface init, can be NULL
+	pf_spi_tx_t			pf_transmit;										// Blocking transmit
+	pf_spi_tx_t			pf_transmit_async;									// Non-blocking transmit, NULL if not supported
+	pf_spi_rx_t			pf_receive;											// Blocking receive
+	void 				(*pf_set_cs)		(const bool state);				// Chip select line
+	void 				(*pf_set_dc)		(const bool state);				// Data (high) / command (low) line
+	void 				(*pf_set_reset)		(const bool state);				// Reset line
+	ili9488_status_t	(*pf_set_led)		(const float32_t brightness);	// Backlight brightness 0.0 - 1.0
+	void				(*pf_delay_ms)		(const uint32_t ms);			// Delay in miliseconds
+} ili9488_transport_t;
+
 
 //////////////////////////////////////////////////////////////
 //	VARIABLES
@@ -133,20 +316,73 @@ typedef struct
 //////////////////////////////////////////////////////////////
 
 // General functions
+ili9488_status_t	ili9488_set_transport	(const ili9488_transport_t * const p_transport);
 ili9488_status_t 	ili9488_init			(void);
 bool				ili9488_is_init			(void);
 ili9488_status_t 	ili9488_set_backlight	(const float32_t brightness);
 
+// Orientation functions
+ili9488_status_t	ili9488_set_orientation	(const ili9488_orientation_t orientation);
+ili9488_orientation_t ili9488_get_orientation	(void);
+uint16_t			ili9488_get_width		(void);
+uint16_t			ili9488_get_height		(void);
+ili9488_status_t	ili9488_map_point		(const ili9488_orientation_t from, const ili9488_orientation_t to, const uint16_t page, const uint16_t col, uint16_t * const p_page, uint16_t * const p_col);
+
+// Transfer functions
+bool				ili9488_is_busy					(void);
+ili9488_status_t	ili9488_wait					(void);
+void				ili9488_set_tx_cplt_callback	(const pf_ili9488_tx_cplt_cb_t pf_cb);
+void				ili9488_dma_hndl				(void);
+void				ili9488_get_window_stats		(ili9488_window_stats_t * const p_stats);
+void				ili9488_reset_window_stats		(void);
+
 // Graphics functions
 ili9488_status_t 	ili9488_set_background	(const ili9488_color_t color);
 ili9488_status_t	ili9488_draw_rectangle	(const ili9488_rect_attr_t * const p_rectanegle_attr);
 ili9488_status_t	ili9488_draw_circle		(const ili9488_circ_attr_t * const p_circ_attr);
+ili9488_status_t	ili9488_draw_bitmap		(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col);
+ili9488_status_t	ili9488_draw_line		(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color);
+ili9488_status_t	ili9488_draw_polyline	(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_color_t color);
+ili9488_status_t	ili9488_fill_triangle	(const ili9488_point_t * const p_points, const ili9488_color_t color);
+ili9488_status_t	ili9488_fill_polygon	(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color);
+ili9488_status_t	ili9488_draw_arc		(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color);
+ili9488_status_t	ili9488_fill_pie		(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color);
+ili9488_status_t	ili9488_update_arc		(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_old, const uint16_t angle_new, const ili9488_color_t fg_color, const ili9488_color_t bg_color);
+ili9488_status_t	ili9488_draw_line_aa	(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color);
+ili9488_status_t	ili9488_draw_circle_aa	(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color);
 
 // Text functions
 ili9488_status_t 	ili9488_set_string_pen	(const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt);
 ili9488_status_t 	ili9488_set_string		(const char* str, const uint16_t page, const uint16_t col);
+ili9488_status_t	ili9488_set_string_aa	(const char* str, const uint16_t page, const uint16_t col);
 ili9488_status_t	ili9488_set_cursor		(const uint16_t page, const uint16_t col);
 ili9488_status_t	ili9488_printf			(const char *args, ...);
+ili9488_status_t	ili9488_set_terminal	(const bool enable);
+void				ili9488_get_glyph_cache_stats	(ili9488_glyph_cache_stats_t * const p_stats);
+void				ili9488_reset_glyph_cache_stats	(void);
+void				ili9488_clear_glyph_cache		(void);
+
+// Frame functions
+ili9488_status_t	ili9488_frame_begin				(void);
+ili9488_status_t	ili9488_frame_invalidate		(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size);
+ili9488_status_t	ili9488_frame_end				(void);
+void				ili9488_get_render_stats		(ili9488_render_stats_t * const p_stats);
+void				ili9488_reset_render_stats		(void);
+void				ili9488_get_region_stats		(ili9488_region_stats_t * const p_stats);
+void				ili9488_reset_region_stats		(void);
+
+// Display list functions
+ili9488_status_t	ili9488_list_add_rect		(const ili9488_rect_attr_t * const p_rect_attr, const uint8_t z, ili9488_item_t * const p_item);
+ili9488_status_t	ili9488_list_add_circle		(const ili9488_circ_attr_t * const p_circ_attr, const uint8_t z, ili9488_item_t * const p_item);
+ili9488_status_t	ili9488_list_add_text		(const char * const str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt, const uint8_t z, ili9488_item_t * const p_item);
+ili9488_status_t	ili9488_list_add_bitmap		(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col, const uint8_t z, ili9488_item_t * const p_item);
+ili9488_status_t	ili9488_list_remove			(const ili9488_item_t item);
+ili9488_status_t	ili9488_list_clear			(void);
+ili9488_status_t	ili9488_list_move			(const ili9488_item_t item, const uint16_t page, const uint16_t col);
+ili9488_status_t	ili9488_list_set_color		(const ili9488_item_t item, const ili9488_color_t color, const ili9488_color_t second_color);
+ili9488_status_t	ili9488_list_set_text		(const ili9488_item_t item, const char * const str);
+ili9488_status_t	ili9488_list_set_visible	(const ili9488_item_t item, const bool visible);
+ili9488_status_t	ili9488_list_refresh		(void);
 
 
 //////////////////////////////////////////////////////////////
@@ -14,6 +14,8 @@
 #include "ili9488_driver.h"
 #include "ili9488_config.h"
 #include "ili9488_font.h"
+#include "ili9488_glyph_cache.h"
+#include "ili9488_image.h"
 
 // Strings
 #include <stdio.h>
@@ -25,10 +27,160 @@
 //	DEFINITIONS
 //////////////////////////////////////////////////////////////
 
+// Color channel can be written in 3-bit format
+#define ILI9488_DRIVER_IS_3_BIT_CH(ch)		(( 0x00U == ( ch )) || ( 0xFCU == (( ch ) & 0xFCU )))
+
+// Address window shadow
+typedef struct
+{
+	uint16_t	col_s;
+	uint16_t	col_e;
+	uint16_t	page_s;
+	uint16_t	page_e;
+	bool		col_valid;		// Column boundary known
+	bool		page_valid;		// Page boundary known
+} ili9488_window_t;
+
+// Column of rounded rectangle without interior
+#define ILI9488_DRIVER_NO_INTERIOR					( 0xFFFFU )
+
+// Render target in RAM
+//
+// NOTE: Pixels are stored in same order as they are sent
+// to GRAM, page by page with column running fastest.
+typedef struct
+{
+	ili9488_rgb_t *	p_buf;		// NULL when drawing to GRAM
+	uint16_t		page;		// Target area
+	uint16_t		col;
+	uint16_t		page_size;
+	uint16_t		col_size;
+
+	uint16_t		win_col_s;	// Address window
+	uint16_t		win_col_e;
+	uint16_t		win_page_e;
+	uint16_t		cur_col;	// Address pointer
+	uint16_t		cur_page;
+} ili9488_target_t;
+
+// Polygon edge crossing of page
+typedef struct
+{
+	int32_t		col;		// First column with center right of edge
+	int32_t		dir;		// Edge goes up (1) or down (-1) in pages
+} ili9488_crossing_t;
+
+// Boundary angle of arc
+typedef struct
+{
+	int32_t		oct;		// Octant, 8 when after all pixels
+	int32_t		cos;		// Direction within quadrant
+	int32_t		sin;
+} ili9488_angle_t;
+
+#if ( ILI9488_AA_EN )
+
+	// Anti-aliased pixel stream
+	typedef struct
+	{
+		ili9488_rgb_t	lut[ ILI9488_AA_LEVELS + 1U ];	// Blend from background to color
+		ili9488_rgb_t	run_rgb;		// Pending run of same pixels
+		uint32_t		run;
+		uint16_t		page;			// Position of next pixel
+		uint16_t		col;
+		uint16_t		col_s;			// Address window
+		uint16_t		col_e;
+	} ili9488_aa_t;
+
+	// Longest run of anti-aliased line in one window
+	#define ILI9488_DRIVER_AA_RUN					( 32U )
+
+#endif
+
+// Glyphs of compiled font drawn over same page at once
+#define ILI9488_DRIVER_GLYPH_OVERLAP				( 4U )
+
+// Memory access control bits
+#define ILI9488_DRIVER_MADCTL_MY					( 0x80U )
+#define ILI9488_DRIVER_MADCTL_MX					( 0x40U )
+#define ILI9488_DRIVER_MADCTL_MV					( 0x20U )
+#define ILI9488_DRIVER_MADCTL_BGR					( 0x08U )
+
+// Number of gate lines, vertical scrolling works along them
+#define ILI9488_DRIVER_GATE_LINES					( ILI9488_DISPLAY_SIZE_PAGE )
+
+// Number of source lines
+#define ILI9488_DRIVER_SOURCE_LINES					( ILI9488_DISPLAY_SIZE_COLUMN )
+
+
 //////////////////////////////////////////////////////////////
 //	VARIABLES
 //////////////////////////////////////////////////////////////
 
+// Selected pixel format
+static ili9488_pixel_format_t g_pixel_format = eILI9488_PIXEL_FORMAT_18_BIT;
+
+// Last programmed address window
+static ili9488_window_t g_window;
+static ili9488_window_stats_t g_window_stats;
+
+// Extent of rounded corners, outer and inner edge
+static uint8_t g_corner_ext[2][ UINT8_MAX + 1U ];
+
+// Memory access control and display size in current orientation
+static uint8_t g_madctl = 0xC8U;
+static uint16_t g_page_size = ILI9488_DISPLAY_SIZE_PAGE;
+static uint16_t g_col_size = ILI9488_DISPLAY_SIZE_COLUMN;
+
+// Memory access control of display orientations
+static const ili9488_madctl_t g_orientation_madctl[ eILI9488_ORIENTATION_NUM_OF ] =
+{
+	eILI9488_MADCTL_XY_MIRROR,					// Landscape
+	eILI9488_MADCTL_NORMAL,						// Landscape flip
+	eILI9488_MADCTL_XY_EXCHANGE_X_MIRROR,		// Portrait
+	eILI9488_MADCTL_XY_EXCHANGE_Y_MIRROR,		// Portrait flip
+	eILI9488_MADCTL_X_MIRROR,					// Landscape mirror
+	eILI9488_MADCTL_Y_MIRROR,					// Landscape flip mirror
+	eILI9488_MADCTL_XY_EXCHANGE,				// Portrait mirror
+	eILI9488_MADCTL_XY_EXCHANGE_XY_MIRROR,		// Portrait flip mirror
+};
+
+// Sine of 0 to 90 degrees in 1/32768
+static const uint16_t g_sin_table[ 91U ] =
+{
+	    0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+	 5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+	11207, 11743, 12275, 12803, 13328, 13848, 14365, 14876, 15384, 15886,
+	16384, 16877, 17364, 17847, 18324, 18795, 19261, 19720, 20174, 20622,
+	21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965, 24351, 24730,
+	25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+	28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592,
+	30792, 30983, 31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166,
+	32270, 32365, 32449, 32524, 32588, 32643, 32688, 32723, 32748, 32763,
+	32768
+};
+
+// Vertical scrolling area
+static uint16_t g_scroll_tfa;
+static uint16_t g_scroll_size = ILI9488_DRIVER_GATE_LINES;
+
+// Render target
+static ili9488_target_t g_target;
+
+#if ( ILI9488_IMAGE_EN )
+
+	// First color of compressed image outside of 3-bit palette
+	static ili9488_rgb_t g_image_rgb;
+
+#endif
+
+#if ( ILI9488_AA_EN )
+
+	// Anti-aliased drawing
+	static ili9488_aa_t g_aa;
+
+#endif
+
 
 //////////////////////////////////////////////////////////////
 // FUNCTIONS PROTOTYPES
@@ -42,8 +194,54 @@ static ili9488_status_t ili9488_driver_set_inversion_control	(void);
 static ili9488_status_t ili9488_driver_set_function_control		(void);
 static ili9488_status_t ili9488_driver_set_image_function		(void);
 
+static ili9488_status_t ili9488_driver_write_pixel_format		(const ili9488_pixel_format_t format);
+static ili9488_status_t ili9488_driver_select_pixel_format		(const ili9488_rgb_t * const p_rgb, const uint32_t num);
+static ili9488_status_t ili9488_driver_select_bitmap_format	(const ili9488_bitmap_t * const p_bitmap, const ili9488_rgb_t * const p_mono);
+static ili9488_rgb_t 	ili9488_driver_get_bitmap_pixel			(const ili9488_bitmap_t * const p_bitmap, const ili9488_rgb_t * const p_mono, const uint32_t x, const uint32_t y);
+
+#if ( ILI9488_IMAGE_EN )
+	static ili9488_status_t ili9488_driver_check_image_pixels	(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+#endif
+static ili9488_status_t ili9488_driver_write_pixel				(const uint16_t page, const uint16_t col, const ili9488_rgb_t * const p_rgb);
+
 static ili9488_rgb_t 	ili9488_driver_convert_color_to_rgb		(const ili9488_color_t color);
-static ili9488_status_t ili9488_driver_draw_hline				(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_color_t color);
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+	static void			ili9488_driver_encode_glyph				(const uint8_t * const p_glyph, const ili9488_font_t * const p_font, const ili9488_rgb_t * const p_rgb, uint8_t * const p_buf);
+#endif
+static ili9488_status_t ili9488_driver_set_glyphs				(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_t * const p_font);
+static ili9488_status_t ili9488_driver_gram_write				(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+static ili9488_status_t ili9488_driver_gram_start				(void);
+static ili9488_status_t ili9488_driver_gram_put					(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+static ili9488_status_t ili9488_driver_gram_end					(void);
+
+static void				ili9488_driver_target_put				(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+static void				ili9488_driver_target_fill				(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_rgb_t * const p_rgb);
+
+static ili9488_status_t ili9488_driver_write_rect				(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_rgb_t * const p_rgb);
+static uint32_t			ili9488_driver_get_crossings			(const ili9488_point_t * const p_points, const uint32_t num, const uint16_t page, ili9488_crossing_t * const p_cross);
+static ili9488_status_t ili9488_driver_write_line				(const ili9488_point_t * const p_s, const ili9488_point_t * const p_e, const bool skip_first, const ili9488_rgb_t * const p_rgb);
+static ili9488_status_t ili9488_driver_write_circle_span		(const uint16_t page, const uint16_t col, const uint16_t ext, const uint16_t d_s, const uint16_t d_e, const ili9488_rgb_t * const p_rgb);
+static ili9488_status_t ili9488_driver_select_shape_format		(const ili9488_rgb_t * const p_rgb, const uint8_t border_width, const bool fill_en);
+static ili9488_status_t ili9488_driver_write_round_rect			(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_rgb_t * const p_rgb);
+static ili9488_status_t ili9488_driver_write_round_rect_span	(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint16_t outer, const uint16_t inner, const bool fill_en, const ili9488_rgb_t * const p_rgb);
+static void				ili9488_driver_get_circle_extent		(const uint8_t radius, uint8_t * const p_ext);
+static void				ili9488_driver_get_angle				(const uint16_t angle, ili9488_angle_t * const p_angle);
+static bool				ili9488_driver_is_after_angle			(const int32_t d_page, const int32_t d_col, const ili9488_angle_t * const p_angle);
+static void				ili9488_driver_add_arc_point			(const int32_t radius, const uint16_t angle, int32_t * const p_min, int32_t * const p_max);
+static uint32_t			ili9488_driver_sqrt						(const uint32_t value);
+
+#if ( ILI9488_AA_EN )
+	static ili9488_status_t ili9488_driver_aa_begin				(const ili9488_color_t color, const ili9488_color_t bg_color);
+	static ili9488_status_t ili9488_driver_aa_start				(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size);
+	static ili9488_status_t ili9488_driver_aa_put				(const uint8_t cov, const uint32_t num);
+	static ili9488_status_t ili9488_driver_aa_end				(void);
+	static ili9488_status_t ili9488_driver_write_aa_run			(const bool is_page_major, const uint16_t major, const uint16_t minor, const uint8_t * const p_frac, const uint32_t num);
+	static uint8_t			ili9488_driver_get_circle_cov		(const int32_t d_page, const int32_t d_col, const uint16_t radius, const bool fill_en);
+#endif
+static uint8_t			ili9488_driver_get_madctl_reg		(const ili9488_orientation_t orientation);
+static bool				ili9488_driver_to_panel				(const uint8_t madctl, const uint16_t page, const uint16_t col, uint16_t * const p_x, uint16_t * const p_y);
+static void				ili9488_driver_from_panel			(const uint8_t madctl, const uint16_t x, const uint16_t y, uint16_t * const p_page, uint16_t * const p_col);
 
 
 //////////////////////////////////////////////////////////////
@@ -78,7 +276,7 @@ ili9488_status_t ili9488_driver_init(void)
 
 		// Soft Reset
 		status |= ili9488_driver_soft_reset();
-		HAL_Delay( 10 );
+		ili9488_low_if_delay_ms( 10 );
 
 		// Positive / Negative GAMMA
 		status |= ili9488_driver_set_pos_gamma();
@@ -88,7 +286,11 @@ ili9488_status_t ili9488_driver_init(void)
 		status |= ili9488_driver_set_power_control();
 
 		// Interface pixel format
-		status |= ili9488_driver_set_pixel_format( eILI9488_PIXEL_FORMAT_18_BIT );
+		#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+			status |= ili9488_driver_set_pixel_format( eILI9488_PIXEL_FORMAT_3_BIT );
+		#else
+			status |= ili9488_driver_set_pixel_format( eILI9488_PIXEL_FORMAT_18_BIT );
+		#endif
 
 		// Interface mode control
 		status |= ili9488_driver_set_interface_mode();
@@ -112,10 +314,18 @@ ili9488_status_t ili9488_driver_init(void)
 		status |= ili9488_driver_set_display_on_off( eILI9488_DISPLAY_ON );
 
 		// Memory data access control
-		#if ( 0 == ILI9488_DISPLAY_FLIP )
-			status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_LANDSCAPE );
+		#if ( 0 == ILI9488_DISPLAY_PORTRAIT )
+			#if ( 0 == ILI9488_DISPLAY_FLIP )
+				status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_LANDSCAPE );
+			#else
+				status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_LANDSCAPE_FLIP );
+			#endif
 		#else
-			status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_LANDSCAPE_FLIP );
+			#if ( 0 == ILI9488_DISPLAY_FLIP )
+				status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_PORTRAIT );
+			#else
+				status |= ili9488_driver_set_orientation( eILI9488_ORIENTATION_PORTRAIT_FLIP );
+			#endif
 		#endif
 	}
 
@@ -137,6 +347,10 @@ ili9488_status_t ili9488_driver_soft_reset(void)
 
 	status = ili9488_low_if_write_register( eILI9488_SOFTRST_CMD, NULL, 0U );
 
+	// Address window is reset
+	g_window.col_valid = false;
+	g_window.page_valid = false;
+
 	return status;
 }
 
@@ -470,27 +684,36 @@ ili9488_status_t ili9488_driver_set_orientation(const ili9488_orientation_t orie
 	uint8_t madctl = 0;
 	ili9488_orientation_t orientation_read;
 
-	switch( orientation )
+	if ( orientation < eILI9488_ORIENTATION_NUM_OF )
 	{
-		case eILI9488_ORIENTATION_LANDSCAPE:
-			madctl = 0xC8U;
-			break;
-
-		case eILI9488_ORIENTATION_LANDSCAPE_FLIP:
-			madctl = 0x08U;
-			break;
-
-		default:
-			madctl = 0x48U;
-			ILI9488_ASSERT( 0 );
-			break;
+		madctl = ili9488_driver_get_madctl_reg( orientation );
+		status = ili9488_low_if_write_register( eILI9488_SET_MADCTL_CMD, (uint8_t*) &madctl, 1U );
 	}
+	else
+	{
+		status = eILI9488_ERROR;
 
-	status = ili9488_low_if_write_register( eILI9488_SET_MADCTL_CMD, (uint8_t*) &madctl, 1U );
+		ILI9488_DBG_PRINT( "Invalid orientation..." );
+		ILI9488_ASSERT( 0 );
+	}
 
 	// Verify
 	if ( eILI9488_OK == status )
 	{
+		g_madctl = madctl;
+
+		// Row/column exchange swaps display size
+		if ( ILI9488_DRIVER_MADCTL_MV & madctl )
+		{
+			g_page_size = ILI9488_DISPLAY_SIZE_COLUMN;
+			g_col_size = ILI9488_DISPLAY_SIZE_PAGE;
+		}
+		else
+		{
+			g_page_size = ILI9488_DISPLAY_SIZE_PAGE;
+			g_col_size = ILI9488_DISPLAY_SIZE_COLUMN;
+		}
+
 		status |= ili9488_driver_get_orientation( &orientation_read );
 
 		if ( orientation != orientation_read )
@@ -518,23 +741,201 @@ ili9488_status_t ili9488_driver_get_orientation(ili9488_orientation_t * const p_
 {
 	ili9488_status_t status = eILI9488_OK;
 	uint8_t madctl;
+	uint32_t i;
 
 	status = ili9488_low_if_read_register( eILI9488_READ_MADCTL_CMD, (uint8_t*) &madctl, 1U );
 
-	switch( madctl )
+	*p_orientation = eILI9488_ORIENTATION_LANDSCAPE;
+
+	for ( i = 0; i < eILI9488_ORIENTATION_NUM_OF; i++ )
 	{
-		case 0xC8U:
-			*p_orientation = eILI9488_ORIENTATION_LANDSCAPE;
+		if ( madctl == ili9488_driver_get_madctl_reg((ili9488_orientation_t) i ))
+		{
+			*p_orientation = (ili9488_orientation_t) i;
 			break;
+		}
+	}
 
-		case 0x08U:
-			*p_orientation = eILI9488_ORIENTATION_LANDSCAPE_FLIP;
-			break;
+	if ( i >= eILI9488_ORIENTATION_NUM_OF )
+	{
+		status = eILI9488_ERROR;
+		ILI9488_ASSERT( 0 );
+	}
 
-		default:
-			*p_orientation = eILI9488_ORIENTATION_LANDSCAPE;
-			ILI9488_ASSERT( 0 );
-			break;
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get display size in pages
+*
+*	param: 		none
+*	return:		Number of pages in current orientation
+*/
+//////////////////////////////////////////////////////////////
+uint16_t ili9488_driver_get_page_size(void)
+{
+	return g_page_size;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get display size in columns
+*
+*	param: 		none
+*	return:		Number of columns in current orientation
+*/
+//////////////////////////////////////////////////////////////
+uint16_t ili9488_driver_get_col_size(void)
+{
+	return g_col_size;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Map point between display orientations
+*
+*	Both points address the same pixel of panel.
+*
+*	param: 		from - Orientation of input point
+*	param: 		to - Orientation of output point
+*	param: 		page - Input page
+*	param: 		col - Input column
+*	param: 		p_page - Pointer to output page
+*	param: 		p_col - Pointer to output column
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_map_point(const ili9488_orientation_t from, const ili9488_orientation_t to, const uint16_t page, const uint16_t col, uint16_t * const p_page, uint16_t * const p_col)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint16_t x;
+	uint16_t y;
+
+	if 	(	( from < eILI9488_ORIENTATION_NUM_OF )
+		&&	( to < eILI9488_ORIENTATION_NUM_OF )
+		&&	( true == ili9488_driver_to_panel( ili9488_driver_get_madctl_reg( from ), page, col, &x, &y )))
+	{
+		ili9488_driver_from_panel( ili9488_driver_get_madctl_reg( to ), x, y, p_page, p_col );
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set up vertical scrolling area
+*
+*	Scrolling area covers columns from 0 to size - 1, rest
+*	of display stays fixed. Panel scrolls along its gate
+*	lines only, therefore portrait orientation is required.
+*
+*	NOTE: With row address order mirrored (MY) fixed area
+*	is on top of frame memory, so that scrolling area still
+*	starts at column 0.
+*
+*	param: 		size - Size of scrolling area in columns
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_scroll_area(const uint16_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint16_t tfa;
+	uint16_t bfa;
+	uint8_t data[6];
+
+	if 	(	( 0U == ( ILI9488_DRIVER_MADCTL_MV & g_madctl ))
+		||	( 0U == size )
+		||	( size > ILI9488_DRIVER_GATE_LINES ))
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Scrolling area not supported..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Top and bottom fixed area
+		if ( ILI9488_DRIVER_MADCTL_MY & g_madctl )
+		{
+			tfa = ( ILI9488_DRIVER_GATE_LINES - size );
+			bfa = 0U;
+		}
+		else
+		{
+			tfa = 0U;
+			bfa = ( ILI9488_DRIVER_GATE_LINES - size );
+		}
+
+		data[0] = (( tfa >> 8U ) & 0xFFU );
+		data[1] = (( tfa >> 0U ) & 0xFFU );
+		data[2] = (( size >> 8U ) & 0xFFU );
+		data[3] = (( size >> 0U ) & 0xFFU );
+		data[4] = (( bfa >> 8U ) & 0xFFU );
+		data[5] = (( bfa >> 0U ) & 0xFFU );
+
+		status = ili9488_low_if_write_register( eILI9488_SET_VSCRDEF_CMD, (uint8_t*) &data, 6U );
+
+		if ( eILI9488_OK == status )
+		{
+			g_scroll_tfa = tfa;
+			g_scroll_size = size;
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set vertical scrolling offset
+*
+*	Column "offset" of scrolling area is shown at column 0,
+*	columns before it are wrapped to the end of area.
+*
+*	param: 		offset - Offset in columns
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_scroll_offset(const uint16_t offset)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint16_t vsp;
+	uint8_t data[2];
+
+	if ( offset >= g_scroll_size )
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Scrolling offset out of area..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Frame memory line shown on top of scrolling area
+		if ( ILI9488_DRIVER_MADCTL_MY & g_madctl )
+		{
+			vsp = ( g_scroll_tfa + (( g_scroll_size - offset ) % g_scroll_size ));
+		}
+		else
+		{
+			vsp = ( g_scroll_tfa + offset );
+		}
+
+		data[0] = (( vsp >> 8U ) & 0xFFU );
+		data[1] = (( vsp >> 0U ) & 0xFFU );
+
+		status = ili9488_low_if_write_register( eILI9488_SET_VSCRSADD_CMD, (uint8_t*) &data, 2U );
 	}
 
 	return status;
@@ -545,6 +946,9 @@ ili9488_status_t ili9488_driver_get_orientation(ili9488_orientation_t * const p_
 /*
 *			Set up pixel format
 *
+*	NOTE: When 3-bit format is selected colors outside of
+*	8 color palette are still written in 18-bit format.
+*
 *	param: 		format - Format of pixel
 *	return:		status - Either Ok or Error
 */
@@ -552,9 +956,43 @@ ili9488_status_t ili9488_driver_get_orientation(ili9488_orientation_t * const p_
 ili9488_status_t ili9488_driver_set_pixel_format(const ili9488_pixel_format_t format)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint8_t opt = 0;
 	ili9488_pixel_format_t pf;
 
+	status = ili9488_driver_write_pixel_format( format );
+
+	// Verify
+	if ( eILI9488_OK == status )
+	{
+		g_pixel_format = format;
+
+		status |= ili9488_driver_read_pixel_format( &pf );
+
+		if ( format != pf )
+		{
+			ILI9488_DBG_PRINT( "Verifying pixel format error..." );
+			ILI9488_ASSERT( 0 );
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write pixel format register
+*
+*	Low level interface is informed about new format as well.
+*
+*	param: 		format - Format of pixel
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_pixel_format(const ili9488_pixel_format_t format)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint8_t opt = 0;
+
 	switch( format )
 	{
 		case eILI9488_PIXEL_FORMAT_3_BIT:
@@ -582,18 +1020,58 @@ ili9488_status_t ili9488_driver_set_pixel_format(const ili9488_pixel_format_t fo
 
 	status = ili9488_low_if_write_register( eILI9488_SET_PF_CMD, (uint8_t*) &opt, 1U );
 
-	// Verify
 	if ( eILI9488_OK == status )
 	{
-		status |= ili9488_driver_read_pixel_format( &pf );
+		status = ili9488_low_if_set_pixel_format( format );
+	}
 
-		if ( format != pf )
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Select pixel format for colors
+*
+*	In 3-bit mode display is switched to 18-bit format if
+*	any of colors is outside of 8 color palette and back
+*	to 3-bit format otherwise.
+*
+*	param: 		p_rgb - Pointer to colors
+*	param: 		num - Number of colors
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_select_pixel_format(const ili9488_rgb_t * const p_rgb, const uint32_t num)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_pixel_format_t format = g_pixel_format;
+	uint32_t i;
+
+	if ( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format )
+	{
+		for ( i = 0; i < num; i++ )
 		{
-			ILI9488_DBG_PRINT( "Verifying pixel format error..." );
-			ILI9488_ASSERT( 0 );
+			if 	(	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb[i].R ))
+				||	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb[i].G ))
+				||	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb[i].B )))
+			{
+				format = eILI9488_PIXEL_FORMAT_18_BIT;
+			}
 		}
 	}
 
+	// Pixels stay in RAM
+	if ( NULL != g_target.p_buf )
+	{
+		format = ili9488_low_if_get_pixel_format();
+	}
+
+	if ( format != ili9488_low_if_get_pixel_format())
+	{
+		status = ili9488_driver_write_pixel_format( format );
+	}
+
 	return status;
 }
 
@@ -647,6 +1125,9 @@ ili9488_status_t ili9488_driver_read_pixel_format(ili9488_pixel_format_t * const
 /*
 *			Set cursor
 *
+*	Column and page boundaries are sent only if they differ
+*	from last programmed address window.
+*
 *	param: 		col_s - Start column
 *	param: 		col_e - End column
 *	param: 		page_s - Start page
@@ -662,30 +1143,82 @@ ili9488_status_t ili9488_driver_set_cursor(const uint16_t col_s, const uint16_t
 	// Check column/page limitations
 	if 	(	( page_s > page_e )
 		|| 	( col_s > col_e )
-		||	( page_e > ILI9488_DISPLAY_SIZE_PAGE )
-		||	( col_e > ILI9488_DISPLAY_SIZE_COLUMN ))
+		||	( page_e > g_page_size )
+		||	( col_e > g_col_size ))
 	{
 		ILI9488_DBG_PRINT( "Invalid column or page cursor setting..." );
 		ILI9488_ASSERT( 0 );
 		status = eILI9488_ERROR;
 	}
+
+	// Address window of render target
+	else if ( NULL != g_target.p_buf )
+	{
+		g_target.win_col_s = col_s;
+		g_target.win_col_e = col_e;
+		g_target.win_page_e = page_e;
+		g_target.cur_col = col_s;
+		g_target.cur_page = page_s;
+	}
 	else
 	{
 		// Column boundary
-		baundary[0] = (( col_s >> 8U ) & 0xFFU );
-		baundary[1] = (( col_s >> 0U ) & 0xFFU );
-		baundary[2] = (( col_e >> 8U ) & 0xFFU );
-		baundary[3] = (( col_e >> 0U ) & 0xFFU );
+		if 	(	( true == g_window.col_valid )
+			&&	( col_s == g_window.col_s )
+			&&	( col_e == g_window.col_e ))
+		{
+			g_window_stats.hits++;
+		}
+		else
+		{
+			baundary[0] = (( col_s >> 8U ) & 0xFFU );
+			baundary[1] = (( col_s >> 0U ) & 0xFFU );
+			baundary[2] = (( col_e >> 8U ) & 0xFFU );
+			baundary[3] = (( col_e >> 0U ) & 0xFFU );
 
-		status |= ili9488_low_if_write_register( eILI9488_SET_COL_ADDR_CMD, (uint8_t*) &baundary, 4U );
+			g_window_stats.misses++;
+
+			if ( eILI9488_OK == ili9488_low_if_write_register( eILI9488_SET_COL_ADDR_CMD, (uint8_t*) &baundary, 4U ))
+			{
+				g_window.col_s = col_s;
+				g_window.col_e = col_e;
+				g_window.col_valid = true;
+			}
+			else
+			{
+				g_window.col_valid = false;
+				status = eILI9488_ERROR;
+			}
+		}
 
 		// Page boundary
-		baundary[0] = (( page_s >> 8U ) & 0xFFU );
-		baundary[1] = (( page_s >> 0U ) & 0xFFU );
-		baundary[2] = (( page_e >> 8U ) & 0xFFU );
-		baundary[3] = (( page_e >> 0U ) & 0xFFU );
+		if 	(	( true == g_window.page_valid )
+			&&	( page_s == g_window.page_s )
+			&&	( page_e == g_window.page_e ))
+		{
+			g_window_stats.hits++;
+		}
+		else
+		{
+			baundary[0] = (( page_s >> 8U ) & 0xFFU );
+			baundary[1] = (( page_s >> 0U ) & 0xFFU );
+			baundary[2] = (( page_e >> 8U ) & 0xFFU );
+			baundary[3] = (( page_e >> 0U ) & 0xFFU );
 
-		status |= ili9488_low_if_write_register( eILI9488_SET_PAGE_ADDR_CMD, (uint8_t*) &baundary, 4U );
+			g_window_stats.misses++;
+
+			if ( eILI9488_OK == ili9488_low_if_write_register( eILI9488_SET_PAGE_ADDR_CMD, (uint8_t*) &baundary, 4U ))
+			{
+				g_window.page_s = page_s;
+				g_window.page_e = page_e;
+				g_window.page_valid = true;
+			}
+			else
+			{
+				g_window.page_valid = false;
+				status = eILI9488_ERROR;
+			}
+		}
 	}
 
 	return status;
@@ -694,7 +1227,36 @@ ili9488_status_t ili9488_driver_set_cursor(const uint16_t col_s, const uint16_t
 
 //////////////////////////////////////////////////////////////
 /*
-*			Write to memory
+*			Get address window statistics
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_driver_get_window_stats(ili9488_window_stats_t * const p_stats)
+{
+	*p_stats = g_window_stats;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset address window statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_driver_reset_window_stats(void)
+{
+	g_window_stats.hits = 0U;
+	g_window_stats.misses = 0U;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write to memory
 *
 *	param: 		p_mem - Pointer to data
 *	param: 		size - Number of bytes to be writen
@@ -742,78 +1304,9 @@ static ili9488_rgb_t ili9488_driver_convert_color_to_rgb(const ili9488_color_t c
 {
 	ili9488_rgb_t rgb;
 
-	switch( color )
-	{
-		case eILI9488_COLOR_BLACK:
-			rgb.R = 0x00U;
-			rgb.G = 0x00U;
-			rgb.B = 0x00U;
-			break;
-
-		case eILI9488_COLOR_BLUE:
-			rgb.R = 0x00U;
-			rgb.G = 0x00U;
-			rgb.B = 0xFCU;
-			break;
-
-
-		case eILI9488_COLOR_GREEN:
-			rgb.R = 0x00U;
-			rgb.G = 0xFCU;
-			rgb.B = 0x00U;
-			break;
-
-		case eILI9488_COLOR_TURQUOISE:
-			rgb.R = 0x00U;
-			rgb.G = 0xFCU;
-			rgb.B = 0xFCU;
-			break;
-
-		case eILI9488_COLOR_RED:
-			rgb.R = 0xFCU;
-			rgb.G = 0x00U;
-			rgb.B = 0x00U;
-			break;
-
-		case eILI9488_COLOR_PURPLE:
-			rgb.R = 0xFCU;
-			rgb.G = 0x00U;
-			rgb.B = 0xFCU;
-			break;
-
-		case eILI9488_COLOR_YELLOW:
-			rgb.R = 0xFCU;
-			rgb.G = 0xFCU;
-			rgb.B = 0x00U;
-			break;
-
-		case eILI9488_COLOR_WHITE:
-			rgb.R = 0xFCU;
-			rgb.G = 0xFCU;
-			rgb.B = 0xFCU;
-			break;
-
-		case eILI9488_COLOR_LIGHT_GRAY:
-			rgb.R = 0xDCU;
-			rgb.G = 0xDCU;
-			rgb.B = 0xDCU;
-			break;
-
-		case eILI9488_COLOR_GRAY:
-			rgb.R = 0x80U;
-			rgb.G = 0x80U;
-			rgb.B = 0x80U;
-			break;
-
-		default:
-			rgb.R = 0x00U;
-			rgb.G = 0x00U;
-			rgb.B = 0x00U;
-
-			ILI9488_DBG_PRINT( "Invalid color selection..." );
-			ILI9488_ASSERT( 0 );
-			break;
-	}
+	rgb.R = ILI9488_COLOR_R( color );
+	rgb.G = ILI9488_COLOR_G( color );
+	rgb.B = ILI9488_COLOR_B( color );
 
 	return rgb;
 }
@@ -837,11 +1330,35 @@ ili9488_status_t ili9488_driver_set_pixel(const uint16_t page, const uint16_t co
 	// Convert color
 	rgb = ili9488_driver_convert_color_to_rgb( color );
 
+	// Pixel format
+	status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+	// Write pixel
+	status |= ili9488_driver_write_pixel( page, col, &rgb );
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write pixel in current pixel format
+*
+*	param: 		page - Page
+*	param: 		col - Column
+*	param: 		p_rgb - Color of pixel
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_pixel(const uint16_t page, const uint16_t col, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+
 	// Set cursor
 	status |= ili9488_driver_set_cursor( col, col, page, page );
 
 	// Write memory
-	ili9488_low_if_write_rgb_to_gram( &rgb, 1U );
+	status |= ili9488_driver_gram_write( p_rgb, 1U );
 
 	return status;
 }
@@ -849,43 +1366,64 @@ ili9488_status_t ili9488_driver_set_pixel(const uint16_t page, const uint16_t co
 
 //////////////////////////////////////////////////////////////
 /*
-*			Fill rectangle
+*			Write rectangle of pixels from RAM
 *
-*	param: 		col - Start column
+*	Rectangle is written through one address window with
+*	one memory write, as runs of same colored pixels.
+*
+*	param: 		p_buf - Pixels, page by page with column running fastest
 *	param: 		page - Start page
-*	param: 		col_size - Size of column
+*	param: 		col - Start column
 *	param: 		page_size - Size of page
-*	param: 		color - Color of rectangle
+*	param: 		col_size - Size of column
 *	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_driver_fill_rectangle(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color)
+ili9488_status_t ili9488_driver_write_buffer(const ili9488_rgb_t * const p_buf, const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint32_t pixel_size;
-	ili9488_rgb_t rgb;
+	uint32_t size;
+	uint32_t i;
+	uint32_t run;
 
-	// Check limits
-	if 	(	(( col + col_size ) > ILI9488_DISPLAY_SIZE_COLUMN )
-		||	(( page + page_size ) > ILI9488_DISPLAY_SIZE_PAGE ))
+	size = ((uint32_t) page_size * col_size );
+
+	if 	(	(( col + col_size ) > g_col_size )
+		||	(( page + page_size ) > g_page_size ))
 	{
 		status = eILI9488_ERROR;
-		ILI9488_DBG_PRINT( "Filling rectangle invalid spacing..." );
+		ILI9488_DBG_PRINT( "Writing buffer invalid spacing..." );
 		ILI9488_ASSERT( 0 );
 	}
-	else
+	else if ( size > 0U )
 	{
-		// Convert color
-		rgb = ili9488_driver_convert_color_to_rgb( color );
+		status |= ili9488_driver_select_pixel_format( p_buf, size );
+		status |= ili9488_driver_set_cursor( col, col + col_size - 1U, page, page + page_size - 1U );
+		status |= ili9488_driver_gram_start();
 
-		// Calculate size of pixels
-		pixel_size = (uint32_t) ( col_size * page_size );
+		run = 1U;
 
-		// Set cursor
-		status |= ili9488_driver_set_cursor( col, col + col_size - 1, page, page + page_size - 1);
+		for ( i = 1U; i <= size; i++ )
+		{
+			if 	(	( i < size )
+				&&	( p_buf[i].R == p_buf[ i - 1U ].R )
+				&&	( p_buf[i].G == p_buf[ i - 1U ].G )
+				&&	( p_buf[i].B == p_buf[ i - 1U ].B ))
+			{
+				run++;
+			}
+			else
+			{
+				status |= ili9488_driver_gram_put( &p_buf[ i - 1U ], run );
+				run = 1U;
+			}
+		}
 
-		// Write to memory
-		status |= ili9488_low_if_write_rgb_to_gram( &rgb, pixel_size );
+		status |= ili9488_driver_gram_end();
+	}
+	else
+	{
+		// No actions...
 	}
 
 	return status;
@@ -894,120 +1432,142 @@ ili9488_status_t ili9488_driver_fill_rectangle(const uint16_t page, const uint16
 
 //////////////////////////////////////////////////////////////
 /*
-*			Draw horizontal line
+*			Set render target
 *
-*	param: 		page 	- Start page
-*	param: 		col 	- Start column
-*	param: 		length 	- Length of line
-*	param: 		color 	- Color of line
-*	return:		status - Either Ok or Error
+*	While target is set all drawing functions write into
+*	RAM buffer instead of GRAM, pixels outside of target
+*	area are dropped. Coordinates stay display coordinates.
+*
+*	param: 		p_buf - Buffer of page_size x col_size pixels, NULL for GRAM
+*	param: 		page - Start page of target area
+*	param: 		col - Start column of target area
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	return:		none
 */
 //////////////////////////////////////////////////////////////
-static ili9488_status_t ili9488_driver_draw_hline(const uint16_t page, const uint16_t col, const uint16_t length, const ili9488_color_t color)
+void ili9488_driver_set_target(ili9488_rgb_t * const p_buf, const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
 {
-	ili9488_status_t status = eILI9488_OK;
-	uint16_t i;
-
-	for ( i = 0; i < length; i++ )
-	{
-		status |= ili9488_driver_set_pixel( page + i, col, color );
-	}
-
-	return status;
+	g_target.p_buf = p_buf;
+	g_target.page = page;
+	g_target.col = col;
+	g_target.page_size = page_size;
+	g_target.col_size = col_size;
 }
 
 
 //////////////////////////////////////////////////////////////
 /*
-*			Fill circle
+*			Draw bitmap
 *
-*		NOTE: This function is copied from github.
+*	Pixels are converted one by one while being streamed,
+*	so no extra buffer is needed for any of source formats.
+*	Only part inside render target is walked when target
+*	is set, otherwise whole bitmap is written through one
+*	address window as runs of same colored pixels.
 *
-*		Link: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
+*	NOTE: Compressed bitmap is always decoded whole, pixels
+*	outside of render target are dropped.
 *
-*	param: 		page 	- Start page
-*	param: 		col 	- Start column
-*	param: 		radius 	- Radius of circle
-*	param: 		color 	- Color of circle
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		page - Start page
+*	param: 		col - Start column
 *	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+ili9488_status_t ili9488_driver_draw_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col)
 {
 	ili9488_status_t status = eILI9488_OK;
-	int32_t  D;
-	uint32_t  CurX;
-	uint32_t  CurY;
-
-	// Check limits
-	if 	(	(( col + radius ) > ILI9488_DISPLAY_SIZE_COLUMN )
-		||	(( page + radius ) > ILI9488_DISPLAY_SIZE_PAGE )
-		||	(( col - radius ) < 0 )
-		||	(( page - radius ) < 0 ))
+	ili9488_rgb_t mono[2];
+	ili9488_rgb_t rgb;
+	ili9488_rgb_t prev;
+	uint32_t page_s;
+	uint32_t page_e;
+	uint32_t col_s;
+	uint32_t col_e;
+	uint32_t i;
+	uint32_t j;
+	uint32_t run;
+
+	if 	(	( NULL == p_bitmap )
+		||	( NULL == p_bitmap -> p_data )
+		||	( p_bitmap -> format >= eILI9488_BITMAP_NUM_OF )
+		||	(( NULL == p_bitmap -> p_palette ) && ( p_bitmap -> format >= eILI9488_BITMAP_INDEX_2 ) && ( p_bitmap -> format <= eILI9488_BITMAP_INDEX_8 ))
+		||	(( 0U == p_bitmap -> size ) && ( p_bitmap -> format >= eILI9488_BITMAP_RLE ))
+	#if ( 0 == ILI9488_IMAGE_EN )
+		||	( p_bitmap -> format >= eILI9488_BITMAP_RLE )
+	#endif
+		||	(( col + p_bitmap -> height ) > g_col_size )
+		||	(( page + p_bitmap -> width ) > g_page_size ))
 	{
 		status = eILI9488_ERROR;
-		ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
+		ILI9488_DBG_PRINT( "Drawing bitmap invalid spacing..." );
 		ILI9488_ASSERT( 0 );
 	}
 	else
 	{
-		D = ( 3U - ( radius << 1U ));
-		CurX = 0U;
-		CurY = radius;
-
-		while ( CurX <= CurY )
+		if ( eILI9488_BITMAP_MONO == p_bitmap -> format )
 		{
-			if(CurY > 0)
-			{
-				status |= ili9488_driver_draw_hline( page - CurY, col + CurX, 2*CurY, color );
-				status |= ili9488_driver_draw_hline( page - CurY, col - CurX, 2*CurY, color );
-			}
-
-			if(CurX > 0)
-			{
-				status |= ili9488_driver_draw_hline( page - CurX, col - CurY, 2*CurX, color );
-				status |= ili9488_driver_draw_hline( page - CurX, col + CurY, 2*CurX, color );
-			}
+			mono[0] = ili9488_driver_convert_color_to_rgb( p_bitmap -> bg_color );
+			mono[1] = ili9488_driver_convert_color_to_rgb( p_bitmap -> fg_color );
+		}
 
-			if (D < 0)
-			{
-				D += (CurX << 2) + 6;
-			}
-			else
-			{
-				D += ((CurX - CurY) << 2) + 10;
-				CurY--;
-			}
+		page_s = page;
+		page_e = page + p_bitmap -> width;
+		col_s = col;
+		col_e = col + p_bitmap -> height;
 
-			CurX++;
+		// Clip to render target
+		if ( NULL != g_target.p_buf )
+		{
+			page_s = (( page_s > g_target.page ) ? ( page_s ) : ( g_target.page ));
+			col_s = (( col_s > g_target.col ) ? ( col_s ) : ( g_target.col ));
+			page_e = (( page_e < ( g_target.page + g_target.page_size )) ? ( page_e ) : ( g_target.page + g_target.page_size ));
+			col_e = (( col_e < ( g_target.col + g_target.col_size )) ? ( col_e ) : ( g_target.col + g_target.col_size ));
 		}
 
-		D = 3 - (radius << 1);
-		CurX = 0;
-		CurY = radius;
-
-		while (CurX <= CurY)
+		if (( page_s < page_e ) && ( col_s < col_e ) && ( p_bitmap -> format >= eILI9488_BITMAP_RLE ))
 		{
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col + CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col + CurX ), color );
+		#if ( ILI9488_IMAGE_EN )
+			status |= ili9488_driver_select_bitmap_format( p_bitmap, mono );
+			status |= ili9488_driver_set_cursor( col, col + p_bitmap -> height - 1U, page, page + p_bitmap -> width - 1U );
+			status |= ili9488_driver_gram_start();
+			status |= ili9488_image_decode( p_bitmap, ili9488_driver_gram_put );
+			status |= ili9488_driver_gram_end();
+		#endif
+		}
+		else if (( page_s < page_e ) && ( col_s < col_e ))
+		{
+			status |= ili9488_driver_select_bitmap_format( p_bitmap, mono );
+			status |= ili9488_driver_set_cursor( col_s, col_e - 1U, page_s, page_e - 1U );
+			status |= ili9488_driver_gram_start();
 
-			if (D < 0)
-			{
-				D += (CurX << 2) + 6;
-			}
-			else
+			// Bitmap lines run along pages, GRAM along columns
+			for ( i = ( page_s - page ); i < ( page_e - page ); i++ )
 			{
-				D += ((CurX - CurY) << 2) + 10;
-				CurY--;
+				run = 0;
+
+				for ( j = ( col_s - col ); j < ( col_e - col ); j++ )
+				{
+					rgb = ili9488_driver_get_bitmap_pixel( p_bitmap, mono, i, j );
+
+					if 	(	( run > 0U )
+						&&	(	( rgb.R != prev.R )
+							||	( rgb.G != prev.G )
+							||	( rgb.B != prev.B )))
+					{
+						status |= ili9488_driver_gram_put( &prev, run );
+						run = 0;
+					}
+
+					prev = rgb;
+					run++;
+				}
+
+				status |= ili9488_driver_gram_put( &prev, run );
 			}
 
-			CurX++;
+			status |= ili9488_driver_gram_end();
 		}
 	}
 
@@ -1017,145 +1577,514 @@ ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t
 
 //////////////////////////////////////////////////////////////
 /*
-*			Set circle
-*
-*		NOTE: This function is copied from github.
-*
-*		Link: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
+*			Get bitmap pixel
 *
-*	param: 		page 	- Start page
-*	param: 		col 	- Start column
-*	param: 		radius 	- Radius of circle
-*	param: 		color 	- Color of circle
-*	return:		status - Either Ok or Error
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		p_mono - Background and foreground color of mono format
+*	param: 		x - Pixel along line
+*	param: 		y - Line
+*	return:		rgb - Color of pixel
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+static ili9488_rgb_t ili9488_driver_get_bitmap_pixel(const ili9488_bitmap_t * const p_bitmap, const ili9488_rgb_t * const p_mono, const uint32_t x, const uint32_t y)
 {
-	ili9488_status_t status = eILI9488_OK;
-	int32_t  D;
-	uint32_t  CurX;
-	uint32_t  CurY;
+	ili9488_rgb_t rgb;
+	const uint8_t * p_src;
+	uint32_t bits;
+	uint32_t stride;
+	uint32_t idx;
+	uint16_t code;
 
-	// Check limits
-	if 	(	(( col + radius ) > ILI9488_DISPLAY_SIZE_COLUMN )
-		||	(( page + radius ) > ILI9488_DISPLAY_SIZE_PAGE )
-		||	(( col - radius ) < 0 )
-		||	(( page - radius ) < 0 ))
-	{
-		status = eILI9488_ERROR;
-		ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
-		ILI9488_ASSERT( 0 );
-	}
-	else
+	switch( p_bitmap -> format )
 	{
-		D = 3 - (radius << 1);
-		CurX = 0;
-		CurY = radius;
+		case eILI9488_BITMAP_RGB888:
+			p_src = &p_bitmap -> p_data[ ((( y * p_bitmap -> width ) + x ) * 3U ) ];
+			rgb.R = p_src[0];
+			rgb.G = p_src[1];
+			rgb.B = p_src[2];
+			break;
 
-		while (CurX <= CurY)
-		{
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col - CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col - CurX ), color );
-			status |= ili9488_driver_set_pixel(( page + CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page - CurX ), ( col + CurY ), color );
-			status |= ili9488_driver_set_pixel(( page + CurY ), ( col + CurX ), color );
-			status |= ili9488_driver_set_pixel(( page - CurY ), ( col + CurX ), color );
+		case eILI9488_BITMAP_RGB565:
+			p_src = &p_bitmap -> p_data[ ((( y * p_bitmap -> width ) + x ) * 2U ) ];
+			code = (( p_src[0] << 8U ) | p_src[1] );
+			rgb = ili9488_driver_convert_color_to_rgb( ILI9488_COLOR_RGB565( code ));
+			break;
 
-			if (D < 0)
+		default:
+			// 1, 2, 4 or 8 bits per pixel
+			bits = ( 1UL << ( p_bitmap -> format - eILI9488_BITMAP_MONO ));
+			stride = ((( p_bitmap -> width * bits ) + 7U ) / 8U );
+			idx = ( x * bits );
+
+			code = (( p_bitmap -> p_data[ ( y * stride ) + ( idx / 8U ) ] >> ( 8U - bits - ( idx % 8U ))) & (( 1U << bits ) - 1U ));
+
+			if ( eILI9488_BITMAP_MONO == p_bitmap -> format )
 			{
-				D += (CurX << 2) + 6;
+				rgb = p_mono[ code ];
 			}
 			else
 			{
-				D += ((CurX - CurY) << 2) + 10;
-				CurY--;
+				rgb.R = p_bitmap -> p_palette[ ( code * 3U ) ];
+				rgb.G = p_bitmap -> p_palette[ ( code * 3U ) + 1U ];
+				rgb.B = p_bitmap -> p_palette[ ( code * 3U ) + 2U ];
 			}
-
-			CurX++;
-		}
+			break;
 	}
 
-	return status;
+	return rgb;
 }
 
 
 //////////////////////////////////////////////////////////////
 /*
-*			Set character
+*			Select pixel format for bitmap
 *
-*	param: 		ch - Character to display
-*	param: 		page - Start page
-*	param: 		col - Start column
-*	param: 		fg_color - Foreground color
-*	param: 		bg_color - Background color
-*	param: 		font_opt - Font of choise
+*	In 3-bit mode bitmap is checked up to first pixel
+*	outside of 8 color palette, which selects 18-bit format.
+*
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		p_mono - Background and foreground color of mono format
 *	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt)
+static ili9488_status_t ili9488_driver_select_bitmap_format(const ili9488_bitmap_t * const p_bitmap, const ili9488_rgb_t * const p_mono)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint32_t lut_offset;
-	uint8_t i;
-	uint8_t j;
-	uint32_t line;
-	const ili9488_font_t * p_font;
-	uint8_t line_size_bit;
-	uint8_t line_size_byte;
-	uint8_t line_bit_offset;
-	uint8_t char_lut_size;
+	ili9488_rgb_t rgb = { 0 };
+	uint32_t i;
+	uint32_t j;
+	bool is_3_bit = true;
 
-	// Get font data
-	p_font = ili9488_font_get( font_opt );
-
-	// Check pinter
-	if ( NULL != p_font )
+	if ( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format )
 	{
-		// Calculate various font table info
-		line_size_bit = ((( p_font -> width / 8U ) * 8U ) + 8U );
-		line_size_byte = ( line_size_bit / 8U );
-		line_bit_offset = ( line_size_bit - ( p_font -> width ));
-		char_lut_size = ( p_font -> height * line_size_byte );
-
-		// Calculate table offset
-		lut_offset = char_lut_size * ( ch - 32U );
+		if ( eILI9488_BITMAP_MONO == p_bitmap -> format )
+		{
+			status = ili9488_driver_select_pixel_format( p_mono, 2U );
+		}
 
-		// Every line
-		for ( i = 0; i < p_font -> height; i ++ )
+	#if ( ILI9488_IMAGE_EN )
+		else if ( p_bitmap -> format >= eILI9488_BITMAP_RLE )
 		{
-			// Assemble line
-			line = 0;
-			for ( j = 0; j < line_size_byte; j++ )
+			g_image_rgb = rgb;
+
+			status = ili9488_image_decode( p_bitmap, ili9488_driver_check_image_pixels );
+
+			// Decoding is stopped at first pixel outside of palette
+			is_3_bit = 	(	( true == ILI9488_DRIVER_IS_3_BIT_CH( g_image_rgb.R ))
+						&&	( true == ILI9488_DRIVER_IS_3_BIT_CH( g_image_rgb.G ))
+						&&	( true == ILI9488_DRIVER_IS_3_BIT_CH( g_image_rgb.B )));
+
+			if ( false == is_3_bit )
 			{
-				line |= ( p_font -> p_font[ lut_offset + ( i * line_size_byte ) + j ] << ( line_size_bit - ( 8U * ( j + 1U ))));
+				status = eILI9488_OK;
 			}
+			else
+			{
+				// No actions...
+			}
+
+			status |= ili9488_driver_select_pixel_format( &g_image_rgb, 1U );
+		}
+	#endif
 
-			// Every pixel
-			for( j = line_bit_offset; j < line_size_bit; j++ )
+		else
+		{
+			for ( j = 0; ( j < p_bitmap -> height ) && ( true == is_3_bit ); j++ )
 			{
-				// NOTE: Font width is multiply by two for offset, as char start to draw from right to left
-				// Pixel set
-				if ( line & ( 1 << j ))
+				for ( i = 0; ( i < p_bitmap -> width ) && ( true == is_3_bit ); i++ )
 				{
-					ili9488_driver_set_pixel( page + (( 2U * p_font -> width ) - j -1U ), col + i, fg_color );
+					rgb = ili9488_driver_get_bitmap_pixel( p_bitmap, p_mono, i, j );
+
+					is_3_bit = 	(	( true == ILI9488_DRIVER_IS_3_BIT_CH( rgb.R ))
+								&&	( true == ILI9488_DRIVER_IS_3_BIT_CH( rgb.G ))
+								&&	( true == ILI9488_DRIVER_IS_3_BIT_CH( rgb.B )));
 				}
+			}
 
-				// Pixel cleared
+			status = ili9488_driver_select_pixel_format( &rgb, 1U );
+		}
+	}
+	else
+	{
+		status = ili9488_driver_select_pixel_format( &rgb, 1U );
+	}
+
+	return status;
+}
+
+
+#if ( ILI9488_IMAGE_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Check pixels of compressed image
+	*
+	*	Remembers color outside of 8 color palette and stops
+	*	decoding, as rest of image does not matter.
+	*
+	*	param: 		p_rgb - Color of pixels
+	*	param: 		size - Number of pixels
+	*	return:		status - Error at color outside of palette
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_check_image_pixels(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		(void) size;
+
+		if 	(	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb -> R ))
+			||	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb -> G ))
+			||	( false == ILI9488_DRIVER_IS_3_BIT_CH( p_rgb -> B )))
+		{
+			g_image_rgb = *p_rgb;
+			status = eILI9488_ERROR;
+		}
+
+		return status;
+	}
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw polyline
+*
+*	Points are joined with lines one pixel wide. Shared
+*	points are written only once.
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points, single point draws pixel
+*	param: 		color - Color of line
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_draw_polyline(const ili9488_point_t * const p_points, const uint32_t num, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_rgb_t rgb;
+	uint32_t i;
+
+	// Check limits
+	for ( i = 0; ( NULL != p_points ) && ( i < num ) && ( eILI9488_OK == status ); i++ )
+	{
+		if 	(	( p_points[i].page >= g_page_size )
+			||	( p_points[i].col >= g_col_size ))
+		{
+			status = eILI9488_ERROR;
+		}
+	}
+
+	if (( NULL == p_points ) || ( 0U == num ) || ( eILI9488_OK != status ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Drawing line invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb = ili9488_driver_convert_color_to_rgb( color );
+
+		// Pixel format
+		status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+		if ( 1U == num )
+		{
+			status |= ili9488_driver_write_rect( p_points[0].page, p_points[0].col, 1U, 1U, &rgb );
+		}
+
+		for ( i = 1U; i < num; i++ )
+		{
+			status |= ili9488_driver_write_line( &p_points[ i - 1U ], &p_points[i], ( i > 1U ), &rgb );
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill polygon
+*
+*	Polygon is rasterised page by page. Pixel is filled when
+*	its center is inside polygon, pixels between pairs of
+*	edge crossings form span of columns written as one
+*	window burst.
+*
+*	NOTE: Points are corners of pixels, so polygon with
+*	points (0,0), (10,0), (10,10), (0,10) covers the same
+*	10x10 pixels as rectangle at (0,0). Points can lie on
+*	far edge of display.
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points, 3 to ILI9488_POLYGON_POINT_NUM
+*	param: 		rule - Fill rule of self intersecting polygon
+*	param: 		color - Color of polygon
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_polygon(const ili9488_point_t * const p_points, const uint32_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_crossing_t cross[ ILI9488_POLYGON_POINT_NUM ];
+	ili9488_rgb_t rgb;
+	uint32_t page_s;
+	uint32_t page_e;
+	uint32_t cross_num;
+	uint32_t page;
+	uint32_t i;
+	int32_t col_s;
+	int32_t col_e;
+	int32_t winding;
+
+	// Check limits
+	if (( NULL != p_points ) && ( num >= 3U ) && ( num <= ILI9488_POLYGON_POINT_NUM ))
+	{
+		for ( i = 0; ( i < num ) && ( eILI9488_OK == status ); i++ )
+		{
+			if 	(	( p_points[i].page > g_page_size )
+				||	( p_points[i].col > g_col_size ))
+			{
+				status = eILI9488_ERROR;
+			}
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	if ( eILI9488_OK != status )
+	{
+		ILI9488_DBG_PRINT( "Filling polygon invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb = ili9488_driver_convert_color_to_rgb( color );
+
+		// Pixel format
+		status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+		page_s = p_points[0].page;
+		page_e = p_points[0].page;
+
+		for ( i = 1U; i < num; i++ )
+		{
+			page_s = (( p_points[i].page < page_s ) ? ( p_points[i].page ) : ( page_s ));
+			page_e = (( p_points[i].page > page_e ) ? ( p_points[i].page ) : ( page_e ));
+		}
+
+		// Only pages of render target
+		if ( NULL != g_target.p_buf )
+		{
+			page_s = (( page_s > g_target.page ) ? ( page_s ) : ( g_target.page ));
+			page_e = (( page_e < ( g_target.page + g_target.page_size )) ? ( page_e ) : ( g_target.page + g_target.page_size ));
+		}
+
+		for ( page = page_s; page < page_e; page++ )
+		{
+			cross_num = ili9488_driver_get_crossings( p_points, num, page, cross );
+			winding = 0;
+			col_s = 0;
+
+			for ( i = 0; i < cross_num; i++ )
+			{
+				// Span opens on first and closes on last crossing of inside
+				if ( 0 == winding )
+				{
+					col_s = cross[i].col;
+				}
+
+				if ( eILI9488_FILL_NON_ZERO == rule )
+				{
+					winding += cross[i].dir;
+				}
 				else
 				{
-					ili9488_driver_set_pixel( page + (( 2U * p_font -> width ) - j - 1U ), col + i, bg_color );
+					winding ^= 1;
+				}
+
+				if ( 0 == winding )
+				{
+					col_e = cross[i].col;
+
+					if ( col_e > col_s )
+					{
+						status |= ili9488_driver_write_rect( page, col_s, 1U, ( col_e - col_s ), &rgb );
+					}
 				}
 			}
 		}
 	}
 
-	// No font
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get edge crossings of page
+*
+*	Edges are crossed at center of page. Crossing is kept
+*	as first column with pixel center on or right of edge,
+*	so it is exact and both ends of span use the same
+*	column. Crossings are sorted by column.
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	param: 		page - Page
+*	param: 		p_cross - Pointer to crossings, space for num of them
+*	return:		Number of crossings
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t ili9488_driver_get_crossings(const ili9488_point_t * const p_points, const uint32_t num, const uint16_t page, ili9488_crossing_t * const p_cross)
+{
+	const ili9488_point_t * p_a;
+	const ili9488_point_t * p_b;
+	ili9488_crossing_t tmp;
+	uint32_t cross_num = 0;
+	uint32_t i;
+	uint32_t j;
+	int32_t d_page;
+	int32_t num_col;
+
+	for ( i = 0; i < num; i++ )
+	{
+		// Walk edge from lower page, so crossing does not depend on direction
+		p_a = &p_points[i];
+		p_b = &p_points[ ( i + 1U ) % num ];
+		tmp.dir = 1;
+
+		if ( p_b -> page < p_a -> page )
+		{
+			p_a = p_b;
+			p_b = &p_points[i];
+			tmp.dir = -1;
+		}
+
+		if (( page >= p_a -> page ) && ( page < p_b -> page ))
+		{
+			// Ceiling of edge column minus half of pixel
+			d_page = ((int32_t) p_b -> page - p_a -> page );
+			num_col = (	( 2 * (int32_t) p_a -> col * d_page )
+					+	(((int32_t) p_b -> col - p_a -> col ) * (( 2 * ((int32_t) page - p_a -> page )) + 1 ))
+					-	d_page );
+
+			if ( num_col > 0 )
+			{
+				num_col += (( 2 * d_page ) - 1 );
+			}
+
+			tmp.col = ( num_col / ( 2 * d_page ));
+
+			// Insert sorted
+			for ( j = cross_num; ( j > 0U ) && ( p_cross[ j - 1U ].col > tmp.col ); j-- )
+			{
+				p_cross[j] = p_cross[ j - 1U ];
+			}
+
+			p_cross[j] = tmp;
+			cross_num++;
+		}
+	}
+
+	return cross_num;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write line
+*
+*	Bresenham line, walked along its longer axis. Pixels
+*	with same position on shorter axis are joined into
+*	one run and written as rectangle of one pixel width,
+*	so horizontal and vertical lines take single window.
+*
+*	param: 		p_s - Start point
+*	param: 		p_e - End point
+*	param: 		skip_first - Leave out start point
+*	param: 		p_rgb - Color of line
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_line(const ili9488_point_t * const p_s, const ili9488_point_t * const p_e, const bool skip_first, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+	int32_t d_page;
+	int32_t d_col;
+	int32_t d_major;
+	int32_t d_minor;
+	int32_t step_major;
+	int32_t step_minor;
+	int32_t major;
+	int32_t minor;
+	int32_t run_s;
+	int32_t err;
+	int32_t i;
+	bool is_page_major;
+
+	d_page = ((int32_t) p_e -> page - p_s -> page );
+	d_col = ((int32_t) p_e -> col - p_s -> col );
+
+	is_page_major = ((( d_page < 0 ) ? ( -d_page ) : ( d_page )) >= (( d_col < 0 ) ? ( -d_col ) : ( d_col )));
+
+	if ( true == is_page_major )
+	{
+		d_major = d_page;
+		d_minor = d_col;
+		major = p_s -> page;
+		minor = p_s -> col;
+	}
 	else
 	{
-		status = eILI9488_ERROR;
+		d_major = d_col;
+		d_minor = d_page;
+		major = p_s -> col;
+		minor = p_s -> page;
+	}
+
+	step_major = (( d_major < 0 ) ? ( -1 ) : ( 1 ));
+	step_minor = (( d_minor < 0 ) ? ( -1 ) : ( 1 ));
+	d_major *= step_major;
+	d_minor *= step_minor;
+
+	err = (( 2 * d_minor ) - d_major );
+	run_s = (( true == skip_first ) ? ( major + step_major ) : ( major ));
+
+	for ( i = 0; i <= d_major; i++ )
+	{
+		// Run ends with last pixel or step on shorter axis
+		if (( i == d_major ) || ( err > 0 ))
+		{
+			if ((( major - run_s ) * step_major ) >= 0 )
+			{
+				if ( true == is_page_major )
+				{
+					status |= ili9488_driver_write_rect((( step_major > 0 ) ? ( run_s ) : ( major )), minor, ((( major - run_s ) * step_major ) + 1 ), 1U, p_rgb );
+				}
+				else
+				{
+					status |= ili9488_driver_write_rect( minor, (( step_major > 0 ) ? ( run_s ) : ( major )), 1U, ((( major - run_s ) * step_major ) + 1 ), p_rgb );
+				}
+			}
+
+			if ( err > 0 )
+			{
+				minor += step_minor;
+				err -= ( 2 * d_major );
+			}
+
+			run_s = ( major + step_major );
+		}
+
+		err += ( 2 * d_minor );
+		major += step_major;
 	}
 
 	return status;
@@ -1164,38 +2093,2365 @@ ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page,
 
 //////////////////////////////////////////////////////////////
 /*
-*			Set string
+*			Fill rectangle
 *
-*	param: 		str - Pointer to string
-*	param: 		page - Start page
 *	param: 		col - Start column
-*	param: 		fg_color - Foreground color
-*	param: 		bg_color - Background color
-*	param: 		font_opt - Font of choise
+*	param: 		page - Start page
+*	param: 		col_size - Size of column
+*	param: 		page_size - Size of page
+*	param: 		color - Color of rectangle
 *	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_driver_set_string(const char *str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt)
+ili9488_status_t ili9488_driver_fill_rectangle(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_rgb_t rgb;
+
+	// Check limits
+	if 	(	(( col + col_size ) > g_col_size )
+		||	(( page + page_size ) > g_page_size ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling rectangle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb = ili9488_driver_convert_color_to_rgb( color );
+
+		// Pixel format
+		status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+		// Write rectangle
+		status |= ili9488_driver_write_rect( page, col, page_size, col_size, &rgb );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write pixels of same color to GRAM
+*
+*	Pixels go to render target when it is set.
+*
+*	param: 		p_rgb - Color of pixels
+*	param: 		size - Number of pixels
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_gram_write(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	status |= ili9488_driver_gram_start();
+	status |= ili9488_driver_gram_put( p_rgb, size );
+	status |= ili9488_driver_gram_end();
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Start GRAM write
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_gram_start(void)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint16_t page_walker = page;
-	uint8_t font_width;
 
-	// Get font width
-	font_width = ili9488_font_get_width( font_opt );
+	// Nothing to do for render target
+	if ( NULL == g_target.p_buf )
+	{
+		status = ili9488_low_if_gram_start();
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put pixels of same color into GRAM write
+*
+*	param: 		p_rgb - Color of pixels
+*	param: 		size - Number of pixels
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_gram_put(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
 
-	// Print chars
-	while( *str )
+	if ( NULL != g_target.p_buf )
+	{
+		ili9488_driver_target_put( p_rgb, size );
+	}
+	else
 	{
-		ili9488_driver_set_char( *str, page_walker, col, fg_color, bg_color, font_opt );
-		str++;
-		page_walker += font_width;
+		status = ili9488_low_if_gram_put( p_rgb, size );
 	}
 
 	return status;
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			End GRAM write
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_gram_end(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Nothing to do for render target
+	if ( NULL == g_target.p_buf )
+	{
+		status = ili9488_low_if_gram_end();
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put pixels into render target
+*
+*	Pixels walk address window same way as in GRAM.
+*
+*	param: 		p_rgb - Color of pixels
+*	param: 		size - Number of pixels
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_target_put(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	uint32_t i;
+
+	for ( i = 0; i < size; i++ )
+	{
+		if 	(	( g_target.cur_col >= g_target.col )
+			&&	( g_target.cur_col < ( g_target.col + g_target.col_size ))
+			&&	( g_target.cur_page >= g_target.page )
+			&&	( g_target.cur_page < ( g_target.page + g_target.page_size )))
+		{
+			g_target.p_buf[ (( g_target.cur_page - g_target.page ) * g_target.col_size ) + ( g_target.cur_col - g_target.col ) ] = *p_rgb;
+		}
+
+		// Next pixel
+		if ( g_target.cur_col < g_target.win_col_e )
+		{
+			g_target.cur_col++;
+		}
+		else
+		{
+			g_target.cur_col = g_target.win_col_s;
+
+			if ( g_target.cur_page < g_target.win_page_e )
+			{
+				g_target.cur_page++;
+			}
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill rectangle in render target
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		p_rgb - Color of rectangle
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_target_fill(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_rgb_t * const p_rgb)
+{
+	uint32_t page_s;
+	uint32_t page_e;
+	uint32_t col_s;
+	uint32_t col_e;
+	uint32_t i;
+	uint32_t j;
+	ili9488_rgb_t * p_pix;
+
+	// Intersection with target area
+	page_s = (( page > g_target.page ) ? ( page ) : ( g_target.page ));
+	col_s = (( col > g_target.col ) ? ( col ) : ( g_target.col ));
+	page_e = ((( page + page_size ) < ( g_target.page + g_target.page_size )) ? ( page + page_size ) : ( g_target.page + g_target.page_size ));
+	col_e = ((( col + col_size ) < ( g_target.col + g_target.col_size )) ? ( col + col_size ) : ( g_target.col + g_target.col_size ));
+
+	for ( i = page_s; i < page_e; i++ )
+	{
+		p_pix = &g_target.p_buf[ (( i - g_target.page ) * g_target.col_size ) + ( col_s - g_target.col ) ];
+
+		for ( j = col_s; j < col_e; j++ )
+		{
+			*p_pix++ = *p_rgb;
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write rectangle in current pixel format
+*
+*	Rectangle is written through one address window with
+*	one memory write. Limits are not checked.
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		p_rgb - Color of rectangle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Clip to render target
+	if ( NULL != g_target.p_buf )
+	{
+		ili9488_driver_target_fill( page, col, page_size, col_size, p_rgb );
+	}
+	else if (( page_size > 0U ) && ( col_size > 0U ))
+	{
+		// Set cursor
+		status |= ili9488_driver_set_cursor( col, col + col_size - 1U, page, page + page_size - 1U );
+
+		// Write to memory
+		status |= ili9488_low_if_write_rgb_to_gram( p_rgb, (uint32_t) ( col_size * page_size ));
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill circle
+*
+*	Midpoint algorithm gives extent of circle for every
+*	column distance from center. Neighbour columns with
+*	same extent are merged, every span is then written
+*	with one address window and one memory write, so each
+*	pixel is written exactly once.
+*
+*	param: 		page 	- Start page
+*	param: 		col 	- Start column
+*	param: 		radius 	- Radius of circle
+*	param: 		color 	- Color of circle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	int32_t  D;
+	int32_t  CurX;
+	int32_t  CurY;
+	uint16_t d_s;
+	uint16_t d_e;
+	uint16_t ext;
+	ili9488_rgb_t rgb;
+
+	// Check limits
+	if 	(	(( col + radius ) > g_col_size )
+		||	(( page + radius ) > g_page_size )
+		||	(( col - radius ) < 0 )
+		||	(( page - radius ) < 0 ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb = ili9488_driver_convert_color_to_rgb( color );
+
+		// Pixel format
+		status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+		D = 3 - ( radius << 1 );
+		CurX = 0;
+		CurY = radius;
+
+		// Columns near center (distance CurX, extent CurY)
+		d_s = 0U;
+		d_e = 0U;
+		ext = radius;
+
+		while ( CurX <= CurY )
+		{
+			// Merge with previous span
+			if ( CurY == ext )
+			{
+				d_e = CurX;
+			}
+			else
+			{
+				status |= ili9488_driver_write_circle_span( page, col, ext, d_s, d_e, &rgb );
+
+				d_s = CurX;
+				d_e = CurX;
+				ext = CurY;
+			}
+
+			if (D < 0)
+			{
+				D += (CurX << 2) + 6;
+			}
+			else
+			{
+				D += ((CurX - CurY) << 2) + 10;
+
+				// Columns near edge (distance CurY, extent CurX)
+				// NOTE: Written when CurX reached its maximum for that CurY
+				if ( CurX < CurY )
+				{
+					status |= ili9488_driver_write_circle_span( page, col, CurX, CurY, CurY, &rgb );
+				}
+
+				CurY--;
+			}
+
+			CurX++;
+		}
+
+		status |= ili9488_driver_write_circle_span( page, col, ext, d_s, d_e, &rgb );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write span of filled circle
+*
+*	Span covers columns at distance d_s to d_e from center
+*	on both sides and pages within extent from center.
+*
+*	param: 		page 	- Center page
+*	param: 		col 	- Center column
+*	param: 		ext 	- Extent in pages
+*	param: 		d_s 	- Start distance in columns
+*	param: 		d_e 	- End distance in columns
+*	param: 		p_rgb 	- Color of circle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_circle_span(const uint16_t page, const uint16_t col, const uint16_t ext, const uint16_t d_s, const uint16_t d_e, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Span through center column
+	if ( 0U == d_s )
+	{
+		status |= ili9488_driver_write_rect( page - ext, col - d_e, ( 2U * ext ) + 1U, ( 2U * d_e ) + 1U, p_rgb );
+	}
+	else
+	{
+		status |= ili9488_driver_write_rect( page - ext, col + d_s, ( 2U * ext ) + 1U, ( d_e - d_s ) + 1U, p_rgb );
+		status |= ili9488_driver_write_rect( page - ext, col - d_e, ( 2U * ext ) + 1U, ( d_e - d_s ) + 1U, p_rgb );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill arc
+*
+*	Arc is part of ring between outer radius and width
+*	towards center, from start angle clockwise to end
+*	angle. Width 1 gives thin arc and width of radius + 1
+*	pie slice. Angles are in degrees from page axis towards
+*	column axis, 0 to 360, end before start wraps over 0.
+*
+*	Pixel belongs to arc when its center is inside ring and
+*	its direction from center is in [start, end). Sectors
+*	are compared with integer octant and cross product
+*	logic, so arcs [a, b) and [b, c) never overlap or leave
+*	a gap and gauge can be updated by filling only arc
+*	between old and new angle.
+*
+*	param: 		page 	- Center page
+*	param: 		col 	- Center column
+*	param: 		radius 	- Outer radius
+*	param: 		width 	- Width of ring, radius + 1 for pie
+*	param: 		angle_s - Start angle
+*	param: 		angle_e - End angle
+*	param: 		color 	- Color of arc
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_arc(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_angle_t angle[2];
+	ili9488_rgb_t rgb;
+	uint16_t area_page;
+	uint16_t area_col;
+	uint16_t area_page_size;
+	uint16_t area_col_size;
+	uint32_t page_e;
+	uint32_t outer;
+	int32_t inner;
+	int32_t d_page;
+	int32_t d_col;
+	int32_t ext_o;
+	int32_t ext_i;
+	int32_t seg;
+	int32_t seg_s;
+	int32_t seg_e;
+	int32_t run_s;
+	bool is_in;
+
+	// Check limits
+	if 	(	(( col + radius ) >= g_col_size )
+		||	(( page + radius ) >= g_page_size )
+		||	( col < radius )
+		||	( page < radius )
+		||	( 0U == width )
+		||	( angle_s > 360U )
+		||	( angle_e > 360U ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling arc invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb = ili9488_driver_convert_color_to_rgb( color );
+
+		// Pixel format
+		status |= ili9488_driver_select_pixel_format( &rgb, 1U );
+
+		ili9488_driver_get_angle( angle_s, &angle[0] );
+		ili9488_driver_get_angle( angle_e, &angle[1] );
+
+		// Pixel center inside radius r when distance^2 <= r^2 + r
+		outer = ((uint32_t) radius * ( radius + 1U ));
+		inner = ( radius - (int32_t) width );
+		inner = (( inner >= 0 ) ? ( inner * ( inner + 1 )) : ( -1 ));
+
+		ili9488_driver_get_arc_area( page, col, radius, width, angle_s, angle_e, &area_page, &area_col, &area_page_size, &area_col_size );
+		page_e = ( area_page + area_page_size );
+
+		// Only pages of render target
+		if ( NULL != g_target.p_buf )
+		{
+			area_page = (( area_page > g_target.page ) ? ( area_page ) : ( g_target.page ));
+			page_e = (( page_e < ( g_target.page + g_target.page_size )) ? ( page_e ) : ( g_target.page + g_target.page_size ));
+		}
+
+		for ( ; area_page < page_e; area_page++ )
+		{
+			d_page = ((int32_t) area_page - page );
+			ext_o = (int32_t) ili9488_driver_sqrt( outer - (uint32_t)( d_page * d_page ));
+			ext_i = (( inner >= ( d_page * d_page )) ? ((int32_t) ili9488_driver_sqrt( inner - ( d_page * d_page ))) : ( -1 ));
+
+			// Ring crosses page in two segments, or one when hole does not reach page
+			for ( seg = 0; seg < (( ext_i >= 0 ) ? ( 2 ) : ( 1 )); seg++ )
+			{
+				seg_s = (( 0 == seg ) ? ( -ext_o ) : ( ext_i + 1 ));
+				seg_e = ((( 0 == seg ) && ( ext_i >= 0 )) ? ( -ext_i - 1 ) : ( ext_o ));
+
+				seg_s = (( seg_s > ((int32_t) area_col - col )) ? ( seg_s ) : ((int32_t) area_col - col ));
+				seg_e = (( seg_e < ((int32_t) area_col + area_col_size - 1 - col )) ? ( seg_e ) : ((int32_t) area_col + area_col_size - 1 - col ));
+				run_s = seg_s;
+
+				for ( d_col = seg_s; d_col <= ( seg_e + 1 ); d_col++ )
+				{
+					is_in = false;
+
+					if ( d_col <= seg_e )
+					{
+						is_in = ili9488_driver_is_after_angle( d_page, d_col, &angle[0] );
+
+						// Wrapped arc is after start or before end
+						if ( angle_s <= angle_e )
+						{
+							is_in = (( true == is_in ) && ( false == ili9488_driver_is_after_angle( d_page, d_col, &angle[1] )));
+						}
+						else
+						{
+							is_in = (( true == is_in ) || ( false == ili9488_driver_is_after_angle( d_page, d_col, &angle[1] )));
+						}
+					}
+
+					// Write run of pixels
+					if ( false == is_in )
+					{
+						if ( d_col > run_s )
+						{
+							status |= ili9488_driver_write_rect( area_page, ( col + run_s ), 1U, ( d_col - run_s ), &rgb );
+						}
+
+						run_s = ( d_col + 1 );
+					}
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get area of arc
+*
+*	Area covers ends of arc and points of outer edge on
+*	page and column axes inside arc, with one pixel margin
+*	for rounding of sine table.
+*
+*	param: 		page 		- Center page
+*	param: 		col 		- Center column
+*	param: 		radius 		- Outer radius
+*	param: 		width 		- Width of ring, radius + 1 for pie
+*	param: 		angle_s 	- Start angle
+*	param: 		angle_e 	- End angle
+*	param: 		p_page 		- Pointer to start page of area
+*	param: 		p_col 		- Pointer to start column of area
+*	param: 		p_page_size - Pointer to page size of area, 0 for empty arc
+*	param: 		p_col_size 	- Pointer to column size of area
+*	return:		void
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_driver_get_arc_area(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, uint16_t * const p_page, uint16_t * const p_col, uint16_t * const p_page_size, uint16_t * const p_col_size)
+{
+	int32_t min[2] = { INT16_MAX, INT16_MAX };
+	int32_t max[2] = { INT16_MIN, INT16_MIN };
+	int32_t inner;
+	uint16_t angle;
+
+	inner = ((( radius - (int32_t) width ) >= 0 ) ? ( radius - (int32_t) width ) : ( 0 ));
+
+	if ( angle_s != angle_e )
+	{
+		ili9488_driver_add_arc_point( radius, angle_s, min, max );
+		ili9488_driver_add_arc_point( radius, angle_e, min, max );
+		ili9488_driver_add_arc_point( inner, angle_s, min, max );
+		ili9488_driver_add_arc_point( inner, angle_e, min, max );
+
+		// Axes inside arc
+		for ( angle = 0U; angle < 360U; angle += 90U )
+		{
+			if 	(	(( angle_s <= angle_e ) && ( angle >= angle_s ) && ( angle < angle_e ))
+				||	(( angle_s > angle_e ) && (( angle >= angle_s ) || ( angle < angle_e ))))
+			{
+				ili9488_driver_add_arc_point( radius, angle, min, max );
+			}
+		}
+
+		min[0] = ((( min[0] - 1 ) > -(int32_t) radius ) ? ( min[0] - 1 ) : ( -(int32_t) radius ));
+		min[1] = ((( min[1] - 1 ) > -(int32_t) radius ) ? ( min[1] - 1 ) : ( -(int32_t) radius ));
+		max[0] = ((( max[0] + 1 ) < (int32_t) radius ) ? ( max[0] + 1 ) : ( radius ));
+		max[1] = ((( max[1] + 1 ) < (int32_t) radius ) ? ( max[1] + 1 ) : ( radius ));
+
+		*p_page = ( page + min[0] );
+		*p_col = ( col + min[1] );
+		*p_page_size = (( max[0] - min[0] ) + 1 );
+		*p_col_size = (( max[1] - min[1] ) + 1 );
+	}
+	else
+	{
+		*p_page = page;
+		*p_col = col;
+		*p_page_size = 0U;
+		*p_col_size = 0U;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get boundary angle of arc
+*
+*	param: 		angle 	- Angle in degrees, 0 to 360
+*	param: 		p_angle - Pointer to boundary angle
+*	return:		void
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_get_angle(const uint16_t angle, ili9488_angle_t * const p_angle)
+{
+	const uint16_t deg = ( angle % 90U );
+
+	if ( angle >= 360U )
+	{
+		p_angle -> oct = 8;
+	}
+	else
+	{
+		p_angle -> oct = (( 2U * ( angle / 90U )) + (( deg >= 45U ) ? ( 1U ) : ( 0U )));
+	}
+
+	p_angle -> cos = g_sin_table[ 90U - deg ];
+	p_angle -> sin = g_sin_table[ deg ];
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Is pixel direction at or after angle
+*
+*	Pixel is rotated into first quadrant. Different octants
+*	are ordered without multiplication, in the same octant
+*	cross product with boundary direction decides. Center
+*	pixel is at angle 0.
+*
+*	param: 		d_page 	- Page distance from center
+*	param: 		d_col 	- Column distance from center
+*	param: 		p_angle - Pointer to boundary angle
+*	return:		True when at or after angle
+*/
+//////////////////////////////////////////////////////////////
+static bool ili9488_driver_is_after_angle(const int32_t d_page, const int32_t d_col, const ili9488_angle_t * const p_angle)
+{
+	int32_t quad;
+	int32_t u;
+	int32_t v;
+	int32_t oct;
+	bool is_after;
+
+	if (( d_page > 0 ) && ( d_col >= 0 ))
+	{
+		quad = 0;
+		u = d_page;
+		v = d_col;
+	}
+	else if (( d_page <= 0 ) && ( d_col > 0 ))
+	{
+		quad = 1;
+		u = d_col;
+		v = -d_page;
+	}
+	else if (( d_page < 0 ) && ( d_col <= 0 ))
+	{
+		quad = 2;
+		u = -d_page;
+		v = -d_col;
+	}
+	else if ( d_col < 0 )
+	{
+		quad = 3;
+		u = -d_col;
+		v = d_page;
+	}
+	else
+	{
+		// Center
+		quad = 0;
+		u = 1;
+		v = 0;
+	}
+
+	oct = (( 2 * quad ) + (( v >= u ) ? ( 1 ) : ( 0 )));
+
+	if ( oct != p_angle -> oct )
+	{
+		is_after = ( oct > p_angle -> oct );
+	}
+	else
+	{
+		is_after = ((( v * p_angle -> cos ) - ( u * p_angle -> sin )) >= 0 );
+	}
+
+	return is_after;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add point of arc to area
+*
+*	param: 		radius 	- Distance from center
+*	param: 		angle 	- Angle in degrees, 0 to 360
+*	param: 		p_min 	- Pointer to minimum page and column
+*	param: 		p_max 	- Pointer to maximum page and column
+*	return:		void
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_add_arc_point(const int32_t radius, const uint16_t angle, int32_t * const p_min, int32_t * const p_max)
+{
+	const uint16_t deg = ( angle % 90U );
+	const int32_t u = (( radius * g_sin_table[ 90U - deg ] ) / 32768 );
+	const int32_t v = (( radius * g_sin_table[ deg ] ) / 32768 );
+	int32_t d[2];
+
+	// Rotate back from first quadrant
+	switch (( angle / 90U ) % 4U )
+	{
+		case 0:
+			d[0] = u;
+			d[1] = v;
+			break;
+
+		case 1:
+			d[0] = -v;
+			d[1] = u;
+			break;
+
+		case 2:
+			d[0] = -u;
+			d[1] = -v;
+			break;
+
+		default:
+			d[0] = v;
+			d[1] = -u;
+			break;
+	}
+
+	p_min[0] = (( d[0] < p_min[0] ) ? ( d[0] ) : ( p_min[0] ));
+	p_min[1] = (( d[1] < p_min[1] ) ? ( d[1] ) : ( p_min[1] ));
+	p_max[0] = (( d[0] > p_max[0] ) ? ( d[0] ) : ( p_max[0] ));
+	p_max[1] = (( d[1] > p_max[1] ) ? ( d[1] ) : ( p_max[1] ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Integer square root
+*
+*	param: 		value - Value
+*	return:		Largest root whose square is not above value
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t ili9488_driver_sqrt(const uint32_t value)
+{
+	uint32_t rem = value;
+	uint32_t root = 0U;
+	uint32_t bit = ( 1UL << 30U );
+
+	while ( bit > rem )
+	{
+		bit >>= 2U;
+	}
+
+	while ( 0U != bit )
+	{
+		if ( rem >= ( root + bit ))
+		{
+			rem -= ( root + bit );
+			root = (( root >> 1U ) + bit );
+		}
+		else
+		{
+			root >>= 1U;
+		}
+
+		bit >>= 2U;
+	}
+
+	return root;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill rounded rectangle
+*
+*	Border and interior are written in single pass, each
+*	pixel exactly once. Without fill only border is written.
+*	Radius 0 gives simple rectangle.
+*
+*	param: 		page 			- Start page
+*	param: 		col 			- Start column
+*	param: 		page_size 		- Size of page
+*	param: 		col_size 		- Size of column
+*	param: 		radius 			- Radius of corners
+*	param: 		border_width 	- Width of border, 0 for no border
+*	param: 		fill_en 		- Fill interior
+*	param: 		fill_color 		- Color of interior
+*	param: 		border_color 	- Color of border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_round_rectangle(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_rgb_t rgb[2];
+
+	// Check limits
+	if 	(	(( col + col_size ) > g_col_size )
+		||	(( page + page_size ) > g_page_size )
+		||	(( 2U * radius ) >= col_size )
+		||	(( 2U * radius ) >= page_size ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling rounded rectangle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb[0] = ili9488_driver_convert_color_to_rgb( fill_color );
+		rgb[1] = ili9488_driver_convert_color_to_rgb( border_color );
+
+		// Pixel format
+		status |= ili9488_driver_select_shape_format( rgb, border_width, fill_en );
+
+		// Write rectangle
+		status |= ili9488_driver_write_round_rect( page, col, page_size, col_size, radius, border_width, fill_en, rgb );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill circle with border
+*
+*	Border ring and interior are written in single pass,
+*	each pixel exactly once. Without fill only border
+*	ring is written.
+*
+*	param: 		page 			- Center page
+*	param: 		col 			- Center column
+*	param: 		radius 			- Radius of circle
+*	param: 		border_width 	- Width of border
+*	param: 		fill_en 		- Fill interior
+*	param: 		fill_color 		- Color of interior
+*	param: 		border_color 	- Color of border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_fill_bordered_circle(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_rgb_t rgb[2];
+
+	// Check limits
+	if 	(	(( col + radius ) > g_col_size )
+		||	(( page + radius ) > g_page_size )
+		||	(( col - radius ) < 0 )
+		||	(( page - radius ) < 0 ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Convert color
+		rgb[0] = ili9488_driver_convert_color_to_rgb( fill_color );
+		rgb[1] = ili9488_driver_convert_color_to_rgb( border_color );
+
+		// Pixel format
+		status |= ili9488_driver_select_shape_format( rgb, border_width, fill_en );
+
+		// Circle is rounded square with radius of half its size
+		status |= ili9488_driver_write_round_rect( page - radius, col - radius, ( 2U * radius ) + 1U, ( 2U * radius ) + 1U, radius, border_width, fill_en, rgb );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Select pixel format for shape with border
+*
+*	Only colors that will actually be written are taken
+*	into account.
+*
+*	param: 		p_rgb 			- Color of interior and border
+*	param: 		border_width 	- Width of border
+*	param: 		fill_en 		- Fill interior
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_select_shape_format(const ili9488_rgb_t * const p_rgb, const uint8_t border_width, const bool fill_en)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	if ( 0U == border_width )
+	{
+		status |= ili9488_driver_select_pixel_format( &p_rgb[0], 1U );
+	}
+	else if ( true == fill_en )
+	{
+		status |= ili9488_driver_select_pixel_format( p_rgb, 2U );
+	}
+	else
+	{
+		status |= ili9488_driver_select_pixel_format( &p_rgb[1], 1U );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write rounded rectangle
+*
+*	Rectangle is rasterized column by column. Neighbour
+*	columns with same outer and inner edge are merged and
+*	written as border, interior and border span. Limits
+*	are not checked.
+*
+*	param: 		page 			- Start page
+*	param: 		col 			- Start column
+*	param: 		page_size 		- Size of page
+*	param: 		col_size 		- Size of column
+*	param: 		radius 			- Radius of corners
+*	param: 		border_width 	- Width of border
+*	param: 		fill_en 		- Fill interior
+*	param: 		p_rgb 			- Color of interior and border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_round_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint8_t inner_radius;
+	uint16_t c;
+	uint16_t dist;
+	uint16_t outer;
+	uint16_t inner;
+	uint16_t run_start;
+	uint16_t run_outer;
+	uint16_t run_inner;
+
+	// Corners of outer and inner edge
+	inner_radius = ( radius > border_width ) ? ((uint8_t)( radius - border_width )) : 0U;
+
+	ili9488_driver_get_circle_extent( radius, g_corner_ext[0] );
+	ili9488_driver_get_circle_extent( inner_radius, g_corner_ext[1] );
+
+	run_start = 0U;
+	run_outer = 0U;
+	run_inner = 0U;
+	outer = 0U;
+	inner = 0U;
+
+	for ( c = 0U; c <= col_size; c++ )
+	{
+		if ( c < col_size )
+		{
+			// Distance from nearest edge
+			dist = ( c < ( col_size - c )) ? c : ( col_size - 1U - c );
+
+			// Outer edge
+			outer = 0U;
+
+			if ( dist < radius )
+			{
+				outer = radius - g_corner_ext[0][ radius - dist ];
+			}
+
+			// Inner edge
+			inner = ILI9488_DRIVER_NO_INTERIOR;
+
+			if ( dist >= border_width )
+			{
+				dist -= border_width;
+				inner = border_width;
+
+				if ( dist < inner_radius )
+				{
+					inner += inner_radius - g_corner_ext[1][ inner_radius - dist ];
+				}
+
+				if (( 2U * inner ) >= page_size )
+				{
+					inner = ILI9488_DRIVER_NO_INTERIOR;
+				}
+			}
+		}
+
+		// Write finished run of columns
+		if ( c > 0U )
+		{
+			if 	(	( c == col_size )
+				||	( outer != run_outer )
+				||	( inner != run_inner ))
+			{
+				status |= ili9488_driver_write_round_rect_span( page, col + run_start, page_size, c - run_start, run_outer, run_inner, fill_en, p_rgb );
+				run_start = c;
+			}
+		}
+
+		run_outer = outer;
+		run_inner = inner;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write span of rounded rectangle
+*
+*	param: 		page 		- Start page of rectangle
+*	param: 		col 		- Start column of span
+*	param: 		page_size 	- Size of page of rectangle
+*	param: 		col_size 	- Size of column of span
+*	param: 		outer 		- Distance of outer edge from page edge
+*	param: 		inner 		- Distance of inner edge from page edge
+*	param: 		fill_en 	- Write interior
+*	param: 		p_rgb 		- Color of interior and border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_write_round_rect_span(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint16_t outer, const uint16_t inner, const bool fill_en, const ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Only border
+	if ( ILI9488_DRIVER_NO_INTERIOR == inner )
+	{
+		status |= ili9488_driver_write_rect( page + outer, col, page_size - ( 2U * outer ), col_size, &p_rgb[1] );
+	}
+	else
+	{
+		status |= ili9488_driver_write_rect( page + outer, col, inner - outer, col_size, &p_rgb[1] );
+
+		if ( true == fill_en )
+		{
+			status |= ili9488_driver_write_rect( page + inner, col, page_size - ( 2U * inner ), col_size, &p_rgb[0] );
+		}
+
+		status |= ili9488_driver_write_rect( page + page_size - inner, col, inner - outer, col_size, &p_rgb[1] );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get extent of circle
+*
+*	Same midpoint algorithm as for filled circle, extent
+*	is stored for every distance from center.
+*
+*	param: 		radius 	- Radius of circle
+*	param: 		p_ext 	- Extent for distance 0 to radius
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_get_circle_extent(const uint8_t radius, uint8_t * const p_ext)
+{
+	int32_t  D;
+	int32_t  CurX;
+	int32_t  CurY;
+
+	D = 3 - ( radius << 1 );
+	CurX = 0;
+	CurY = radius;
+
+	while ( CurX <= CurY )
+	{
+		p_ext[CurX] = (uint8_t) CurY;
+
+		if (D < 0)
+		{
+			D += (CurX << 2) + 6;
+		}
+		else
+		{
+			D += ((CurX - CurY) << 2) + 10;
+
+			if ( CurX < CurY )
+			{
+				p_ext[CurY] = (uint8_t) CurX;
+			}
+
+			CurY--;
+		}
+
+		CurX++;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set circle
+*
+*		NOTE: This function is copied from github.
+*
+*		Link: https://github.com/RobertoBenjami/stm32_graphics_display_drivers/blob/master/Drivers/stm32_adafruit_lcd.c
+*
+*	param: 		page 	- Start page
+*	param: 		col 	- Start column
+*	param: 		radius 	- Radius of circle
+*	param: 		color 	- Color of circle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	int32_t  D;
+	uint32_t  CurX;
+	uint32_t  CurY;
+
+	// Check limits
+	if 	(	(( col + radius ) > g_col_size )
+		||	(( page + radius ) > g_page_size )
+		||	(( col - radius ) < 0 )
+		||	(( page - radius ) < 0 ))
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		D = 3 - (radius << 1);
+		CurX = 0;
+		CurY = radius;
+
+		while (CurX <= CurY)
+		{
+			status |= ili9488_driver_set_pixel(( page + CurX ), ( col - CurY ), color );
+			status |= ili9488_driver_set_pixel(( page - CurX ), ( col - CurY ), color );
+			status |= ili9488_driver_set_pixel(( page + CurY ), ( col - CurX ), color );
+			status |= ili9488_driver_set_pixel(( page - CurY ), ( col - CurX ), color );
+			status |= ili9488_driver_set_pixel(( page + CurX ), ( col + CurY ), color );
+			status |= ili9488_driver_set_pixel(( page - CurX ), ( col + CurY ), color );
+			status |= ili9488_driver_set_pixel(( page + CurY ), ( col + CurX ), color );
+			status |= ili9488_driver_set_pixel(( page - CurY ), ( col + CurX ), color );
+
+			if (D < 0)
+			{
+				D += (CurX << 2) + 6;
+			}
+			else
+			{
+				D += ((CurX - CurY) << 2) + 10;
+				CurY--;
+			}
+
+			CurX++;
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set character
+*
+*	param: 		ch - Character to display
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_char(const uint8_t ch, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt)
+{
+	return ili9488_driver_set_chars((const char*) &ch, 1U, page, col, fg_color, bg_color, font_opt );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set string
+*
+*	param: 		str - Pointer to string
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_string(const char *str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt)
+{
+	return ili9488_driver_set_chars( str, strlen( str ), page, col, fg_color, bg_color, font_opt );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set row of characters
+*
+*	Characters are placed next to each other, therefore
+*	whole row is single strip of font height. Strip is
+*	written through one address window with one memory
+*	write, page by page with column running fastest, as
+*	runs of fg/bg pixels. Characters that would not fit
+*	on display are not drawn.
+*
+*	With glyph cache enabled already encoded glyphs are
+*	taken from cache and missing ones are encoded into it.
+*
+*	Compiled fonts are drawn by "ili9488_driver_set_glyphs".
+*
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_driver_set_chars(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt)
+{
+	ili9488_status_t status = eILI9488_OK;
+	const ili9488_font_t * p_font;
+	const uint8_t * p_glyph;
+	uint32_t c;
+	uint32_t fit;
+	uint8_t i;
+	uint8_t j;
+	uint8_t mask;
+	uint8_t line_size_byte;
+	uint16_t char_lut_size;
+	uint16_t page_s;
+	ili9488_rgb_t rgb[2];
+	bool run_fg;
+	bool pix_fg;
+	uint32_t run;
+	bool is_cached;
+
+	#if ( ILI9488_GLYPH_CACHE_EN )
+		ili9488_glyph_key_t key;
+		const uint8_t * p_wire;
+		uint8_t * p_entry;
+		uint32_t wire_size;
+		bool is_cacheable;
+	#endif
+
+	// Get font data
+	p_font = ili9488_font_get( font_opt );
+
+	// Compiled font
+	if (( NULL != p_font ) && ( NULL != p_font -> p_glyph ))
+	{
+		status = ili9488_driver_set_glyphs( p_chars, num, page, col, fg_color, bg_color, p_font );
+	}
+
+	// Check pinter
+	else if (( NULL != p_font ) && ( NULL != p_font -> p_font ))
+	{
+		// Convert colors
+		rgb[0] = ili9488_driver_convert_color_to_rgb( fg_color );
+		rgb[1] = ili9488_driver_convert_color_to_rgb( bg_color );
+
+		// Pixel format for both colors
+		status |= ili9488_driver_select_pixel_format( rgb, 2U );
+
+		// Calculate various font table info
+		line_size_byte = (( p_font -> width / 8U ) + 1U );
+		char_lut_size = ( p_font -> height * line_size_byte );
+
+		// Strip start
+		// NOTE: Font width is multiply by two for offset, as char start to draw from right to left
+		page_s = ( page + ( 2U * p_font -> width ) - ( 8U * line_size_byte ));
+
+		// Number of characters that fit on display
+		fit = num;
+
+		if (( page_s + ( num * p_font -> width )) > g_page_size )
+		{
+			fit = (( page_s < g_page_size ) ? (((uint32_t) g_page_size - page_s ) / p_font -> width ) : ( 0U ));
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "String out of display..." );
+		}
+
+		if ( fit > 0U )
+		{
+			// Strip window
+			status |= ili9488_driver_set_cursor( col, col + p_font -> height - 1U, page_s, page_s + ( fit * p_font -> width ) - 1U );
+			status |= ili9488_driver_gram_start();
+
+			run_fg = false;
+			run = 0;
+
+			#if ( ILI9488_GLYPH_CACHE_EN )
+				key.font_opt = font_opt;
+				key.fg_color = fg_color;
+				key.bg_color = bg_color;
+				key.format = ili9488_low_if_get_pixel_format();
+
+				// In 3-bit format glyph must end on byte boundary
+				is_cacheable = 	(	( eILI9488_PIXEL_FORMAT_3_BIT != key.format )
+								||	( 0U == (( p_font -> width * p_font -> height ) % 2U )));
+
+				// Encoded glyphs are for GRAM only
+				if ( NULL != g_target.p_buf )
+				{
+					is_cacheable = false;
+				}
+			#endif
+
+			// Every character
+			for ( c = 0; c < fit; c++ )
+			{
+				p_glyph = &p_font -> p_font[ char_lut_size * ((uint8_t) p_chars[c] - 32U ) ];
+				is_cached = false;
+
+				#if ( ILI9488_GLYPH_CACHE_EN )
+					if ( true == is_cacheable )
+					{
+						key.ch = (uint8_t) p_chars[c];
+						p_wire = ili9488_glyph_cache_get( &key, &wire_size );
+
+						// Encode glyph into cache
+						if ( NULL == p_wire )
+						{
+							wire_size = ili9488_low_if_gram_bytes( p_font -> width * p_font -> height );
+							p_entry = ili9488_glyph_cache_alloc( &key, wire_size );
+
+							if ( NULL != p_entry )
+							{
+								ili9488_driver_encode_glyph( p_glyph, p_font, rgb, p_entry );
+								p_wire = p_entry;
+							}
+						}
+
+						if ( NULL != p_wire )
+						{
+							// Put pending run first
+							if ( run > 0U )
+							{
+								status |= ili9488_driver_gram_put(( run_fg ? &rgb[0] : &rgb[1] ), run );
+								run = 0;
+							}
+
+							status |= ili9488_low_if_gram_put_raw( p_wire, wire_size );
+							is_cached = true;
+						}
+					}
+				#endif
+
+				// Every page, leftmost glyph pixel is MSB
+				for ( j = 0; ( j < p_font -> width ) && ( false == is_cached ); j++ )
+				{
+					mask = ( 0x80U >> ( j % 8U ));
+
+					// Every column
+					for ( i = 0; i < p_font -> height; i++ )
+					{
+						pix_fg = ( 0U != ( p_glyph[ ( i * line_size_byte ) + ( j / 8U ) ] & mask ));
+
+						// Color changed, put run of pixels
+						if (( pix_fg != run_fg ) && ( run > 0U ))
+						{
+							status |= ili9488_driver_gram_put(( run_fg ? &rgb[0] : &rgb[1] ), run );
+							run = 0;
+						}
+
+						run_fg = pix_fg;
+						run++;
+					}
+				}
+			}
+
+			if ( run > 0U )
+			{
+				status |= ili9488_driver_gram_put(( run_fg ? &rgb[0] : &rgb[1] ), run );
+			}
+
+			status |= ili9488_driver_gram_end();
+		}
+	}
+
+	// No font
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set row of characters of compiled font
+*
+*	Same strip as in "ili9488_driver_set_chars", but it
+*	starts exactly at given page and characters are placed
+*	by their advance and kerning. Strip is walked page by
+*	page and glyphs are read while their bounding box is
+*	over current page, so overlapping glyphs are merged by
+*	higher level. Every level of glyph pixels is blended
+*	from background to foreground color once per row and
+*	pixels are put as runs of same level. Pixels outside of
+*	glyph bounding boxes are background. Glyph cache is not
+*	used.
+*
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		p_font - Pointer to compiled font
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_driver_set_glyphs(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_t * const p_font)
+{
+	ili9488_status_t status = eILI9488_OK;
+	const ili9488_glyph_t * p_glyph;
+	ili9488_glyph_reader_t reader[ ILI9488_DRIVER_GLYPH_OVERLAP ];
+	uint32_t glyph_page_e[ ILI9488_DRIVER_GLYPH_OVERLAP ];
+	uint8_t glyph_col_s[ ILI9488_DRIVER_GLYPH_OVERLAP ];
+	uint8_t glyph_col_e[ ILI9488_DRIVER_GLYPH_OVERLAP ];
+	ili9488_rgb_t rgb[16];
+	ili9488_rgb_t fg;
+	ili9488_rgb_t bg;
+	uint32_t levels;
+	uint32_t width;
+	uint32_t fit;
+	uint32_t pen;
+	uint32_t skip;
+	uint32_t run;
+	uint32_t c;
+	uint32_t n;
+	uint32_t j;
+	uint8_t run_level;
+	uint8_t level;
+	uint8_t read;
+	uint8_t i;
+
+	if (( 1U != p_font -> bpp ) && ( 2U != p_font -> bpp ) && ( 4U != p_font -> bpp ))
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Invalid font bits per pixel..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Blend every level
+		fg = ili9488_driver_convert_color_to_rgb( fg_color );
+		bg = ili9488_driver_convert_color_to_rgb( bg_color );
+		levels = ( 1U << p_font -> bpp );
+
+		for ( c = 0; c < levels; c++ )
+		{
+			rgb[c].R = ( bg.R + ((((int32_t) fg.R - bg.R ) * (int32_t) c ) / (int32_t)( levels - 1U )));
+			rgb[c].G = ( bg.G + ((((int32_t) fg.G - bg.G ) * (int32_t) c ) / (int32_t)( levels - 1U )));
+			rgb[c].B = ( bg.B + ((((int32_t) fg.B - bg.B ) * (int32_t) c ) / (int32_t)( levels - 1U )));
+		}
+
+		status |= ili9488_driver_select_pixel_format( rgb, levels );
+
+		// Number of characters that fit on display
+		fit = 0;
+		width = 0;
+
+		if (( page < g_page_size ) && (( col + p_font -> height ) <= g_col_size ))
+		{
+			fit = ili9488_font_fit_string( p_font, p_chars, num, ( g_page_size - page ), &width );
+		}
+
+		if ( fit < num )
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "String out of display..." );
+		}
+
+		if ( width > 0U )
+		{
+			// Strip window
+			status |= ili9488_driver_set_cursor( col, col + p_font -> height - 1U, page, page + width - 1U );
+			status |= ili9488_driver_gram_start();
+
+			for ( n = 0; n < ILI9488_DRIVER_GLYPH_OVERLAP; n++ )
+			{
+				glyph_page_e[n] = 0;
+			}
+
+			run_level = 0;
+			run = 0;
+			pen = 0;
+			c = 0;
+
+			// Every page of strip
+			for ( j = 0; j < width; j++ )
+			{
+				// Start glyphs reaching current page, in order
+				while ( c < fit )
+				{
+					p_glyph = ili9488_font_get_glyph( p_font, p_chars[c] );
+
+					if (( NULL != p_glyph ) && ( 0U != p_glyph -> width ) && ( 0U != p_glyph -> height ))
+					{
+						if (( pen + p_glyph -> page_ofs ) > j )
+						{
+							break;
+						}
+
+						for ( n = 0; n < ILI9488_DRIVER_GLYPH_OVERLAP; n++ )
+						{
+							if ( glyph_page_e[n] <= j )
+							{
+								break;
+							}
+						}
+
+						// Wait for free slot
+						if ( n >= ILI9488_DRIVER_GLYPH_OVERLAP )
+						{
+							break;
+						}
+
+						ili9488_font_glyph_start( p_font, p_glyph, &reader[n] );
+						glyph_page_e[n] = ( pen + p_glyph -> page_ofs + p_glyph -> width );
+						glyph_col_s[n] = p_glyph -> col_ofs;
+						glyph_col_e[n] = ( p_glyph -> col_ofs + p_glyph -> height );
+
+						// Drop pages already passed
+						skip = ((( glyph_page_e[n] < j ) ? ( glyph_page_e[n] ) : ( j )) - ( pen + p_glyph -> page_ofs ));
+						skip *= p_glyph -> height;
+
+						while ( skip > 0U )
+						{
+							(void) ili9488_font_glyph_read( &reader[n] );
+							skip--;
+						}
+					}
+
+					pen += ili9488_font_get_advance( p_font, p_chars[c], ((( c + 1U ) < fit ) ? ( p_chars[ c + 1U ] ) : ( '\0' )));
+					c++;
+				}
+
+				// Every column of strip
+				for ( i = 0; i < p_font -> height; i++ )
+				{
+					level = 0;
+
+					for ( n = 0; n < ILI9488_DRIVER_GLYPH_OVERLAP; n++ )
+					{
+						if (( glyph_page_e[n] > j ) && ( i >= glyph_col_s[n] ) && ( i < glyph_col_e[n] ))
+						{
+							read = ili9488_font_glyph_read( &reader[n] );
+							level = (( read > level ) ? ( read ) : ( level ));
+						}
+					}
+
+					// Level changed, put run of pixels
+					if (( level != run_level ) && ( run > 0U ))
+					{
+						status |= ili9488_driver_gram_put( &rgb[ run_level ], run );
+						run = 0;
+					}
+
+					run_level = level;
+					run++;
+				}
+			}
+
+			if ( run > 0U )
+			{
+				status |= ili9488_driver_gram_put( &rgb[ run_level ], run );
+			}
+
+			status |= ili9488_driver_gram_end();
+		}
+	}
+
+	return status;
+}
+
+
+#if ( ILI9488_AA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased line
+	*
+	*	Line is walked along its longer axis with its position
+	*	on shorter axis in 1/256 of pixel. Coverage is split
+	*	between two neighbour pixels by distance (Wu). Steps
+	*	with same pair of pixels are written as one window of
+	*	two lines, exact steps as one line.
+	*
+	*	param: 		page_s 		- Start page
+	*	param: 		col_s 		- Start column
+	*	param: 		page_e 		- End page
+	*	param: 		col_e 		- End column
+	*	param: 		color 		- Color of line
+	*	param: 		bg_color 	- Background color
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_driver_draw_line_aa(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		uint8_t frac[ ILI9488_DRIVER_AA_RUN ];
+		bool is_page_major;
+		int32_t major_s;
+		int32_t major_e;
+		int32_t minor_s;
+		int32_t d_minor;
+		int32_t run_major;
+		int32_t run_minor;
+		int32_t minor;
+		int32_t i;
+		uint32_t run;
+		uint32_t step;
+		uint32_t offset;
+
+		// Check limits
+		if 	(	( page_s >= g_page_size )
+			||	( page_e >= g_page_size )
+			||	( col_s >= g_col_size )
+			||	( col_e >= g_col_size ))
+		{
+			status = eILI9488_ERROR;
+			ILI9488_DBG_PRINT( "Drawing line invalid spacing..." );
+			ILI9488_ASSERT( 0 );
+		}
+		else
+		{
+			status |= ili9488_driver_aa_begin( color, bg_color );
+
+			is_page_major = ((( page_e > page_s ) ? ( page_e - page_s ) : ( page_s - page_e )) >= (( col_e > col_s ) ? ( col_e - col_s ) : ( col_s - col_e )));
+
+			// Walk towards increasing major axis
+			major_s = ( is_page_major ? page_s : col_s );
+			major_e = ( is_page_major ? page_e : col_e );
+			minor_s = ( is_page_major ? col_s : page_s );
+			d_minor = (( is_page_major ? col_e : page_e ) - minor_s );
+
+			if ( major_e < major_s )
+			{
+				minor_s += d_minor;
+				d_minor = -d_minor;
+				major_s = major_e;
+				major_e = ( is_page_major ? page_s : col_s );
+			}
+
+			step = ( major_e - major_s );
+			run = 0;
+			run_major = major_s;
+			run_minor = minor_s;
+
+			for ( i = 0; i <= (int32_t) step; i++ )
+			{
+				// Minor position in 1/256 of pixel
+				offset = (( step > 0U ) ? (((( i * (uint32_t)(( d_minor >= 0 ) ? ( d_minor ) : ( -d_minor ))) << 8U ) + ( step / 2U )) / step ) : ( 0U ));
+				minor = (( minor_s << 8 ) + (( d_minor >= 0 ) ? ((int32_t) offset ) : ( -(int32_t) offset )));
+
+				// Write run when pixel pair changes
+				if 	(	( run > 0U )
+					&&	(	(( minor >> 8 ) != run_minor )
+						||	(( 0U == ( minor & 0xFF )) != ( 0U == frac[0] ))
+						||	(( ILI9488_DRIVER_AA_RUN == run ) && ( 0U != frac[0] ))))
+				{
+					status |= ili9488_driver_write_aa_run( is_page_major, run_major, run_minor, frac, run );
+					run = 0;
+				}
+
+				if ( 0U == run )
+				{
+					run_major = ( major_s + i );
+					run_minor = ( minor >> 8 );
+				}
+
+				// Exact run is not limited, as all its pixels are covered fully
+				if ( run < ILI9488_DRIVER_AA_RUN )
+				{
+					frac[ run ] = ( minor & 0xFF );
+				}
+
+				run++;
+			}
+
+			status |= ili9488_driver_write_aa_run( is_page_major, run_major, run_minor, frac, run );
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Write run of anti-aliased line
+	*
+	*	Pixel on minor position gets coverage of 1 - fraction,
+	*	next one fraction. Without fraction only one line of
+	*	pixels is written and fractions are not needed.
+	*
+	*	param: 		is_page_major 	- Line is walked along pages
+	*	param: 		major 			- Start on major axis
+	*	param: 		minor 			- Position on minor axis
+	*	param: 		p_frac 			- Fraction of minor position of every step
+	*	param: 		num 			- Number of steps
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_write_aa_run(const bool is_page_major, const uint16_t major, const uint16_t minor, const uint8_t * const p_frac, const uint32_t num)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		const uint16_t width = (( 0U == p_frac[0] ) ? ( 1U ) : ( 2U ));
+		uint32_t i;
+
+		if ( 1U == width )
+		{
+			// Exact steps, one line of pixels
+			status |= ili9488_driver_aa_start(( is_page_major ? major : minor ), ( is_page_major ? minor : major ), ( is_page_major ? num : 1U ), ( is_page_major ? 1U : num ));
+			status |= ili9488_driver_aa_put( 255U, num );
+		}
+		else if ( true == is_page_major )
+		{
+			// Pair of pixels on every page
+			status |= ili9488_driver_aa_start( major, minor, num, width );
+
+			for ( i = 0; i < num; i++ )
+			{
+				status |= ili9488_driver_aa_put(( 255U - p_frac[i] ), 1U );
+
+				if ( 2U == width )
+				{
+					status |= ili9488_driver_aa_put( p_frac[i], 1U );
+				}
+			}
+		}
+		else
+		{
+			// Whole run on first page, then on second
+			status |= ili9488_driver_aa_start( minor, major, width, num );
+
+			for ( i = 0; i < num; i++ )
+			{
+				status |= ili9488_driver_aa_put(( 255U - p_frac[i] ), 1U );
+			}
+
+			for ( i = 0; ( i < num ) && ( 2U == width ); i++ )
+			{
+				status |= ili9488_driver_aa_put( p_frac[i], 1U );
+			}
+		}
+
+		status |= ili9488_driver_aa_end();
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased circle
+	*
+	*	Every page of circle is written with one window. Pixels
+	*	fully inside are put as one run, only edge pixels get
+	*	coverage from their distance to center.
+	*
+	*	param: 		page 		- Center page
+	*	param: 		col 		- Center column
+	*	param: 		radius 		- Radius of circle
+	*	param: 		fill_en 	- Fill interior, otherwise one pixel wide edge
+	*	param: 		color 		- Color of circle
+	*	param: 		bg_color 	- Background color
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_driver_draw_circle_aa(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		const int32_t r = radius;
+		int32_t d_page;
+		int32_t d_col;
+		int32_t ext_o;
+		int32_t ext_i;
+		int32_t seg;
+		int32_t seg_s;
+		int32_t seg_e;
+
+		// Check limits
+		if 	(	(( col + radius ) >= g_col_size )
+			||	(( page + radius ) >= g_page_size )
+			||	( col < radius )
+			||	( page < radius )
+			||	( 0U == radius ))
+		{
+			status = eILI9488_ERROR;
+			ILI9488_DBG_PRINT( "Filling circle invalid spacing..." );
+			ILI9488_ASSERT( 0 );
+		}
+		else
+		{
+			status |= ili9488_driver_aa_begin( color, bg_color );
+
+			for ( d_page = -r; d_page <= r; d_page++ )
+			{
+				if ( true == fill_en )
+				{
+					// Covered when closer than radius + 0.5, fully when closer than radius - 0.5
+					ext_o = (int32_t) ili9488_driver_sqrt(( r * r ) + r - ( d_page * d_page ));
+					ext_i = ((( r * r ) - r >= ( d_page * d_page )) ? ((int32_t) ili9488_driver_sqrt(( r * r ) - r - ( d_page * d_page ))) : ( -1 ));
+
+					status |= ili9488_driver_aa_start(( page + d_page ), ( col - ext_o ), 1U, (( 2 * ext_o ) + 1 ));
+
+					for ( d_col = -ext_o; d_col <= ext_o; d_col++ )
+					{
+						if (( d_col == -ext_i ) && ( ext_i >= 0 ))
+						{
+							status |= ili9488_driver_aa_put( 255U, (( 2 * ext_i ) + 1 ));
+							d_col = ext_i;
+						}
+						else
+						{
+							status |= ili9488_driver_aa_put( ili9488_driver_get_circle_cov( d_page, d_col, radius, true ), 1U );
+						}
+					}
+
+					status |= ili9488_driver_aa_end();
+				}
+				else
+				{
+					// Covered when closer than one pixel to radius
+					ext_o = (int32_t) ili9488_driver_sqrt(( r * r ) + ( 2 * r ) - ( d_page * d_page ));
+					ext_i = (((( r - 1 ) * ( r - 1 )) >= ( d_page * d_page )) ? ((int32_t) ili9488_driver_sqrt((( r - 1 ) * ( r - 1 )) - ( d_page * d_page )) + 1 ) : ( 0 ));
+
+					// Two segments, or one through center column
+					for ( seg = 0; seg < 2; seg++ )
+					{
+						seg_s = (( 0 == seg ) ? ( -ext_o ) : ( ext_i ));
+						seg_e = (( 0 == seg ) ? ((( 0 == ext_i ) ? ( ext_o ) : ( -ext_i ))) : ( ext_o ));
+
+						if ((( 0 == seg ) || ( 0 != ext_i )) && ( seg_s <= seg_e ))
+						{
+							status |= ili9488_driver_aa_start(( page + d_page ), ( col + seg_s ), 1U, (( seg_e - seg_s ) + 1 ));
+
+							for ( d_col = seg_s; d_col <= seg_e; d_col++ )
+							{
+								status |= ili9488_driver_aa_put( ili9488_driver_get_circle_cov( d_page, d_col, radius, false ), 1U );
+							}
+
+							status |= ili9488_driver_aa_end();
+						}
+					}
+				}
+			}
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Get coverage of circle pixel
+	*
+	*	Distance to center is taken in 1/64 of pixel.
+	*
+	*	param: 		d_page 	- Page distance from center
+	*	param: 		d_col 	- Column distance from center
+	*	param: 		radius 	- Radius of circle
+	*	param: 		fill_en - Filled circle, otherwise edge
+	*	return:		Coverage from 0 to 255
+	*/
+	//////////////////////////////////////////////////////////////
+	static uint8_t ili9488_driver_get_circle_cov(const int32_t d_page, const int32_t d_col, const uint16_t radius, const bool fill_en)
+	{
+		int32_t dist;
+		int32_t cov;
+
+		dist = (int32_t) ili9488_driver_sqrt((uint32_t)(( d_page * d_page ) + ( d_col * d_col )) << 12U );
+
+		if ( true == fill_en )
+		{
+			cov = ((( radius * 64 ) + 32 ) - dist );
+		}
+		else
+		{
+			cov = ( 64 - ((( dist - ( radius * 64 )) >= 0 ) ? ( dist - ( radius * 64 )) : (( radius * 64 ) - dist )));
+		}
+
+		cov = (( cov < 0 ) ? ( 0 ) : (( cov > 64 ) ? ( 64 ) : ( cov )));
+
+		return (uint8_t)(( cov * 255 ) / 64 );
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Set row of anti-aliased characters
+	*
+	*	Every 2x2 pixels of font are averaged into one pixel,
+	*	so text is half of font size, e.g. 12 pixels high for
+	*	font 24. Row is written through one address window
+	*	like "ili9488_driver_set_chars", but starts exactly at
+	*	given page.
+	*
+	*	param: 		p_chars - Pointer to characters
+	*	param: 		num - Number of characters
+	*	param: 		page - Start page
+	*	param: 		col - Start column
+	*	param: 		fg_color - Foreground color
+	*	param: 		bg_color - Background color
+	*	param: 		font_opt - Font of choise, drawn at half size
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_driver_set_chars_aa(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		const ili9488_font_t * p_font;
+		const uint8_t * p_glyph;
+		uint32_t c;
+		uint32_t fit;
+		uint8_t i;
+		uint8_t j;
+		uint8_t k;
+		uint8_t cnt;
+		uint8_t line_size_byte;
+		uint16_t char_lut_size;
+		uint16_t width;
+		uint16_t height;
+
+		// Get font data
+		p_font = ili9488_font_get( font_opt );
+
+		if (( NULL != p_font ) && ( NULL != p_font -> p_font ))
+		{
+			line_size_byte = (( p_font -> width / 8U ) + 1U );
+			char_lut_size = ( p_font -> height * line_size_byte );
+			width = (( p_font -> width + 1U ) / 2U );
+			height = (( p_font -> height + 1U ) / 2U );
+
+			// Number of characters that fit on display
+			fit = num;
+
+			if 	(	(( page + ( num * width )) > g_page_size )
+				||	(( col + height ) > g_col_size ))
+			{
+				fit = ((( page < g_page_size ) && (( col + height ) <= g_col_size )) ? (((uint32_t) g_page_size - page ) / width ) : ( 0U ));
+				status = eILI9488_ERROR;
+
+				ILI9488_DBG_PRINT( "String out of display..." );
+			}
+
+			if ( fit > 0U )
+			{
+				status |= ili9488_driver_aa_begin( fg_color, bg_color );
+				status |= ili9488_driver_aa_start( page, col, ( fit * width ), height );
+
+				for ( c = 0; c < fit; c++ )
+				{
+					p_glyph = &p_font -> p_font[ char_lut_size * ((uint8_t) p_chars[c] - 32U ) ];
+
+					// Every page, then every column of half size glyph
+					for ( j = 0; j < p_font -> width; j += 2U )
+					{
+						for ( i = 0; i < p_font -> height; i += 2U )
+						{
+							cnt = 0;
+
+							for ( k = 0; k < 4U; k++ )
+							{
+								if 	(	(( j + ( k % 2U )) < p_font -> width )
+									&&	(( i + ( k / 2U )) < p_font -> height )
+									&&	( 0U != ( p_glyph[ (( i + ( k / 2U )) * line_size_byte ) + (( j + ( k % 2U )) / 8U ) ] & ( 0x80U >> (( j + ( k % 2U )) % 8U )))))
+								{
+									cnt++;
+								}
+							}
+
+							status |= ili9488_driver_aa_put((( cnt * 255U ) / 4U ), 1U );
+						}
+					}
+				}
+
+				status |= ili9488_driver_aa_end();
+			}
+		}
+
+		// No font
+		else
+		{
+			status = eILI9488_ERROR;
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Begin anti-aliased drawing
+	*
+	*	Blend table from background to color is prepared and
+	*	pixel format selected for all of its colors.
+	*
+	*	param: 		color 		- Color
+	*	param: 		bg_color 	- Background color
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_aa_begin(const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_rgb_t fg;
+		ili9488_rgb_t bg;
+		uint32_t i;
+
+		fg = ili9488_driver_convert_color_to_rgb( color );
+		bg = ili9488_driver_convert_color_to_rgb( bg_color );
+
+		for ( i = 0; i <= ILI9488_AA_LEVELS; i++ )
+		{
+			g_aa.lut[i].R = ( bg.R + ((((int32_t) fg.R - bg.R ) * (int32_t) i ) / ILI9488_AA_LEVELS ));
+			g_aa.lut[i].G = ( bg.G + ((((int32_t) fg.G - bg.G ) * (int32_t) i ) / ILI9488_AA_LEVELS ));
+			g_aa.lut[i].B = ( bg.B + ((((int32_t) fg.B - bg.B ) * (int32_t) i ) / ILI9488_AA_LEVELS ));
+		}
+
+		return ili9488_driver_select_pixel_format( g_aa.lut, ( ILI9488_AA_LEVELS + 1U ));
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Start anti-aliased window
+	*
+	*	param: 		page 		- Start page
+	*	param: 		col 		- Start column
+	*	param: 		page_size 	- Size of page
+	*	param: 		col_size 	- Size of column
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_aa_start(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		g_aa.page = page;
+		g_aa.col = col;
+		g_aa.col_s = col;
+		g_aa.col_e = ( col + col_size - 1U );
+		g_aa.run = 0;
+
+		status |= ili9488_driver_set_cursor( col, ( col + col_size - 1U ), page, ( page + page_size - 1U ));
+		status |= ili9488_driver_gram_start();
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Put anti-aliased pixels
+	*
+	*	Coverage is mapped to blend table. In render target
+	*	pixel is blended with what is already there instead,
+	*	so background does not have to be known.
+	*
+	*	param: 		cov - Coverage from 0 to 255
+	*	param: 		num - Number of pixels
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_aa_put(const uint8_t cov, const uint32_t num)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		const ili9488_rgb_t * p_fg = &g_aa.lut[ ILI9488_AA_LEVELS ];
+		const ili9488_rgb_t * p_pix;
+		ili9488_rgb_t rgb;
+		uint32_t i;
+		uint32_t n;
+
+		for ( i = 0; i < num; i += n )
+		{
+			rgb = g_aa.lut[ (( cov * ILI9488_AA_LEVELS ) + 127U ) / 255U ];
+
+			// Render target is followed pixel by pixel, as run
+			// can cross its boundary
+			n = (( NULL != g_target.p_buf ) ? ( 1U ) : ( num - i ));
+
+			if 	(	( NULL != g_target.p_buf )
+				&&	( g_aa.page >= g_target.page )
+				&&	( g_aa.page < ( g_target.page + g_target.page_size ))
+				&&	( g_aa.col >= g_target.col )
+				&&	( g_aa.col < ( g_target.col + g_target.col_size )))
+			{
+				p_pix = &g_target.p_buf[ (( g_aa.page - g_target.page ) * g_target.col_size ) + ( g_aa.col - g_target.col ) ];
+
+				rgb.R = ( p_pix -> R + ((((int32_t) p_fg -> R - p_pix -> R ) * cov ) / 255 ));
+				rgb.G = ( p_pix -> G + ((((int32_t) p_fg -> G - p_pix -> G ) * cov ) / 255 ));
+				rgb.B = ( p_pix -> B + ((((int32_t) p_fg -> B - p_pix -> B ) * cov ) / 255 ));
+			}
+
+			// Color changed, put run of pixels
+			if 	(	( g_aa.run > 0U )
+				&&	(	( rgb.R != g_aa.run_rgb.R )
+					||	( rgb.G != g_aa.run_rgb.G )
+					||	( rgb.B != g_aa.run_rgb.B )))
+			{
+				status |= ili9488_driver_gram_put( &g_aa.run_rgb, g_aa.run );
+				g_aa.run = 0;
+			}
+
+			g_aa.run_rgb = rgb;
+			g_aa.run += n;
+
+			// Position is followed only for render target
+			if ( NULL != g_target.p_buf )
+			{
+				if ( g_aa.col < g_aa.col_e )
+				{
+					g_aa.col++;
+				}
+				else
+				{
+					g_aa.col = g_aa.col_s;
+					g_aa.page++;
+				}
+			}
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			End anti-aliased window
+	*
+	*	param: 		none
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_driver_aa_end(void)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		if ( g_aa.run > 0U )
+		{
+			status |= ili9488_driver_gram_put( &g_aa.run_rgb, g_aa.run );
+			g_aa.run = 0;
+		}
+
+		status |= ili9488_driver_gram_end();
+
+		return status;
+	}
+
+#endif
+
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Encode glyph into GRAM data
+	*
+	*	Pixels are in same order as in "ili9488_driver_set_chars".
+	*
+	*	param: 		p_glyph - Pointer to glyph in font table
+	*	param: 		p_font - Pointer to font
+	*	param: 		p_rgb - Foreground and background color
+	*	param: 		p_buf - Pointer to encoded glyph
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void ili9488_driver_encode_glyph(const uint8_t * const p_glyph, const ili9488_font_t * const p_font, const ili9488_rgb_t * const p_rgb, uint8_t * const p_buf)
+	{
+		uint8_t i;
+		uint8_t j;
+		uint8_t mask;
+		uint8_t line_size_byte;
+		uint32_t pos = 0;
+		uint32_t run = 0;
+		bool run_fg = false;
+		bool pix_fg;
+
+		line_size_byte = (( p_font -> width / 8U ) + 1U );
+
+		// Every page
+		for ( j = 0; j < p_font -> width; j++ )
+		{
+			mask = ( 0x80U >> ( j % 8U ));
+
+			// Every column
+			for ( i = 0; i < p_font -> height; i++ )
+			{
+				pix_fg = ( 0U != ( p_glyph[ ( i * line_size_byte ) + ( j / 8U ) ] & mask ));
+
+				if (( pix_fg != run_fg ) && ( run > 0U ))
+				{
+					ili9488_low_if_encode_rgb(( run_fg ? &p_rgb[0] : &p_rgb[1] ), run, p_buf, pos );
+					pos += run;
+					run = 0;
+				}
+
+				run_fg = pix_fg;
+				run++;
+			}
+		}
+
+		ili9488_low_if_encode_rgb(( run_fg ? &p_rgb[0] : &p_rgb[1] ), run, p_buf, pos );
+	}
+
+#endif // ILI9488_GLYPH_CACHE_EN
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get MADCTL register value of orientation
+*
+*	param: 		orientation - Orientation of display
+*	return:		MADCTL register value, BGR pixel order
+*/
+//////////////////////////////////////////////////////////////
+static uint8_t ili9488_driver_get_madctl_reg(const ili9488_orientation_t orientation)
+{
+	uint8_t madctl = ILI9488_DRIVER_MADCTL_BGR;
+
+	switch( g_orientation_madctl[ orientation ] )
+	{
+		case eILI9488_MADCTL_Y_MIRROR:
+			madctl |= ILI9488_DRIVER_MADCTL_MY;
+			break;
+
+		case eILI9488_MADCTL_X_MIRROR:
+			madctl |= ILI9488_DRIVER_MADCTL_MX;
+			break;
+
+		case eILI9488_MADCTL_XY_MIRROR:
+			madctl |= ( ILI9488_DRIVER_MADCTL_MY | ILI9488_DRIVER_MADCTL_MX );
+			break;
+
+		case eILI9488_MADCTL_XY_EXCHANGE:
+			madctl |= ILI9488_DRIVER_MADCTL_MV;
+			break;
+
+		case eILI9488_MADCTL_XY_EXCHANGE_Y_MIRROR:
+			madctl |= ( ILI9488_DRIVER_MADCTL_MV | ILI9488_DRIVER_MADCTL_MY );
+			break;
+
+		case eILI9488_MADCTL_XY_EXCHANGE_X_MIRROR:
+			madctl |= ( ILI9488_DRIVER_MADCTL_MV | ILI9488_DRIVER_MADCTL_MX );
+			break;
+
+		case eILI9488_MADCTL_XY_EXCHANGE_XY_MIRROR:
+			madctl |= ( ILI9488_DRIVER_MADCTL_MV | ILI9488_DRIVER_MADCTL_MY | ILI9488_DRIVER_MADCTL_MX );
+			break;
+
+		case eILI9488_MADCTL_NORMAL:
+		default:
+			// No actions...
+			break;
+	}
+
+	return madctl;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Map point to panel frame memory
+*
+*	Panel coordinates are source line (x) and gate line (y)
+*	of frame memory.
+*
+*	param: 		madctl - MADCTL register value
+*	param: 		page - Page
+*	param: 		col - Column
+*	param: 		p_x - Pointer to source line
+*	param: 		p_y - Pointer to gate line
+*	return:		true if point is on display
+*/
+//////////////////////////////////////////////////////////////
+static bool ili9488_driver_to_panel(const uint8_t madctl, const uint16_t page, const uint16_t col, uint16_t * const p_x, uint16_t * const p_y)
+{
+	bool valid = false;
+	uint16_t x;
+	uint16_t y;
+
+	// Row/column exchange
+	if ( ILI9488_DRIVER_MADCTL_MV & madctl )
+	{
+		x = page;
+		y = col;
+	}
+	else
+	{
+		x = col;
+		y = page;
+	}
+
+	if (( x < ILI9488_DRIVER_SOURCE_LINES ) && ( y < ILI9488_DRIVER_GATE_LINES ))
+	{
+		*p_x = (( ILI9488_DRIVER_MADCTL_MX & madctl ) ? (( ILI9488_DRIVER_SOURCE_LINES - 1U ) - x ) : ( x ));
+		*p_y = (( ILI9488_DRIVER_MADCTL_MY & madctl ) ? (( ILI9488_DRIVER_GATE_LINES - 1U ) - y ) : ( y ));
+		valid = true;
+	}
+
+	return valid;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Map point from panel frame memory
+*
+*	param: 		madctl - MADCTL register value
+*	param: 		x - Source line
+*	param: 		y - Gate line
+*	param: 		p_page - Pointer to page
+*	param: 		p_col - Pointer to column
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_driver_from_panel(const uint8_t madctl, const uint16_t x, const uint16_t y, uint16_t * const p_page, uint16_t * const p_col)
+{
+	uint16_t x_m;
+	uint16_t y_m;
+
+	x_m = (( ILI9488_DRIVER_MADCTL_MX & madctl ) ? (( ILI9488_DRIVER_SOURCE_LINES - 1U ) - x ) : ( x ));
+	y_m = (( ILI9488_DRIVER_MADCTL_MY & madctl ) ? (( ILI9488_DRIVER_GATE_LINES - 1U ) - y ) : ( y ));
+
+	// Row/column exchange
+	if ( ILI9488_DRIVER_MADCTL_MV & madctl )
+	{
+		*p_page = x_m;
+		*p_col = y_m;
+	}
+	else
+	{
+		*p_page = y_m;
+		*p_col = x_m;
+	}
+}
+
 
 //////////////////////////////////////////////////////////////
 // END OF FILE
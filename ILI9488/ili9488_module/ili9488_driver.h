@@ -77,22 +77,6 @@ typedef enum
 	eILI9488_MADCTL_XY_EXCHANGE_XY_MIRROR,
 } ili9488_madctl_t;
 
-// Pixel format
-typedef enum
-{
-	eILI9488_PIXEL_FORMAT_3_BIT = 0,
-	eILI9488_PIXEL_FORMAT_16_BIT,
-	eILI9488_PIXEL_FORMAT_18_BIT,
-	eILI9488_PIXEL_FORMAT_24_BIT,
-} ili9488_pixel_format_t;
-
-// Display orientation
-typedef enum
-{
-	eILI9488_ORIENTATION_LANDSCAPE = 0,
-	eILI9488_ORIENTATION_LANDSCAPE_FLIP,
-} ili9488_orientation_t;
-
 
 
 //////////////////////////////////////////////////////////////
@@ -118,22 +102,43 @@ ili9488_status_t ili9488_driver_read_brightness_control		(bool * const p_brightn
 
 ili9488_status_t ili9488_driver_set_orientation				(const ili9488_orientation_t orientation);
 ili9488_status_t ili9488_driver_get_orientation				(ili9488_orientation_t * const p_orientation);
+uint16_t		 ili9488_driver_get_page_size				(void);
+uint16_t		 ili9488_driver_get_col_size				(void);
+ili9488_status_t ili9488_driver_map_point					(const ili9488_orientation_t from, const ili9488_orientation_t to, const uint16_t page, const uint16_t col, uint16_t * const p_page, uint16_t * const p_col);
+
+ili9488_status_t ili9488_driver_set_scroll_area				(const uint16_t size);
+ili9488_status_t ili9488_driver_set_scroll_offset			(const uint16_t offset);
 
 ili9488_status_t ili9488_driver_set_pixel_format			(const ili9488_pixel_format_t format);
 ili9488_status_t ili9488_driver_read_pixel_format			(ili9488_pixel_format_t * const p_format);
 
 ili9488_status_t ili9488_driver_set_cursor					(const uint16_t col_s, const uint16_t col_e, const uint16_t page_s, const uint16_t page_e);
+void			 ili9488_driver_get_window_stats			(ili9488_window_stats_t * const p_stats);
+void			 ili9488_driver_reset_window_stats			(void);
 
 ili9488_status_t ili9488_driver_write_memory				(const uint8_t * const p_mem, const uint32_t size);
+ili9488_status_t ili9488_driver_write_buffer				(const ili9488_rgb_t * const p_buf, const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size);
+void			 ili9488_driver_set_target					(ili9488_rgb_t * const p_buf, const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size);
 ili9488_status_t ili9488_driver_read_memory					(uint8_t * const p_mem, const uint32_t size);
 
 // Graphics functions
 ili9488_status_t ili9488_driver_set_pixel					(const uint16_t page, const uint16_t col, const ili9488_color_t color);
 ili9488_status_t ili9488_driver_fill_rectangle				(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color);
+ili9488_status_t ili9488_driver_fill_round_rectangle		(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
 ili9488_status_t ili9488_driver_fill_circle					(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color);
+ili9488_status_t ili9488_driver_fill_bordered_circle		(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
 ili9488_status_t ili9488_driver_set_circle					(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color);
+ili9488_status_t ili9488_driver_fill_arc					(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color);
+void			 ili9488_driver_get_arc_area				(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, uint16_t * const p_page, uint16_t * const p_col, uint16_t * const p_page_size, uint16_t * const p_col_size);
 ili9488_status_t ili9488_driver_set_char					(const uint8_t ch, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt);
 ili9488_status_t ili9488_driver_set_string					(const char *str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt);
+ili9488_status_t ili9488_driver_set_chars					(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t  bg_color, const ili9488_font_opt_t font_opt);
+ili9488_status_t ili9488_driver_draw_bitmap					(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col);
+ili9488_status_t ili9488_driver_draw_polyline				(const ili9488_point_t * const p_points, const uint32_t num, const ili9488_color_t color);
+ili9488_status_t ili9488_driver_fill_polygon				(const ili9488_point_t * const p_points, const uint32_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color);
+ili9488_status_t ili9488_driver_draw_line_aa				(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color);
+ili9488_status_t ili9488_driver_draw_circle_aa				(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color);
+ili9488_status_t ili9488_driver_set_chars_aa				(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt);
 
 
 //////////////////////////////////////////////////////////////
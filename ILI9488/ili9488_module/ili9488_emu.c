@@ -0,0 +1,903 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	NOTICE: Emulator is meant for host builds only! Enable
+//	it with ILI9488_EMU_EN and disable ILI9488_HAL_TRANSPORT_EN.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_emu.h"
+#include "ili9488_config.h"
+
+#if ( ILI9488_EMU_EN )
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// MADCTL bits
+#define ILI9488_EMU_MADCTL_MY			( 0x80U )
+#define ILI9488_EMU_MADCTL_MX			( 0x40U )
+#define ILI9488_EMU_MADCTL_MV			( 0x20U )
+
+// Emulator state
+typedef struct
+{
+	uint8_t		gram[ ILI9488_EMU_HEIGHT ][ ILI9488_EMU_WIDTH ][ 3 ];	// Frame memory
+
+	bool		cs;				// Chip select line
+	bool		dc;				// Data/command line
+	uint8_t		cmd;			// Current command
+	uint32_t	param_cnt;		// Parameters received for current command
+	uint8_t		param[6];		// Parameters
+
+	uint8_t		madctl;			// Memory access control
+	uint8_t		colmod;			// Pixel format
+
+	uint16_t	col_s;			// Address window
+	uint16_t	col_e;
+	uint16_t	page_s;
+	uint16_t	page_e;
+
+	uint16_t	col;			// Address pointer
+	uint16_t	page;
+
+	uint16_t	tfa;			// Vertical scrolling, in frame memory rows
+	uint16_t	vsa;
+	uint16_t	bfa;
+	uint16_t	vsp;
+
+	uint8_t		pix[3];			// Partially received pixel
+	uint8_t		pix_cnt;
+
+	float32_t	led;			// Backlight
+
+	ili9488_emu_stats_t stats;
+} ili9488_emu_t;
+
+// Asynchronous transfer
+typedef struct
+{
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	bool			is_init;
+	bool			pending;
+	const uint8_t *	p_data;
+	uint32_t		size;
+} ili9488_emu_async_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Emulator
+static ili9488_emu_t g_emu;
+
+// Asynchronous transfer
+static ili9488_emu_async_t g_emu_async =
+{
+	.lock	= PTHREAD_MUTEX_INITIALIZER,
+	.cond	= PTHREAD_COND_INITIALIZER,
+};
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_emu_transmit		(const uint8_t * p_data, const uint32_t size);
+static ili9488_spi_status_t ili9488_emu_transmit_async	(const uint8_t * p_data, const uint32_t size);
+static ili9488_spi_status_t ili9488_emu_receive			(uint8_t * const p_data, const uint32_t size);
+static void 				ili9488_emu_set_cs			(const bool state);
+static void 				ili9488_emu_set_dc			(const bool state);
+static void 				ili9488_emu_set_reset		(const bool state);
+static ili9488_status_t		ili9488_emu_set_led			(const float32_t brightness);
+static void					ili9488_emu_delay_ms		(const uint32_t ms);
+
+static void					ili9488_emu_command			(const uint8_t cmd);
+static void					ili9488_emu_data			(const uint8_t data);
+static void					ili9488_emu_write_pixel		(const uint8_t R, const uint8_t G, const uint8_t B);
+static bool					ili9488_emu_map_pixel		(const uint16_t col, const uint16_t page, uint16_t * const p_x, uint16_t * const p_y);
+static void					ili9488_emu_next_pixel		(void);
+static uint16_t				ili9488_emu_scroll_row		(const uint16_t row);
+static void *				ili9488_emu_async_thread	(void * p_arg);
+
+// Blocking transport
+static const ili9488_transport_t g_emu_transport =
+{
+	.pf_init			= NULL,
+	.pf_transmit		= &ili9488_emu_transmit,
+	.pf_transmit_async	= NULL,
+	.pf_receive			= &ili9488_emu_receive,
+	.pf_set_cs			= &ili9488_emu_set_cs,
+	.pf_set_dc			= &ili9488_emu_set_dc,
+	.pf_set_reset		= &ili9488_emu_set_reset,
+	.pf_set_led			= &ili9488_emu_set_led,
+	.pf_delay_ms		= &ili9488_emu_delay_ms,
+};
+
+// Non-blocking transport, bursts are completed from separate thread
+static const ili9488_transport_t g_emu_transport_async =
+{
+	.pf_init			= NULL,
+	.pf_transmit		= &ili9488_emu_transmit,
+	.pf_transmit_async	= &ili9488_emu_transmit_async,
+	.pf_receive			= &ili9488_emu_receive,
+	.pf_set_cs			= &ili9488_emu_set_cs,
+	.pf_set_dc			= &ili9488_emu_set_dc,
+	.pf_set_reset		= &ili9488_emu_set_reset,
+	.pf_set_led			= &ili9488_emu_set_led,
+	.pf_delay_ms		= &ili9488_emu_delay_ms,
+};
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get emulator transport
+*
+*	param: 		async - Complete bursts from separate thread
+*	return:		Pointer to transport interface
+*/
+//////////////////////////////////////////////////////////////
+const ili9488_transport_t * ili9488_emu_get_transport(const bool async)
+{
+	return (( true == async ) ? ( &g_emu_transport_async ) : ( &g_emu_transport ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset emulator
+*
+*	Clears GRAM, registers and statistics.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_emu_reset(void)
+{
+	memset( &g_emu, 0, sizeof( g_emu ));
+
+	g_emu.cs = true;
+	g_emu.col_e = ( ILI9488_EMU_WIDTH - 1U );
+	g_emu.page_e = ( ILI9488_EMU_HEIGHT - 1U );
+	g_emu.colmod = 0x06U;
+	g_emu.vsa = ILI9488_EMU_HEIGHT;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get transport statistics
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_emu_get_stats(ili9488_emu_stats_t * const p_stats)
+{
+	*p_stats = g_emu.stats;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset transport statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_emu_reset_stats(void)
+{
+	memset( &g_emu.stats, 0, sizeof( g_emu.stats ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get vertical scrolling registers
+*
+*	param: 		p_scroll - Pointer to scrolling registers
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_emu_get_scroll(ili9488_emu_scroll_t * const p_scroll)
+{
+	p_scroll -> tfa = g_emu.tfa;
+	p_scroll -> vsa = g_emu.vsa;
+	p_scroll -> bfa = g_emu.bfa;
+	p_scroll -> vsp = g_emu.vsp;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get pixel from emulated GRAM
+*
+*	Coordinates are in native portrait orientation of panel.
+*
+*	param: 		x - Column (0 - 319)
+*	param: 		y - Row (0 - 479)
+*	param: 		p_rgb - Pointer to pixel color
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_emu_get_pixel(const uint16_t x, const uint16_t y, ili9488_rgb_t * const p_rgb)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	if (( x < ILI9488_EMU_WIDTH ) && ( y < ILI9488_EMU_HEIGHT ))
+	{
+		p_rgb -> R = g_emu.gram[y][x][0];
+		p_rgb -> G = g_emu.gram[y][x][1];
+		p_rgb -> B = g_emu.gram[y][x][2];
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Dump emulated display to PPM file
+*
+*	Frame is stored in native portrait orientation of panel,
+*	as it is shown on display with vertical scrolling applied.
+*
+*	param: 		p_file - Path to file
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_emu_dump_ppm(const char * const p_file)
+{
+	ili9488_status_t status = eILI9488_OK;
+	FILE * p_ppm;
+	uint16_t y;
+
+	p_ppm = fopen( p_file, "wb" );
+
+	if ( NULL != p_ppm )
+	{
+		fprintf( p_ppm, "P6\n%d %d\n255\n", ILI9488_EMU_WIDTH, ILI9488_EMU_HEIGHT );
+
+		for ( y = 0; y < ILI9488_EMU_HEIGHT; y++ )
+		{
+			if ( 1U != fwrite( &g_emu.gram[ ili9488_emu_scroll_row( y ) ], sizeof( g_emu.gram[0] ), 1U, p_ppm ))
+			{
+				status = eILI9488_ERROR;
+				break;
+			}
+		}
+
+		fclose( p_ppm );
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Transmit
+*
+*	param: 		p_data 	- Pointer to trasmited data
+*	param: 		size 	- Size of transmited data in bytes
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_emu_transmit(const uint8_t * p_data, const uint32_t size)
+{
+	ili9488_spi_status_t status = eILI9488_SPI_OK;
+	uint32_t i;
+
+	if ( true == g_emu.cs )
+	{
+		status = eILI9488_SPI_ERROR;
+	}
+	else
+	{
+		g_emu.stats.transfers++;
+		g_emu.stats.bytes += size;
+
+		for ( i = 0; i < size; i++ )
+		{
+			if ( false == g_emu.dc )
+			{
+				ili9488_emu_command( p_data[i] );
+			}
+			else
+			{
+				ili9488_emu_data( p_data[i] );
+			}
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Transmit without blocking
+*
+*	Burst is handed to emulator thread, which reports
+*	completion to low level interface.
+*
+*	param: 		p_data 	- Pointer to trasmited data
+*	param: 		size 	- Size of transmited data in bytes
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_emu_transmit_async(const uint8_t * p_data, const uint32_t size)
+{
+	ili9488_spi_status_t status = eILI9488_SPI_OK;
+
+	pthread_mutex_lock( &g_emu_async.lock );
+
+	// Start thread on first use
+	if ( false == g_emu_async.is_init )
+	{
+		if ( 0 == pthread_create( &g_emu_async.thread, NULL, &ili9488_emu_async_thread, NULL ))
+		{
+			g_emu_async.is_init = true;
+		}
+	}
+
+	if (( true == g_emu_async.is_init ) && ( false == g_emu_async.pending ))
+	{
+		g_emu_async.p_data = p_data;
+		g_emu_async.size = size;
+		g_emu_async.pending = true;
+
+		pthread_cond_signal( &g_emu_async.cond );
+	}
+	else
+	{
+		status = eILI9488_SPI_ERROR;
+	}
+
+	pthread_mutex_unlock( &g_emu_async.lock );
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Receive
+*
+*	param: 		p_data 	- Pointer to receive data
+*	param: 		size 	- Size of receive data in bytes
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_emu_receive(uint8_t * const p_data, const uint32_t size)
+{
+	ili9488_spi_status_t status = eILI9488_SPI_OK;
+	uint32_t i;
+	uint16_t x;
+	uint16_t y;
+
+	if ( true == g_emu.cs )
+	{
+		status = eILI9488_SPI_ERROR;
+	}
+	else
+	{
+		g_emu.stats.transfers++;
+		g_emu.stats.bytes += size;
+
+		for ( i = 0; i < size; i++ )
+		{
+			switch( g_emu.cmd )
+			{
+				case eILI9488_READ_MADCTL_CMD:
+					p_data[i] = g_emu.madctl;
+					break;
+
+				case eILI9488_READ_PF_CMD:
+					p_data[i] = g_emu.colmod;
+					break;
+
+				// Memory is always read in 18-bit format
+				case eILI9488_READ_MEM_CMD:
+				case eILI9488_READ_MEM_CONT_CMD:
+
+					p_data[i] = 0U;
+
+					if ( true == ili9488_emu_map_pixel( g_emu.col, g_emu.page, &x, &y ))
+					{
+						p_data[i] = g_emu.gram[y][x][ g_emu.pix_cnt ];
+					}
+
+					g_emu.pix_cnt++;
+
+					if ( g_emu.pix_cnt >= 3U )
+					{
+						g_emu.pix_cnt = 0U;
+						ili9488_emu_next_pixel();
+					}
+					break;
+
+				default:
+					p_data[i] = 0U;
+					break;
+			}
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set CS line
+*
+*	param: 		state - Line state
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_set_cs(const bool state)
+{
+	g_emu.cs = state;
+
+	// End of transaction
+	if ( true == state )
+	{
+		g_emu.cmd = eILI9488_NOP_CMD;
+		g_emu.param_cnt = 0U;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set DC line
+*
+*	param: 		state - Line state
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_set_dc(const bool state)
+{
+	g_emu.dc = state;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set reset line
+*
+*	param: 		state - Line state
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_set_reset(const bool state)
+{
+	// Hardware reset
+	if ( false == state )
+	{
+		ili9488_emu_command( eILI9488_SOFTRST_CMD );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set backlight
+*
+*	param: 		brightness - Brightness 0.0 - 1.0
+*	return:		status - Always Ok
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_emu_set_led(const float32_t brightness)
+{
+	g_emu.led = brightness;
+
+	return eILI9488_OK;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Delay
+*
+*	NOTE: Emulator does not need any delays.
+*
+*	param: 		ms - Time in miliseconds
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_delay_ms(const uint32_t ms)
+{
+	(void) ms;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Process command byte
+*
+*	param: 		cmd - Command
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_command(const uint8_t cmd)
+{
+	g_emu.cmd = cmd;
+	g_emu.param_cnt = 0U;
+	g_emu.stats.commands++;
+
+	switch( cmd )
+	{
+		case eILI9488_SOFTRST_CMD:
+			g_emu.madctl = 0U;
+			g_emu.colmod = 0x06U;
+			g_emu.col_s = 0U;
+			g_emu.col_e = ( ILI9488_EMU_WIDTH - 1U );
+			g_emu.page_s = 0U;
+			g_emu.page_e = ( ILI9488_EMU_HEIGHT - 1U );
+			g_emu.tfa = 0U;
+			g_emu.vsa = ILI9488_EMU_HEIGHT;
+			g_emu.bfa = 0U;
+			g_emu.vsp = 0U;
+			break;
+
+		case eILI9488_SET_COL_ADDR_CMD:
+			g_emu.stats.addr_cmds++;
+			g_emu.stats.col_cmds++;
+			break;
+
+		case eILI9488_SET_PAGE_ADDR_CMD:
+			g_emu.stats.addr_cmds++;
+			g_emu.stats.page_cmds++;
+			break;
+
+		case eILI9488_WRITE_MEM_CMD:
+			g_emu.stats.mem_writes++;
+			g_emu.col = g_emu.col_s;
+			g_emu.page = g_emu.page_s;
+			g_emu.pix_cnt = 0U;
+			break;
+
+		case eILI9488_READ_MEM_CMD:
+			g_emu.col = g_emu.col_s;
+			g_emu.page = g_emu.page_s;
+			g_emu.pix_cnt = 0U;
+			break;
+
+		case eILI9488_WRITE_MEM_CONT_CMD:
+		case eILI9488_READ_MEM_CONT_CMD:
+			g_emu.pix_cnt = 0U;
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Process data byte
+*
+*	param: 		data - Data
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_data(const uint8_t data)
+{
+	uint16_t rgb565;
+
+	if ( g_emu.param_cnt < sizeof( g_emu.param ))
+	{
+		g_emu.param[ g_emu.param_cnt ] = data;
+	}
+
+	switch( g_emu.cmd )
+	{
+		case eILI9488_SET_COL_ADDR_CMD:
+			if ( 3U == g_emu.param_cnt )
+			{
+				g_emu.col_s = (( g_emu.param[0] << 8U ) | g_emu.param[1] );
+				g_emu.col_e = (( g_emu.param[2] << 8U ) | g_emu.param[3] );
+			}
+			break;
+
+		case eILI9488_SET_PAGE_ADDR_CMD:
+			if ( 3U == g_emu.param_cnt )
+			{
+				g_emu.page_s = (( g_emu.param[0] << 8U ) | g_emu.param[1] );
+				g_emu.page_e = (( g_emu.param[2] << 8U ) | g_emu.param[3] );
+			}
+			break;
+
+		case eILI9488_SET_MADCTL_CMD:
+			g_emu.madctl = data;
+			break;
+
+		case eILI9488_SET_VSCRDEF_CMD:
+			if ( 5U == g_emu.param_cnt )
+			{
+				g_emu.tfa = (( g_emu.param[0] << 8U ) | g_emu.param[1] );
+				g_emu.vsa = (( g_emu.param[2] << 8U ) | g_emu.param[3] );
+				g_emu.bfa = (( g_emu.param[4] << 8U ) | g_emu.param[5] );
+			}
+			break;
+
+		case eILI9488_SET_VSCRSADD_CMD:
+			if ( 1U == g_emu.param_cnt )
+			{
+				g_emu.vsp = (( g_emu.param[0] << 8U ) | g_emu.param[1] );
+			}
+			break;
+
+		case eILI9488_SET_PF_CMD:
+			g_emu.colmod = data;
+			break;
+
+		case eILI9488_WRITE_MEM_CMD:
+		case eILI9488_WRITE_MEM_CONT_CMD:
+
+			switch( g_emu.colmod & 0x07U )
+			{
+				// 3-bit: two pixels per byte
+				case 0x01U:
+					ili9488_emu_write_pixel((( data & 0x20U ) ? 0xFCU : 0U ), (( data & 0x10U ) ? 0xFCU : 0U ), (( data & 0x08U ) ? 0xFCU : 0U ));
+					ili9488_emu_write_pixel((( data & 0x04U ) ? 0xFCU : 0U ), (( data & 0x02U ) ? 0xFCU : 0U ), (( data & 0x01U ) ? 0xFCU : 0U ));
+					break;
+
+				// 16-bit: RGB565
+				case 0x05U:
+					g_emu.pix[ g_emu.pix_cnt++ ] = data;
+
+					if ( g_emu.pix_cnt >= 2U )
+					{
+						rgb565 = (( g_emu.pix[0] << 8U ) | g_emu.pix[1] );
+						ili9488_emu_write_pixel((( rgb565 >> 8U ) & 0xF8U ), (( rgb565 >> 3U ) & 0xFCU ), (( rgb565 << 3U ) & 0xF8U ));
+						g_emu.pix_cnt = 0U;
+					}
+					break;
+
+				// 18/24-bit: RGB666/RGB888
+				default:
+					g_emu.pix[ g_emu.pix_cnt++ ] = data;
+
+					if ( g_emu.pix_cnt >= 3U )
+					{
+						if ( 0x06U == ( g_emu.colmod & 0x07U ))
+						{
+							ili9488_emu_write_pixel(( g_emu.pix[0] & 0xFCU ), ( g_emu.pix[1] & 0xFCU ), ( g_emu.pix[2] & 0xFCU ));
+						}
+						else
+						{
+							ili9488_emu_write_pixel( g_emu.pix[0], g_emu.pix[1], g_emu.pix[2] );
+						}
+
+						g_emu.pix_cnt = 0U;
+					}
+					break;
+			}
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+
+	g_emu.param_cnt++;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write pixel at address pointer
+*
+*	param: 		R - Red
+*	param: 		G - Green
+*	param: 		B - Blue
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_write_pixel(const uint8_t R, const uint8_t G, const uint8_t B)
+{
+	uint16_t x;
+	uint16_t y;
+
+	if ( true == ili9488_emu_map_pixel( g_emu.col, g_emu.page, &x, &y ))
+	{
+		g_emu.gram[y][x][0] = R;
+		g_emu.gram[y][x][1] = G;
+		g_emu.gram[y][x][2] = B;
+	}
+
+	g_emu.stats.pixels++;
+
+	ili9488_emu_next_pixel();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Map column/page address to frame memory
+*
+*	Row/column exchange is applied first and mirroring
+*	after that.
+*
+*	param: 		col - Column address
+*	param: 		page - Page address
+*	param: 		p_x - Pointer to frame memory column
+*	param: 		p_y - Pointer to frame memory row
+*	return:		true if pixel is inside frame memory
+*/
+//////////////////////////////////////////////////////////////
+static bool ili9488_emu_map_pixel(const uint16_t col, const uint16_t page, uint16_t * const p_x, uint16_t * const p_y)
+{
+	uint16_t x;
+	uint16_t y;
+	bool valid = false;
+
+	if ( g_emu.madctl & ILI9488_EMU_MADCTL_MV )
+	{
+		x = page;
+		y = col;
+	}
+	else
+	{
+		x = col;
+		y = page;
+	}
+
+	if (( x < ILI9488_EMU_WIDTH ) && ( y < ILI9488_EMU_HEIGHT ))
+	{
+		if ( g_emu.madctl & ILI9488_EMU_MADCTL_MX )
+		{
+			x = (( ILI9488_EMU_WIDTH - 1U ) - x );
+		}
+
+		if ( g_emu.madctl & ILI9488_EMU_MADCTL_MY )
+		{
+			y = (( ILI9488_EMU_HEIGHT - 1U ) - y );
+		}
+
+		*p_x = x;
+		*p_y = y;
+		valid = true;
+	}
+
+	return valid;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Advance address pointer inside window
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_emu_next_pixel(void)
+{
+	g_emu.col++;
+
+	if ( g_emu.col > g_emu.col_e )
+	{
+		g_emu.col = g_emu.col_s;
+		g_emu.page++;
+
+		if ( g_emu.page > g_emu.page_e )
+		{
+			g_emu.page = g_emu.page_s;
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get frame memory row shown at display row
+*
+*	Rows of scrolling area are shown starting with row of
+*	vertical scrolling pointer and wrap inside area. Invalid
+*	setup (areas not adding up to panel height) is shown
+*	without scrolling.
+*
+*	param: 		row - Display row
+*	return:		Frame memory row
+*/
+//////////////////////////////////////////////////////////////
+static uint16_t ili9488_emu_scroll_row(const uint16_t row)
+{
+	uint16_t mem_row = row;
+
+	if 	(	(( g_emu.tfa + g_emu.vsa + g_emu.bfa ) == ILI9488_EMU_HEIGHT )
+		&&	( g_emu.vsa > 0U )
+		&&	( row >= g_emu.tfa )
+		&&	( row < ( g_emu.tfa + g_emu.vsa ))
+		&&	( g_emu.vsp >= g_emu.tfa )
+		&&	( g_emu.vsp < ( g_emu.tfa + g_emu.vsa )))
+	{
+		mem_row = ( g_emu.tfa + ((( g_emu.vsp - g_emu.tfa ) + ( row - g_emu.tfa )) % g_emu.vsa ));
+	}
+
+	return mem_row;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Asynchronous transfer thread
+*
+*	param: 		p_arg - Not used
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void * ili9488_emu_async_thread(void * p_arg)
+{
+	const uint8_t * p_data;
+	uint32_t size;
+
+	(void) p_arg;
+
+	while ( true )
+	{
+		pthread_mutex_lock( &g_emu_async.lock );
+
+		while ( false == g_emu_async.pending )
+		{
+			pthread_cond_wait( &g_emu_async.cond, &g_emu_async.lock );
+		}
+
+		p_data = g_emu_async.p_data;
+		size = g_emu_async.size;
+		g_emu_async.pending = false;
+
+		pthread_mutex_unlock( &g_emu_async.lock );
+
+		// Put burst on the "wire"
+		(void) ili9488_emu_transmit( p_data, size );
+
+		// Report completion
+		ili9488_low_if_tx_cplt_hndl();
+	}
+
+	return NULL;
+}
+
+#endif // ILI9488_EMU_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	NOTICE: Emulator is meant for host builds only! Enable
+//	it with ILI9488_EMU_EN and disable ILI9488_HAL_TRANSPORT_EN.
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_EMU_H_
+#define _ILI9488_EMU_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488_low_if.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Emulated GRAM size (native portrait orientation)
+#define ILI9488_EMU_WIDTH				( 320 )
+#define ILI9488_EMU_HEIGHT				( 480 )
+
+// Transport statistics
+typedef struct
+{
+	uint32_t transfers;		// Number of transmit/receive calls
+	uint32_t bytes;			// Number of bytes on the wire
+	uint32_t commands;		// Number of commands
+	uint32_t addr_cmds;		// Number of column/page address commands
+	uint32_t col_cmds;		// Number of column address commands
+	uint32_t page_cmds;		// Number of page address commands
+	uint32_t mem_writes;	// Number of memory write commands
+	uint32_t pixels;		// Number of pixels written to GRAM
+} ili9488_emu_stats_t;
+
+// Vertical scrolling registers, in frame memory rows
+typedef struct
+{
+	uint16_t tfa;			// Top fixed area (VSCRDEF)
+	uint16_t vsa;			// Vertical scrolling area (VSCRDEF)
+	uint16_t bfa;			// Bottom fixed area (VSCRDEF)
+	uint16_t vsp;			// Vertical scrolling pointer (VSCRSADD)
+} ili9488_emu_scroll_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+const ili9488_transport_t *	ili9488_emu_get_transport	(const bool async);
+void						ili9488_emu_reset			(void);
+void						ili9488_emu_get_stats		(ili9488_emu_stats_t * const p_stats);
+void						ili9488_emu_reset_stats		(void);
+void						ili9488_emu_get_scroll		(ili9488_emu_scroll_t * const p_scroll);
+ili9488_status_t			ili9488_emu_get_pixel		(const uint16_t x, const uint16_t y, ili9488_rgb_t * const p_rgb);
+ili9488_status_t			ili9488_emu_dump_ppm		(const char * const p_file);
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
+
+#endif // _ILI9488_EMU_H_
@@ -8625,37 +8625,79 @@
 
 #endif // ILI9488_FONT_24_USE_EN
 
+// Fonts
+#if ( ILI9488_FONT_8_USE_EN )
+	static const ili9488_font_t g_font8 = { ili9488_font8_lut, 5U, 8U, NULL, NULL, 0U, false, 0U, 0U, NULL, 0U };
+#endif
+
+#if ( ILI9488_FONT_12_USE_EN )
+	static const ili9488_font_t g_font12 = { ili9488_font12_lut, 7U, 12U, NULL, NULL, 0U, false, 0U, 0U, NULL, 0U };
+#endif
+
+#if ( ILI9488_FONT_16_USE_EN )
+	static const ili9488_font_t g_font16 = { ili9488_font16_lut, 11U, 16U, NULL, NULL, 0U, false, 0U, 0U, NULL, 0U };
+#endif
+
+#if ( ILI9488_FONT_20_USE_EN )
+	static const ili9488_font_t g_font20 = { ili9488_font20_lut, 14U, 20U, NULL, NULL, 0U, false, 0U, 0U, NULL, 0U };
+#endif
+
+#if ( ILI9488_FONT_24_USE_EN )
+	static const ili9488_font_t g_font24 = { ili9488_font24_lut, 17U, 24U, NULL, NULL, 0U, false, 0U, 0U, NULL, 0U };
+#endif
+
+// Compiled fonts, see tools/ili9488_fontconv.c
+#if ( ILI9488_FONT_USER_NUM > 0 )
+	extern const ili9488_font_t ILI9488_FONT_USER_0;
+#endif
+
+#if ( ILI9488_FONT_USER_NUM > 1 )
+	extern const ili9488_font_t ILI9488_FONT_USER_1;
+#endif
+
 // Font list
-static const ili9488_font_t g_fontList[ eILI9488_FONT_NUM_OF ] =
+static const ili9488_font_t * const g_fontList[ eILI9488_FONT_NUM_OF ] =
 {
 	#if ( ILI9488_FONT_8_USE_EN )
-		{ (uint8_t*) &ili9488_font8_lut, 	5U, 	8U 	},
+		&g_font8,
 	#else
-		{ NULL, 0U, 0U },
+		NULL,
 	#endif
 
 	#if ( ILI9488_FONT_12_USE_EN )
-		{ (uint8_t*) &ili9488_font12_lut, 	7U, 	12U },
+		&g_font12,
 	#else
-		{ NULL, 0U, 0U },
+		NULL,
 	#endif
 
 	#if ( ILI9488_FONT_16_USE_EN )
-		{ (uint8_t*) &ili9488_font16_lut, 	11U, 	16U },
+		&g_font16,
 	#else
-		{ NULL, 0U, 0U },
+		NULL,
 	#endif
 
 	#if ( ILI9488_FONT_20_USE_EN )
-		{ (uint8_t*) &ili9488_font20_lut, 	14U, 	20U },
+		&g_font20,
 	#else
-		{ NULL, 0U, 0U },
+		NULL,
 	#endif
 
 	#if ( ILI9488_FONT_24_USE_EN )
-		{ (uint8_t*) &ili9488_font24_lut, 	17U, 	24U },
+		&g_font24,
 	#else
-		{ NULL, 0U, 0U },
+		NULL,
+	#endif
+
+	#if ( ILI9488_FONT_USER_NUM > 0 )
+		&ILI9488_FONT_USER_0,
+	#else
+		NULL,
+	#endif
+
+	#if ( ILI9488_FONT_USER_NUM > 1 )
+		&ILI9488_FONT_USER_1,
+	#else
+		NULL,
 	#endif
 
 };
@@ -8670,7 +8712,7 @@ static const ili9488_font_t g_fontList[ eILI9488_FONT_NUM_OF ] =
 *			Get font data
 *
 *	param: 		font_opt - Choosen font
-*	return:		p_font - Pointer to font data
+*	return:		p_font - Pointer to font data, NULL if font is disabled
 */
 //////////////////////////////////////////////////////////////
 const ili9488_font_t * ili9488_font_get(const ili9488_font_opt_t font_opt)
@@ -8679,7 +8721,7 @@ const ili9488_font_t * ili9488_font_get(const ili9488_font_opt_t font_opt)
 
 	if ( font_opt < eILI9488_FONT_NUM_OF )
 	{
-		p_font = &g_fontList[ font_opt ];
+		p_font = g_fontList[ font_opt ];
 	}
 	else
 	{
@@ -8706,7 +8748,7 @@ uint8_t	ili9488_font_get_width(const ili9488_font_opt_t font_opt)
 
 	if ( font_opt < eILI9488_FONT_NUM_OF )
 	{
-		width = g_fontList[ font_opt ].width;
+		width = (( NULL != g_fontList[ font_opt ] ) ? ( g_fontList[ font_opt ] -> width ) : ( 0U ));
 	}
 	else
 	{
@@ -8733,7 +8775,7 @@ uint8_t	ili9488_font_get_height(const ili9488_font_opt_t font_opt)
 
 	if ( font_opt < eILI9488_FONT_NUM_OF )
 	{
-		width = g_fontList[ font_opt ].height;
+		width = (( NULL != g_fontList[ font_opt ] ) ? ( g_fontList[ font_opt ] -> height ) : ( 0U ));
 	}
 	else
 	{
@@ -8746,6 +8788,244 @@ uint8_t	ili9488_font_get_height(const ili9488_font_opt_t font_opt)
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Get glyph of compiled font
+*
+*	param: 		p_font - Pointer to compiled font
+*	param: 		ch - Character
+*	return:		p_glyph - Pointer to glyph, NULL if character
+*				is not in font
+*/
+//////////////////////////////////////////////////////////////
+const ili9488_glyph_t * ili9488_font_get_glyph(const ili9488_font_t * const p_font, const char ch)
+{
+	const ili9488_glyph_t * p_glyph = NULL;
+
+	if 	(	((uint8_t) ch >= p_font -> first )
+		&&	(((uint8_t) ch - p_font -> first ) < p_font -> num ))
+	{
+		p_glyph = &p_font -> p_glyph[ (uint8_t) ch - p_font -> first ];
+	}
+
+	return p_glyph;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Start reading glyph data
+*
+*	param: 		p_font - Pointer to compiled font
+*	param: 		p_glyph - Pointer to glyph
+*	param: 		p_reader - Pointer to reader
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_font_glyph_start(const ili9488_font_t * const p_font, const ili9488_glyph_t * const p_glyph, ili9488_glyph_reader_t * const p_reader)
+{
+	p_reader -> p_data = &p_font -> p_data[ p_glyph -> offset ];
+	p_reader -> bpp = p_font -> bpp;
+	p_reader -> is_rle = p_font -> is_rle;
+	p_reader -> shift = 0;
+	p_reader -> left = 0;
+	p_reader -> token = ILI9488_GLYPH_TOKEN_PIX;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read next pixel of glyph
+*
+*	Packed pixels are MSB first. Packed pixels of token
+*	end on byte boundary.
+*
+*	param: 		p_reader - Pointer to reader
+*	return:		level - Pixel level, from 0 (background) to
+*				( 1 << bpp ) - 1 (foreground)
+*/
+//////////////////////////////////////////////////////////////
+uint8_t ili9488_font_glyph_read(ili9488_glyph_reader_t * const p_reader)
+{
+	const uint8_t max = (uint8_t)(( 1U << p_reader -> bpp ) - 1U );
+	uint8_t level;
+
+	// Next token
+	if (( true == p_reader -> is_rle ) && ( 0U == p_reader -> left ))
+	{
+		p_reader -> token = ( *p_reader -> p_data & 0xC0U );
+		p_reader -> left = (( *p_reader -> p_data & 0x3FU ) + 1U );
+		p_reader -> p_data++;
+	}
+
+	if ( ILI9488_GLYPH_TOKEN_BG == p_reader -> token )
+	{
+		level = 0U;
+	}
+	else if ( ILI9488_GLYPH_TOKEN_FG == p_reader -> token )
+	{
+		level = max;
+	}
+	else
+	{
+		p_reader -> shift += p_reader -> bpp;
+		level = (( *p_reader -> p_data >> ( 8U - p_reader -> shift )) & max );
+
+		if ( 8U == p_reader -> shift )
+		{
+			p_reader -> p_data++;
+			p_reader -> shift = 0;
+		}
+	}
+
+	if ( true == p_reader -> is_rle )
+	{
+		p_reader -> left--;
+
+		// Packed pixels of token end on byte boundary
+		if (( 0U == p_reader -> left ) && ( 0U != p_reader -> shift ))
+		{
+			p_reader -> p_data++;
+			p_reader -> shift = 0;
+		}
+	}
+
+	return level;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get kerning of character pair
+*
+*	param: 		p_font - Pointer to font
+*	param: 		left - Left character
+*	param: 		right - Right character
+*	return:		offset - Added to advance of left character
+*/
+//////////////////////////////////////////////////////////////
+int8_t ili9488_font_get_kerning(const ili9488_font_t * const p_font, const char left, const char right)
+{
+	const uint16_t key = (((uint16_t)(uint8_t) left << 8U ) | (uint8_t) right );
+	uint16_t pair;
+	uint32_t lo = 0;
+	uint32_t hi = p_font -> kern_num;
+	uint32_t mid;
+	int8_t offset = 0;
+
+	// Binary search over sorted pairs
+	while (( NULL != p_font -> p_kern ) && ( lo < hi ))
+	{
+		mid = (( lo + hi ) / 2U );
+		pair = (((uint16_t) p_font -> p_kern[ mid ].left << 8U ) | p_font -> p_kern[ mid ].right );
+
+		if ( pair < key )
+		{
+			lo = ( mid + 1U );
+		}
+		else if ( pair > key )
+		{
+			hi = mid;
+		}
+		else
+		{
+			offset = p_font -> p_kern[ mid ].offset;
+			break;
+		}
+	}
+
+	return offset;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get pen advance of character
+*
+*	Font lut and characters missing in compiled font
+*	advance for font width.
+*
+*	param: 		p_font - Pointer to font
+*	param: 		ch - Character
+*	param: 		next - Next character, for kerning
+*	return:		advance - Pen advance in pages, never negative
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_font_get_advance(const ili9488_font_t * const p_font, const char ch, const char next)
+{
+	const ili9488_glyph_t * p_glyph = NULL;
+	int32_t advance = p_font -> width;
+
+	if ( NULL != p_font -> p_glyph )
+	{
+		p_glyph = ili9488_font_get_glyph( p_font, ch );
+	}
+
+	if (( NULL != p_glyph ) && ( 0U != p_glyph -> advance ))
+	{
+		advance = ( p_glyph -> advance + ili9488_font_get_kerning( p_font, ch, next ));
+	}
+
+	return (( advance > 0 ) ? ((uint32_t) advance ) : ( 0U ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fit row of characters into width
+*
+*	Character fits when its advance and bounding box do.
+*
+*	param: 		p_font - Pointer to font
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		max_width - Available width in pages
+*	param: 		p_width - Width of characters that fit
+*	return:		fit - Number of characters that fit
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_font_fit_string(const ili9488_font_t * const p_font, const char * const p_chars, const uint32_t num, const uint32_t max_width, uint32_t * const p_width)
+{
+	const ili9488_glyph_t * p_glyph;
+	uint32_t pen = 0;
+	uint32_t end;
+	uint32_t fit;
+
+	*p_width = 0;
+
+	for ( fit = 0; fit < num; fit++ )
+	{
+		end = ( pen + p_font -> width );
+		p_glyph = NULL;
+
+		if ( NULL != p_font -> p_glyph )
+		{
+			p_glyph = ili9488_font_get_glyph( p_font, p_chars[ fit ] );
+		}
+
+		// Character ends with its advance or bounding box
+		if ( NULL != p_glyph )
+		{
+			end = ( pen + (( 0U != p_glyph -> advance ) ? ( p_glyph -> advance ) : ( p_font -> width )));
+
+			if (( pen + p_glyph -> page_ofs + p_glyph -> width ) > end )
+			{
+				end = ( pen + p_glyph -> page_ofs + p_glyph -> width );
+			}
+		}
+
+		if ( end > max_width )
+		{
+			break;
+		}
+
+		*p_width = (( end > *p_width ) ? ( end ) : ( *p_width ));
+		pen += ili9488_font_get_advance( p_font, p_chars[ fit ], ((( fit + 1U ) < num ) ? ( p_chars[ fit + 1U ] ) : ( '\0' )));
+	}
+
+	return fit;
+}
+
 
 //////////////////////////////////////////////////////////////
 // END OF FILE
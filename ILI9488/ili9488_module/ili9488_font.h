@@ -16,20 +16,75 @@
 //	INCLUDES
 //////////////////////////////////////////////////////////////
 #include "stdint.h"
+#include "stdbool.h"
 #include "ili9488.h"
 
 //////////////////////////////////////////////////////////////
 //	DEFINITIONS
 //////////////////////////////////////////////////////////////
 
+// Glyph of compiled font
+//
+// NOTE: Glyph data holds only pixels of bounding box, in
+// GRAM order, column running fastest. Pixels outside of
+// bounding box are background. Bounding box may reach over
+// advance into next character.
+typedef struct
+{
+	uint16_t	offset;		// Offset of glyph data
+	uint8_t		width;		// Bounding box width in pages
+	uint8_t		height;		// Bounding box height in columns
+	uint8_t		page_ofs;	// Bounding box offset from pen position
+	uint8_t		col_ofs;	// Bounding box offset from top of character cell
+	uint8_t		advance;	// Pen advance, 0 for font width
+} ili9488_glyph_t;
+
+// Kerning pair of compiled font
+//
+// NOTE: Pairs are sorted by left, then right character.
+typedef struct
+{
+	uint8_t		left;		// Left character
+	uint8_t		right;		// Right character
+	int8_t		offset;		// Added to advance of left character
+} ili9488_kern_t;
+
+// Glyph data tokens of run-length encoded font
+//
+//	00nnnnnn - n + 1 background pixels
+//	01nnnnnn - n + 1 foreground pixels
+//	10nnnnnn - n + 1 pixels follow, packed as in raw glyph
+#define ILI9488_GLYPH_TOKEN_BG		( 0x00U )
+#define ILI9488_GLYPH_TOKEN_FG		( 0x40U )
+#define ILI9488_GLYPH_TOKEN_PIX		( 0x80U )
+
 // Font
 typedef struct
 {
-	const uint8_t * p_font;	// Pointer to font lut
-	const uint8_t width;	// Font width
-	const uint8_t height;	// Font height
+	const uint8_t * p_font;				// Pointer to font lut
+	const uint8_t width;				// Font width
+	const uint8_t height;				// Font height
+	const ili9488_glyph_t * p_glyph;	// Glyph table of compiled font, NULL for font lut
+	const uint8_t * p_data;				// Glyph data of compiled font
+	const uint8_t bpp;					// Bits per pixel of compiled font, 1, 2 or 4
+	const bool is_rle;					// Glyph data run-length encoded
+	const uint8_t first;				// First character of glyph table
+	const uint8_t num;					// Number of glyphs
+	const ili9488_kern_t * p_kern;		// Kerning pairs, NULL for none
+	const uint16_t kern_num;			// Number of kerning pairs
 } ili9488_font_t;
 
+// Glyph data reader
+typedef struct
+{
+	const uint8_t *	p_data;		// Next data byte
+	uint8_t			bpp;		// Bits per pixel
+	uint8_t			shift;		// Bits already read from data byte
+	uint8_t			token;		// Current token
+	uint8_t			left;		// Pixels left in token
+	bool			is_rle;		// Data run-length encoded
+} ili9488_glyph_reader_t;
+
 
 //////////////////////////////////////////////////////////////
 //	VARIABLES
@@ -42,6 +97,12 @@ typedef struct
 const ili9488_font_t * 	ili9488_font_get		(const ili9488_font_opt_t font_opt);
 uint8_t					ili9488_font_get_width	(const ili9488_font_opt_t font_opt);
 uint8_t					ili9488_font_get_height	(const ili9488_font_opt_t font_opt);
+const ili9488_glyph_t *	ili9488_font_get_glyph	(const ili9488_font_t * const p_font, const char ch);
+void					ili9488_font_glyph_start(const ili9488_font_t * const p_font, const ili9488_glyph_t * const p_glyph, ili9488_glyph_reader_t * const p_reader);
+uint8_t					ili9488_font_glyph_read	(ili9488_glyph_reader_t * const p_reader);
+int8_t					ili9488_font_get_kerning(const ili9488_font_t * const p_font, const char left, const char right);
+uint32_t				ili9488_font_get_advance(const ili9488_font_t * const p_font, const char ch, const char next);
+uint32_t				ili9488_font_fit_string	(const ili9488_font_t * const p_font, const char * const p_chars, const uint32_t num, const uint32_t max_width, uint32_t * const p_width);
 
 //////////////////////////////////////////////////////////////
 // END OF FILE
@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_glyph_cache.h"
+#include "ili9488_config.h"
+
+#include <string.h>
+
+#if ( ILI9488_GLYPH_CACHE_EN )
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Check cache size
+#if (( ILI9488_GLYPH_CACHE_SIZE < 1 ) || ( ILI9488_GLYPH_CACHE_SIZE > 0xFFFF ) || ( ILI9488_GLYPH_CACHE_ENTRIES < 1 ))
+	#error "Glyph cache size out of range!"
+#endif
+
+// Cache entry
+typedef struct
+{
+	ili9488_glyph_key_t	key;
+	uint16_t			offset;		// Start of glyph in pool
+	uint16_t			size;		// Size of glyph in bytes
+	uint32_t			last_use;	// Time stamp of last use
+} ili9488_glyph_entry_t;
+
+// Glyph cache
+//
+// NOTE: Entries are kept in the same order as their data in
+// pool, therefore pool is compacted on every eviction and
+// free space is always at the end.
+typedef struct
+{
+	uint8_t					pool[ ILI9488_GLYPH_CACHE_SIZE ];
+	ili9488_glyph_entry_t	entry[ ILI9488_GLYPH_CACHE_ENTRIES ];
+	uint32_t				num;		// Number of entries
+	uint32_t				used;		// Used pool in bytes
+	uint32_t				tick;		// Time stamp for LRU
+	ili9488_glyph_cache_stats_t stats;
+} ili9488_glyph_cache_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Glyph cache
+static ili9488_glyph_cache_t g_glyph_cache;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static void ili9488_glyph_cache_evict	(const uint32_t idx);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get glyph from cache
+*
+*	param: 		p_key - Pointer to glyph key
+*	param: 		p_size - Size of encoded glyph in bytes
+*	return:		Pointer to encoded glyph, NULL on miss
+*/
+//////////////////////////////////////////////////////////////
+const uint8_t * ili9488_glyph_cache_get(const ili9488_glyph_key_t * const p_key, uint32_t * const p_size)
+{
+	const uint8_t * p_glyph = NULL;
+	ili9488_glyph_entry_t * p_entry;
+	uint32_t i;
+
+	for ( i = 0; i < g_glyph_cache.num; i++ )
+	{
+		p_entry = &g_glyph_cache.entry[i];
+
+		if 	(	( p_key -> ch == p_entry -> key.ch )
+			&&	( p_key -> font_opt == p_entry -> key.font_opt )
+			&&	( p_key -> fg_color == p_entry -> key.fg_color )
+			&&	( p_key -> bg_color == p_entry -> key.bg_color )
+			&&	( p_key -> format == p_entry -> key.format ))
+		{
+			p_entry -> last_use = ++g_glyph_cache.tick;
+			p_glyph = &g_glyph_cache.pool[ p_entry -> offset ];
+			*p_size = p_entry -> size;
+			break;
+		}
+	}
+
+	if ( NULL != p_glyph )
+	{
+		g_glyph_cache.stats.hits++;
+	}
+	else
+	{
+		g_glyph_cache.stats.misses++;
+	}
+
+	return p_glyph;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Allocate space for glyph
+*
+*	Least recently used glyphs are evicted until there is
+*	enough space. Caller must fill returned space with
+*	encoded glyph before next cache call.
+*
+*	param: 		p_key - Pointer to glyph key
+*	param: 		size - Size of encoded glyph in bytes
+*	return:		Pointer to glyph space, NULL if glyph is too big
+*/
+//////////////////////////////////////////////////////////////
+uint8_t * ili9488_glyph_cache_alloc(const ili9488_glyph_key_t * const p_key, const uint32_t size)
+{
+	uint8_t * p_glyph = NULL;
+	ili9488_glyph_entry_t * p_entry;
+	uint32_t i;
+	uint32_t lru;
+
+	if (( size > 0U ) && ( size <= ILI9488_GLYPH_CACHE_SIZE ))
+	{
+		// Make space
+		while 	(	( g_glyph_cache.num >= ILI9488_GLYPH_CACHE_ENTRIES )
+				||	(( g_glyph_cache.used + size ) > ILI9488_GLYPH_CACHE_SIZE ))
+		{
+			lru = 0;
+
+			for ( i = 1; i < g_glyph_cache.num; i++ )
+			{
+				if ( g_glyph_cache.entry[i].last_use < g_glyph_cache.entry[lru].last_use )
+				{
+					lru = i;
+				}
+			}
+
+			ili9488_glyph_cache_evict( lru );
+		}
+
+		// Append at the end
+		p_entry = &g_glyph_cache.entry[ g_glyph_cache.num ];
+		p_entry -> key = *p_key;
+		p_entry -> offset = g_glyph_cache.used;
+		p_entry -> size = size;
+		p_entry -> last_use = ++g_glyph_cache.tick;
+
+		g_glyph_cache.num++;
+		g_glyph_cache.used += size;
+
+		p_glyph = &g_glyph_cache.pool[ p_entry -> offset ];
+	}
+
+	return p_glyph;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove all glyphs from cache
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_clear(void)
+{
+	g_glyph_cache.num = 0;
+	g_glyph_cache.used = 0;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get cache statistics
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_get_stats(ili9488_glyph_cache_stats_t * const p_stats)
+{
+	*p_stats = g_glyph_cache.stats;
+
+	p_stats -> glyphs = g_glyph_cache.num;
+	p_stats -> used = g_glyph_cache.used;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset cache statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_glyph_cache_reset_stats(void)
+{
+	memset( &g_glyph_cache.stats, 0, sizeof( g_glyph_cache.stats ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Evict glyph from cache
+*
+*	Glyphs behind evicted one are moved down, so free space
+*	stays at the end of pool.
+*
+*	param: 		idx - Index of entry
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_glyph_cache_evict(const uint32_t idx)
+{
+	uint32_t i;
+	uint32_t end;
+	uint16_t size;
+
+	size = g_glyph_cache.entry[idx].size;
+	end = g_glyph_cache.entry[idx].offset + size;
+
+	// Compact pool
+	memmove( &g_glyph_cache.pool[ g_glyph_cache.entry[idx].offset ], &g_glyph_cache.pool[ end ], ( g_glyph_cache.used - end ));
+
+	// Remove entry
+	for ( i = idx; i < ( g_glyph_cache.num - 1U ); i++ )
+	{
+		g_glyph_cache.entry[i] = g_glyph_cache.entry[ i + 1U ];
+		g_glyph_cache.entry[i].offset -= size;
+	}
+
+	g_glyph_cache.num--;
+	g_glyph_cache.used -= size;
+	g_glyph_cache.stats.evictions++;
+}
+
+#endif // ILI9488_GLYPH_CACHE_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,57 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_GLYPH_CACHE_H_
+#define _ILI9488_GLYPH_CACHE_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488.h"
+#include "ili9488_low_if.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Glyph key
+typedef struct
+{
+	uint8_t					ch;			// Character
+	ili9488_font_opt_t		font_opt;	// Font
+	ili9488_color_t			fg_color;	// Foreground color
+	ili9488_color_t			bg_color;	// Background color
+	ili9488_pixel_format_t	format;		// Pixel format of encoded glyph
+} ili9488_glyph_key_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+const uint8_t *	ili9488_glyph_cache_get			(const ili9488_glyph_key_t * const p_key, uint32_t * const p_size);
+uint8_t *		ili9488_glyph_cache_alloc		(const ili9488_glyph_key_t * const p_key, const uint32_t size);
+void			ili9488_glyph_cache_clear		(void);
+void			ili9488_glyph_cache_get_stats	(ili9488_glyph_cache_stats_t * const p_stats);
+void			ili9488_glyph_cache_reset_stats	(void);
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
+
+#endif // _ILI9488_GLYPH_CACHE_H_
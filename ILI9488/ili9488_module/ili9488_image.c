@@ -0,0 +1,299 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_image.h"
+#include "ili9488_config.h"
+
+#if ( ILI9488_IMAGE_EN )
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Check window size
+#if (( ILI9488_IMAGE_LZ_WINDOW < 1 ) || ( ILI9488_IMAGE_LZ_WINDOW > 65536 ))
+	#error "Image LZ window size out of range!"
+#endif
+
+// Compressed stream
+//
+// NOTE: Pixels are stored in the same order as they are sent
+// to GRAM, page by page with column running fastest. Pixel
+// is 3 bytes: R, G, B. Stream is made of tokens, all lengths
+// and distances are stored decreased by one, high byte first:
+//
+//	0nnnnnnn						- n pixels follow
+//	1nnnnnnn nnnnnnnn RGB			- RLE: pixel repeated n times
+//	10nnnnnn nnnnnnnn RGB			- LZ: pixel repeated n times
+//	11nnnnnn nnnnnnnn dddddddd dddddddd
+//									- LZ: copy n pixels, starting
+//									  d pixels back
+#define ILI9488_IMAGE_TOKEN_COPY		( 0xC0U )
+#define ILI9488_IMAGE_TOKEN_RUN			( 0x80U )
+
+// Size of pixel in stream
+#define ILI9488_IMAGE_PIXEL_SIZE		( 3U )
+
+// Decoder
+typedef struct
+{
+	const uint8_t *			p_data;		// Next byte of stream
+	const uint8_t *			p_end;		// End of stream
+	pf_ili9488_image_put_t	pf_put;		// Output
+	uint32_t				pos;		// Number of decoded pixels
+	bool					is_lz;		// Decoded pixels are kept in window
+	ili9488_rgb_t			run;		// Pending run of output
+	uint32_t				run_size;
+} ili9488_image_decoder_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Last decoded pixels of LZ stream
+static ili9488_rgb_t g_window[ ILI9488_IMAGE_LZ_WINDOW ];
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_image_put	(ili9488_image_decoder_t * const p_dec, const ili9488_rgb_t * const p_rgb, const uint32_t size);
+static ili9488_status_t ili9488_image_flush	(ili9488_image_decoder_t * const p_dec);
+static ili9488_rgb_t	ili9488_image_read	(ili9488_image_decoder_t * const p_dec);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Decode compressed bitmap
+*
+*	Stream is decoded token by token and pixels are passed
+*	to output as runs of same color, so no RAM is needed
+*	for image itself. LZ stream keeps last decoded pixels
+*	in window of ILI9488_IMAGE_LZ_WINDOW pixels. Every token
+*	is checked to fit into stream size before it is read.
+*	Decoding stops at first error of output.
+*
+*	param: 		p_bitmap - Pointer to RLE or LZ bitmap
+*	param: 		pf_put - Output of decoded pixels
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_image_decode(const ili9488_bitmap_t * const p_bitmap, pf_ili9488_image_put_t pf_put)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_image_decoder_t dec;
+	ili9488_rgb_t rgb;
+	uint32_t num;
+	uint32_t size;
+	uint32_t dist;
+	uint32_t avail;
+	uint32_t len;
+	uint32_t i;
+	uint8_t token;
+
+	dec.p_data = p_bitmap -> p_data;
+	dec.p_end = &p_bitmap -> p_data[ p_bitmap -> size ];
+	dec.pf_put = pf_put;
+	dec.pos = 0;
+	dec.is_lz = ( eILI9488_BITMAP_LZ == p_bitmap -> format );
+	dec.run_size = 0;
+
+	num = ((uint32_t) p_bitmap -> width * p_bitmap -> height );
+
+	while (( dec.pos < num ) && ( eILI9488_OK == status ))
+	{
+		avail = (uint32_t)( dec.p_end - dec.p_data );
+		token = (( avail > 0U ) ? ( dec.p_data[0] ) : ( 0U ));
+		size = 0;
+		dist = 0;
+
+		// Bytes of token, together with its pixels
+		if ( token < ILI9488_IMAGE_TOKEN_RUN )
+		{
+			len = ( 1U + (( token + 1U ) * ILI9488_IMAGE_PIXEL_SIZE ));
+		}
+		else if (( true == dec.is_lz ) && ( token >= ILI9488_IMAGE_TOKEN_COPY ))
+		{
+			len = 4U;
+		}
+		else
+		{
+			len = ( 2U + ILI9488_IMAGE_PIXEL_SIZE );
+		}
+
+		if ( avail >= len )
+		{
+			dec.p_data++;
+
+			// Literal pixels
+			if ( token < ILI9488_IMAGE_TOKEN_RUN )
+			{
+				size = ( token + 1U );
+			}
+
+			// Run or copy
+			else
+			{
+				if (( true == dec.is_lz ) && ( token >= ILI9488_IMAGE_TOKEN_COPY ))
+				{
+					size = ((( token & 0x3FU ) << 8U ) | dec.p_data[0] ) + 1U;
+					dist = ((( dec.p_data[1] << 8U ) | dec.p_data[2] ) + 1U );
+					dec.p_data += 3U;
+				}
+				else
+				{
+					size = ((( token & (( true == dec.is_lz ) ? ( 0x3FU ) : ( 0x7FU ))) << 8U ) | dec.p_data[0] ) + 1U;
+					dec.p_data += 1U;
+				}
+			}
+		}
+
+		if 	(	( avail < len )
+			||	(( dec.pos + size ) > num )
+			||	( dist > dec.pos )
+			||	( dist > ILI9488_IMAGE_LZ_WINDOW ))
+		{
+			status = eILI9488_ERROR;
+			ILI9488_DBG_PRINT( "Image stream corrupted..." );
+			ILI9488_ASSERT( 0 );
+		}
+		else if ( token < ILI9488_IMAGE_TOKEN_RUN )
+		{
+			for ( i = 0; i < size; i++ )
+			{
+				rgb = ili9488_image_read( &dec );
+				status |= ili9488_image_put( &dec, &rgb, 1U );
+			}
+		}
+		else if ( dist > 0U )
+		{
+			// Copy might overlap pixels being written
+			for ( i = 0; i < size; i++ )
+			{
+				rgb = g_window[ ( dec.pos - dist ) % ILI9488_IMAGE_LZ_WINDOW ];
+				status |= ili9488_image_put( &dec, &rgb, 1U );
+			}
+		}
+		else
+		{
+			rgb = ili9488_image_read( &dec );
+			status |= ili9488_image_put( &dec, &rgb, size );
+		}
+	}
+
+	status |= ili9488_image_flush( &dec );
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put decoded pixels
+*
+*	Pixels are kept in window of LZ stream and joined with
+*	pending run if same color.
+*
+*	param: 		p_dec - Pointer to decoder
+*	param: 		p_rgb - Color of pixels
+*	param: 		size - Number of pixels
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_image_put(ili9488_image_decoder_t * const p_dec, const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint32_t i;
+
+	if ( true == p_dec -> is_lz )
+	{
+		// Only last pixels of long run stay in window
+		i = (( size > ILI9488_IMAGE_LZ_WINDOW ) ? ( size - ILI9488_IMAGE_LZ_WINDOW ) : ( 0U ));
+
+		for ( ; i < size; i++ )
+		{
+			g_window[ ( p_dec -> pos + i ) % ILI9488_IMAGE_LZ_WINDOW ] = *p_rgb;
+		}
+	}
+
+	p_dec -> pos += size;
+
+	if 	(	( p_dec -> run_size > 0U )
+		&&	(	( p_rgb -> R != p_dec -> run.R )
+			||	( p_rgb -> G != p_dec -> run.G )
+			||	( p_rgb -> B != p_dec -> run.B )))
+	{
+		status = ili9488_image_flush( p_dec );
+	}
+
+	p_dec -> run = *p_rgb;
+	p_dec -> run_size += size;
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Pass pending run to output
+*
+*	param: 		p_dec - Pointer to decoder
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_image_flush(ili9488_image_decoder_t * const p_dec)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	if ( p_dec -> run_size > 0U )
+	{
+		status = p_dec -> pf_put( &p_dec -> run, p_dec -> run_size );
+		p_dec -> run_size = 0;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read pixel from stream
+*
+*	param: 		p_dec - Pointer to decoder
+*	return:		rgb - Color of pixel
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_rgb_t ili9488_image_read(ili9488_image_decoder_t * const p_dec)
+{
+	ili9488_rgb_t rgb;
+
+	rgb.R = p_dec -> p_data[0];
+	rgb.G = p_dec -> p_data[1];
+	rgb.B = p_dec -> p_data[2];
+
+	p_dec -> p_data += ILI9488_IMAGE_PIXEL_SIZE;
+
+	return rgb;
+}
+
+#endif // ILI9488_IMAGE_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_IMAGE_H_
+#define _ILI9488_IMAGE_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488.h"
+#include "ili9488_low_if.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Output of decoded pixels
+//
+// NOTE: Called with runs of same colored pixels, in order
+// of compressed stream.
+typedef ili9488_status_t (*pf_ili9488_image_put_t)(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_image_decode	(const ili9488_bitmap_t * const p_bitmap, pf_ili9488_image_put_t pf_put);
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
+
+#endif // _ILI9488_IMAGE_H_
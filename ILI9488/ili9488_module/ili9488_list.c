@@ -0,0 +1,980 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488.h"
+#include "ili9488_render.h"
+#include "ili9488_config.h"
+
+#include <string.h>
+
+#if ( ILI9488_LIST_EN )
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Check display list setup
+#if ( 0 == ILI9488_RENDER_EN )
+	#error "Display list requires frame renderer (ILI9488_RENDER_EN)!"
+#endif
+
+#if (( ILI9488_LIST_ITEM_NUM < 1 ) || ( ILI9488_LIST_ITEM_NUM > 255 ) || ( ILI9488_LIST_TEXT_SIZE < 2 ))
+	#error "Display list setup out of range!"
+#endif
+
+// Item handle
+//
+// NOTE: Generation of slot is part of handle, so that
+// handle of removed item does not refer to its successor.
+#define ILI9488_LIST_HANDLE(slot,gen)		((ili9488_item_t) ((( gen ) << 8U ) | ( slot )))
+#define ILI9488_LIST_HANDLE_SLOT(item)		(( item ) & 0xFFU )
+#define ILI9488_LIST_HANDLE_GEN(item)		((( item ) >> 8U ) & 0xFFU )
+
+// Item types
+typedef enum
+{
+	eILI9488_LIST_RECT = 0,
+	eILI9488_LIST_CIRCLE,
+	eILI9488_LIST_TEXT,
+	eILI9488_LIST_BITMAP,
+} ili9488_list_type_t;
+
+// Item
+typedef struct
+{
+	ili9488_list_type_t			type;
+	ili9488_rect_attr_t			rect;
+	ili9488_circ_attr_t			circ;
+
+	// Text and bitmap
+	uint16_t					page;
+	uint16_t					col;
+	ili9488_color_t				fg_color;
+	ili9488_color_t				bg_color;
+	ili9488_font_opt_t			font_opt;
+	char						text[ ILI9488_LIST_TEXT_SIZE ];
+	const ili9488_bitmap_t *	p_bitmap;
+
+	uint8_t						z;			// Items with higher z are on top
+	uint8_t						gen;		// Generation of slot
+	bool						is_used;
+	bool						is_visible;
+} ili9488_list_item_t;
+
+// Display list
+typedef struct
+{
+	ili9488_list_item_t	item[ ILI9488_LIST_ITEM_NUM ];
+	uint8_t				order[ ILI9488_LIST_ITEM_NUM ];		// Slots from bottom to top
+	uint32_t			num;								// Number of items
+} ili9488_list_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Display list
+static ili9488_list_t g_list;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_status_t			ili9488_list_alloc		(const ili9488_list_type_t type, const uint8_t z, ili9488_list_item_t ** const pp_item, ili9488_item_t * const p_item);
+static ili9488_list_item_t *	ili9488_list_get_item	(const ili9488_item_t item);
+static void						ili9488_list_invalidate	(const ili9488_list_item_t * const p_item);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add rectangle to display list
+*
+*	param:		p_rect_attr - Pointer to rectangle attributes
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_rect(const ili9488_rect_attr_t * const p_rect_attr, const uint8_t z, ili9488_item_t * const p_item)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_new;
+
+	status = ili9488_list_alloc( eILI9488_LIST_RECT, z, &p_new, p_item );
+
+	if ( eILI9488_OK == status )
+	{
+		p_new -> rect = *p_rect_attr;
+		ili9488_list_invalidate( p_new );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add circle to display list
+*
+*	param:		p_circ_attr - Pointer to circle attributes
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_circle(const ili9488_circ_attr_t * const p_circ_attr, const uint8_t z, ili9488_item_t * const p_item)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_new;
+
+	status = ili9488_list_alloc( eILI9488_LIST_CIRCLE, z, &p_new, p_item );
+
+	if ( eILI9488_OK == status )
+	{
+		p_new -> circ = *p_circ_attr;
+		ili9488_list_invalidate( p_new );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add text to display list
+*
+*	param:		str 		- String, copied into item
+*	param:		page 		- Start page
+*	param:		col 		- Start column
+*	param:		fg_color 	- Foreground color
+*	param:		bg_color 	- Background color
+*	param:		font_opt 	- Font of choise
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_text(const char * const str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt, const uint8_t z, ili9488_item_t * const p_item)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_new;
+
+	if ( strlen( str ) < ILI9488_LIST_TEXT_SIZE )
+	{
+		status = ili9488_list_alloc( eILI9488_LIST_TEXT, z, &p_new, p_item );
+
+		if ( eILI9488_OK == status )
+		{
+			strcpy( p_new -> text, str );
+			p_new -> page = page;
+			p_new -> col = col;
+			p_new -> fg_color = fg_color;
+			p_new -> bg_color = bg_color;
+			p_new -> font_opt = font_opt;
+
+			ili9488_list_invalidate( p_new );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Display list text too long..." );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add bitmap to display list
+*
+*	NOTE: Bitmap is not copied, it must stay unchanged while
+*	item exists.
+*
+*	param:		p_bitmap 	- Pointer to bitmap
+*	param:		page 		- Start page
+*	param:		col 		- Start column
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col, const uint8_t z, ili9488_item_t * const p_item)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_new;
+
+	status = ili9488_list_alloc( eILI9488_LIST_BITMAP, z, &p_new, p_item );
+
+	if ( eILI9488_OK == status )
+	{
+		p_new -> p_bitmap = p_bitmap;
+		p_new -> page = page;
+		p_new -> col = col;
+
+		ili9488_list_invalidate( p_new );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove item from display list
+*
+*	param:		item 	- Handle of item
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_remove(const ili9488_item_t item)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+	uint32_t i;
+
+	p_item = ili9488_list_get_item( item );
+
+	if ( NULL != p_item )
+	{
+		ili9488_list_invalidate( p_item );
+
+		p_item -> is_used = false;
+		p_item -> gen++;
+
+		// Remove from order
+		for ( i = 0; i < g_list.num; i++ )
+		{
+			if ( ILI9488_LIST_HANDLE_SLOT( item ) == g_list.order[i] )
+			{
+				memmove( &g_list.order[i], &g_list.order[ i + 1U ], ( g_list.num - i - 1U ));
+				g_list.num--;
+				break;
+			}
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove all items from display list
+*
+*	param:		none
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_clear(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	while ( g_list.num > 0U )
+	{
+		status |= ili9488_list_remove( ILI9488_LIST_HANDLE( g_list.order[0], g_list.item[ g_list.order[0] ].gen ));
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Move item
+*
+*	Old and new area of item are redrawn on next refresh,
+*	nothing if position is the same.
+*
+*	NOTE: Circle is moved by its center, other items by
+*	their start.
+*
+*	param:		item 	- Handle of item
+*	param:		page 	- New page
+*	param:		col 	- New column
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_move(const ili9488_item_t item, const uint16_t page, const uint16_t col)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+	uint16_t * p_page;
+	uint16_t * p_col;
+
+	p_item = ili9488_list_get_item( item );
+
+	if ( NULL != p_item )
+	{
+		switch( p_item -> type )
+		{
+			case eILI9488_LIST_RECT:
+				p_page = &p_item -> rect.position.start_page;
+				p_col = &p_item -> rect.position.start_col;
+				break;
+
+			case eILI9488_LIST_CIRCLE:
+				p_page = &p_item -> circ.position.start_page;
+				p_col = &p_item -> circ.position.start_col;
+				break;
+
+			default:
+				p_page = &p_item -> page;
+				p_col = &p_item -> col;
+				break;
+		}
+
+		if (( page != *p_page ) || ( col != *p_col ))
+		{
+			ili9488_list_invalidate( p_item );
+
+			*p_page = page;
+			*p_col = col;
+
+			ili9488_list_invalidate( p_item );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Change color of item
+*
+*	Nothing is redrawn if colors are the same.
+*
+*	param:		item 			- Handle of item
+*	param:		color 			- Fill color, text foreground
+*	param:		second_color 	- Border color, text background
+*	return:		status 			- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_color(const ili9488_item_t item, const ili9488_color_t color, const ili9488_color_t second_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+	ili9488_color_t * p_color;
+	ili9488_color_t * p_second_color;
+
+	p_item = ili9488_list_get_item( item );
+
+	if (( NULL != p_item ) && ( eILI9488_LIST_BITMAP != p_item -> type ))
+	{
+		switch( p_item -> type )
+		{
+			case eILI9488_LIST_RECT:
+				p_color = &p_item -> rect.fill.color;
+				p_second_color = &p_item -> rect.border.color;
+				break;
+
+			case eILI9488_LIST_CIRCLE:
+				p_color = &p_item -> circ.fill.color;
+				p_second_color = &p_item -> circ.border.color;
+				break;
+
+			default:
+				p_color = &p_item -> fg_color;
+				p_second_color = &p_item -> bg_color;
+				break;
+		}
+
+		// Area stays the same
+		if (( color != *p_color ) || ( second_color != *p_second_color ))
+		{
+			*p_color = color;
+			*p_second_color = second_color;
+
+			ili9488_list_invalidate( p_item );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Change text of item
+*
+*	Nothing is redrawn if text is the same.
+*
+*	param:		item 	- Handle of text item
+*	param:		str 	- New string, copied into item
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_text(const ili9488_item_t item, const char * const str)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+
+	p_item = ili9488_list_get_item( item );
+
+	if 	(	( NULL != p_item )
+		&&	( eILI9488_LIST_TEXT == p_item -> type )
+		&&	( strlen( str ) < ILI9488_LIST_TEXT_SIZE ))
+	{
+		if ( 0 != strcmp( p_item -> text, str ))
+		{
+			ili9488_list_invalidate( p_item );
+			strcpy( p_item -> text, str );
+			ili9488_list_invalidate( p_item );
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Show or hide item
+*
+*	param:		item 	- Handle of item
+*	param:		visible - Show item
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_visible(const ili9488_item_t item, const bool visible)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+
+	p_item = ili9488_list_get_item( item );
+
+	if ( NULL != p_item )
+	{
+		if ( visible != p_item -> is_visible )
+		{
+			// Either old or new state is visible
+			p_item -> is_visible = true;
+			ili9488_list_invalidate( p_item );
+			p_item -> is_visible = visible;
+		}
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Redraw changed areas of display list
+*
+*	Visible items are rasterised in z order, but only areas
+*	invalidated by changes since previous refresh are sent to
+*	display. First refresh and refresh after orientation
+*	change redraw whole display.
+*
+*	NOTE: Display list owns the display, it must not be mixed
+*	with "ili9488_frame_begin" / "ili9488_frame_end".
+*
+*	param:		none
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_refresh(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_list_item_t * p_item;
+	uint32_t i;
+
+	if (( true == ili9488_is_init()) && ( false == ili9488_render_is_open()))
+	{
+		ili9488_render_begin( false );
+
+		for ( i = 0; i < g_list.num; i++ )
+		{
+			p_item = &g_list.item[ g_list.order[i] ];
+
+			if ( true == p_item -> is_visible )
+			{
+				switch( p_item -> type )
+				{
+					case eILI9488_LIST_RECT:
+						status |= ili9488_draw_rectangle( &p_item -> rect );
+						break;
+
+					case eILI9488_LIST_CIRCLE:
+						status |= ili9488_draw_circle( &p_item -> circ );
+						break;
+
+					case eILI9488_LIST_TEXT:
+						status |= ili9488_render_text( p_item -> text, strlen( p_item -> text ), p_item -> page, p_item -> col, p_item -> fg_color, p_item -> bg_color, p_item -> font_opt );
+						break;
+
+					case eILI9488_LIST_BITMAP:
+						status |= ili9488_render_bitmap( p_item -> p_bitmap, p_item -> page, p_item -> col );
+						break;
+
+					default:
+						status = eILI9488_ERROR;
+						ILI9488_ASSERT( 0 );
+						break;
+				}
+			}
+		}
+
+		status |= ili9488_render_end();
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Display list can not be refreshed!" );
+		ILI9488_ASSERT( 0 );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Allocate item
+*
+*	Item is placed on top of items with same or lower z.
+*
+*	param:		type 	- Type of item
+*	param:		z 		- Order of item
+*	param:		pp_item - Pointer to allocated item
+*	param:		p_item 	- Pointer to handle of allocated item
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_list_alloc(const ili9488_list_type_t type, const uint8_t z, ili9488_list_item_t ** const pp_item, ili9488_item_t * const p_item)
+{
+	ili9488_status_t status = eILI9488_ERROR;
+	ili9488_list_item_t * p_new;
+	uint8_t gen;
+	uint32_t slot;
+	uint32_t pos;
+
+	*p_item = ILI9488_ITEM_INVALID;
+
+	for ( slot = 0; slot < ILI9488_LIST_ITEM_NUM; slot++ )
+	{
+		if ( false == g_list.item[ slot ].is_used )
+		{
+			status = eILI9488_OK;
+			break;
+		}
+	}
+
+	if ( eILI9488_OK == status )
+	{
+		p_new = &g_list.item[ slot ];
+
+		gen = p_new -> gen;
+		memset( p_new, 0, sizeof( ili9488_list_item_t ));
+
+		p_new -> type = type;
+		p_new -> z = z;
+		p_new -> gen = gen;
+		p_new -> is_used = true;
+		p_new -> is_visible = true;
+
+		// Insert into order
+		for ( pos = g_list.num; pos > 0U; pos-- )
+		{
+			if ( g_list.item[ g_list.order[ pos - 1U ]].z <= z )
+			{
+				break;
+			}
+		}
+
+		memmove( &g_list.order[ pos + 1U ], &g_list.order[ pos ], ( g_list.num - pos ));
+		g_list.order[ pos ] = slot;
+		g_list.num++;
+
+		*pp_item = p_new;
+		*p_item = ILI9488_LIST_HANDLE( slot, gen );
+	}
+	else
+	{
+		ILI9488_DBG_PRINT( "Display list full..." );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get item from handle
+*
+*	param:		item 	- Handle of item
+*	return:		Pointer to item, NULL if handle is not valid
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_list_item_t * ili9488_list_get_item(const ili9488_item_t item)
+{
+	ili9488_list_item_t * p_item = NULL;
+
+	if 	(	( ILI9488_LIST_HANDLE_SLOT( item ) < ILI9488_LIST_ITEM_NUM )
+		&&	( true == g_list.item[ ILI9488_LIST_HANDLE_SLOT( item ) ].is_used )
+		&&	( ILI9488_LIST_HANDLE_GEN( item ) == g_list.item[ ILI9488_LIST_HANDLE_SLOT( item ) ].gen ))
+	{
+		p_item = &g_list.item[ ILI9488_LIST_HANDLE_SLOT( item ) ];
+	}
+	else
+	{
+		ILI9488_DBG_PRINT( "Display list item not valid..." );
+	}
+
+	return p_item;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Invalidate area of item
+*
+*	param:		p_item 	- Pointer to item
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_list_invalidate(const ili9488_list_item_t * const p_item)
+{
+	ili9488_region_t area;
+
+	if ( true == p_item -> is_visible )
+	{
+		switch( p_item -> type )
+		{
+			case eILI9488_LIST_RECT:
+				area.page = p_item -> rect.position.start_page;
+				area.col = p_item -> rect.position.start_col;
+				area.page_size = p_item -> rect.position.page_size;
+				area.col_size = p_item -> rect.position.col_size;
+				break;
+
+			case eILI9488_LIST_CIRCLE:
+				ili9488_render_get_circle_area( p_item -> circ.position.start_page, p_item -> circ.position.start_col, p_item -> circ.position.radius, &area );
+				break;
+
+			case eILI9488_LIST_TEXT:
+				ili9488_render_get_text_area( p_item -> text, strlen( p_item -> text ), p_item -> page, p_item -> col, p_item -> font_opt, &area );
+				break;
+
+			case eILI9488_LIST_BITMAP:
+			default:
+				area.page = p_item -> page;
+				area.col = p_item -> col;
+				area.page_size = p_item -> p_bitmap -> width;
+				area.col_size = p_item -> p_bitmap -> height;
+				break;
+		}
+
+		(void) ili9488_render_invalidate( area.page, area.col, area.page_size, area.col_size );
+	}
+}
+
+#else
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_list_disabled(void);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add rectangle to display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		p_rect_attr - Pointer to rectangle attributes
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_rect(const ili9488_rect_attr_t * const p_rect_attr, const uint8_t z, ili9488_item_t * const p_item)
+{
+	(void) p_rect_attr;
+	(void) z;
+	(void) p_item;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add circle to display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		p_circ_attr - Pointer to circle attributes
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_circle(const ili9488_circ_attr_t * const p_circ_attr, const uint8_t z, ili9488_item_t * const p_item)
+{
+	(void) p_circ_attr;
+	(void) z;
+	(void) p_item;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add text to display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		str 		- String, copied into item
+*	param:		page 		- Start page
+*	param:		col 		- Start column
+*	param:		fg_color 	- Foreground color
+*	param:		bg_color 	- Background color
+*	param:		font_opt 	- Font of choise
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_text(const char * const str, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt, const uint8_t z, ili9488_item_t * const p_item)
+{
+	(void) str;
+	(void) page;
+	(void) col;
+	(void) fg_color;
+	(void) bg_color;
+	(void) font_opt;
+	(void) z;
+	(void) p_item;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add bitmap to display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		p_bitmap 	- Pointer to bitmap
+*	param:		page 		- Start page
+*	param:		col 		- Start column
+*	param:		z 			- Order of item, higher is on top
+*	param:		p_item 		- Pointer to handle of added item
+*	return:		status 		- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_add_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col, const uint8_t z, ili9488_item_t * const p_item)
+{
+	(void) p_bitmap;
+	(void) page;
+	(void) col;
+	(void) z;
+	(void) p_item;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove item from display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		item 	- Handle of item
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_remove(const ili9488_item_t item)
+{
+	(void) item;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove all items from display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		none
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_clear(void)
+{
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Move item
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		item 	- Handle of item
+*	param:		page 	- New page
+*	param:		col 	- New column
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_move(const ili9488_item_t item, const uint16_t page, const uint16_t col)
+{
+	(void) item;
+	(void) page;
+	(void) col;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Change color of item
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		item 			- Handle of item
+*	param:		color 			- Fill color, text foreground
+*	param:		second_color 	- Border color, text background
+*	return:		status 			- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_color(const ili9488_item_t item, const ili9488_color_t color, const ili9488_color_t second_color)
+{
+	(void) item;
+	(void) color;
+	(void) second_color;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Change text of item
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		item 	- Handle of text item
+*	param:		str 	- New string, copied into item
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_text(const ili9488_item_t item, const char * const str)
+{
+	(void) item;
+	(void) str;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Show or hide item
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		item 	- Handle of item
+*	param:		visible - Show item
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_set_visible(const ili9488_item_t item, const bool visible)
+{
+	(void) item;
+	(void) visible;
+
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Redraw changed areas of display list
+*
+*	Display list is disabled (ILI9488_LIST_EN).
+*
+*	param:		none
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_list_refresh(void)
+{
+	return ili9488_list_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report disabled display list
+*
+*	param:		none
+*	return:		status 	- Always Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_list_disabled(void)
+{
+	ILI9488_DBG_PRINT( "Display list not enabled..." );
+
+	return eILI9488_ERROR;
+}
+
+#endif // ILI9488_LIST_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -11,11 +11,15 @@
 //////////////////////////////////////////////////////////////
 //	INCLUDES
 //////////////////////////////////////////////////////////////
-#include "stm32f7xx_hal.h"
-
 #include "ili9488_low_if.h"
 #include "ili9488_config.h"
 
+#include <string.h>
+
+#if ( ILI9488_HAL_TRANSPORT_EN )
+	#include "stm32f7xx_hal.h"
+#endif
+
 
 
 //////////////////////////////////////////////////////////////
@@ -23,81 +27,862 @@
 //////////////////////////////////////////////////////////////
 
 // CS
-#define ILI9488_LOW_IF_CS_LOW()			( HAL_GPIO_WritePin( ILI9488_CS__PORT, ILI9488_CS__PIN, GPIO_PIN_RESET ))
-#define ILI9488_LOW_IF_CS_HIGH()		( HAL_GPIO_WritePin( ILI9488_CS__PORT, ILI9488_CS__PIN, GPIO_PIN_SET ))
+#define ILI9488_LOW_IF_CS_LOW()			( gp_transport -> pf_set_cs( false ))
+#define ILI9488_LOW_IF_CS_HIGH()		( gp_transport -> pf_set_cs( true ))
 
 // DC
-#define ILI9488_LOW_IF_DC_COMMAND()		( HAL_GPIO_WritePin( ILI9488_DC__PORT, ILI9488_DC__PIN, GPIO_PIN_RESET ))
-#define ILI9488_LOW_IF_DC_DATA()		( HAL_GPIO_WritePin( ILI9488_DC__PORT, ILI9488_DC__PIN, GPIO_PIN_SET ))
-
-// SPI interface status
-typedef enum
+#define ILI9488_LOW_IF_DC_COMMAND()		( gp_transport -> pf_set_dc( false ))
+#define ILI9488_LOW_IF_DC_DATA()		( gp_transport -> pf_set_dc( true ))
+
+// GRAM line buffer size in bytes
+#define ILI9488_LOW_IF_GRAM_BUF_SIZE	( 3U * ILI9488_GRAM_BUF_SIZE_PX )
+
+// Check line buffer size
+#if (( ILI9488_GRAM_BUF_SIZE_PX < 1 ) || ( ILI9488_LOW_IF_GRAM_BUF_SIZE > 0xFFFFU ))
+	#error "ILI9488_GRAM_BUF_SIZE_PX out of range! Single SPI transfer is limited to 65535 bytes..."
+#endif
+
+// 3-bit pixel code (D2: red, D1: green, D0: blue)
+// NOTE: Channel is set if its MSB is set.
+#define ILI9488_LOW_IF_RGB_TO_3_BIT(p_rgb)	(	((( p_rgb ) -> R >> 5U ) & 0x04U )	\
+											|	((( p_rgb ) -> G >> 6U ) & 0x02U )	\
+											|	((( p_rgb ) -> B >> 7U ) & 0x01U ))
+
+// Number of GRAM line buffers
+// NOTE: With non-blocking transport buffers are used as
+// ping-pong pair, one is on the wire while the other one is
+// being filled.
+#if ( ILI9488_SPI_DMA_EN || ILI9488_EMU_EN )
+	#define ILI9488_LOW_IF_GRAM_BUF_NUM		( 2U )
+#else
+	#define ILI9488_LOW_IF_GRAM_BUF_NUM		( 1U )
+#endif
+
+// GRAM transfer
+typedef struct
 {
-	eILI9488_SPI_OK = 0,
-	eILI9488_SPI_ERROR,
-} ili9488_spi_status_t;
+	const uint8_t * p_data;		// Pointer to burst data
+	uint32_t		size;		// Size of burst in bytes
+	uint32_t		repeat;		// Number of bursts left
+	bool			end;		// Release CS after last burst
+	bool			is_error;	// Chained burst failed, not yet reported
+} ili9488_gram_tx_t;
+
+// GRAM stream
+typedef struct
+{
+	uint8_t		buf[ ILI9488_LOW_IF_GRAM_BUF_NUM ][ ILI9488_LOW_IF_GRAM_BUF_SIZE ];
+	uint8_t		active;		// Buffer being filled
+	uint32_t	fill;		// Number of bytes in active buffer
 
-// Spi functions
-typedef ili9488_spi_status_t (*pf_spi_tx_t) (const uint8_t * p_data, const uint32_t size);
-typedef ili9488_spi_status_t (*pf_spi_rx_t) (uint8_t * const p_data, const uint32_t size);
+	// 3-bit format packs two pixels in one byte
+	uint8_t		first;		// First pixel of stream
+	uint8_t		pend;		// Pixel waiting for its pair
+	bool		is_pend;
+	bool		has_first;
+} ili9488_gram_stream_t;
 
 
 //////////////////////////////////////////////////////////////
 //	VARIABLES
 //////////////////////////////////////////////////////////////
 
-// Pointer to SPI functions
-static pf_spi_tx_t gpf_spi_transmit;
-static pf_spi_rx_t gpf_spi_receive;
+// Transport in use
+static const ili9488_transport_t * gp_transport;
+
+#if ( ILI9488_HAL_TRANSPORT_EN )
+
+	// LED PWM timer
+	static TIM_HandleTypeDef gh_led_timer;
+
+	// SPI handler
+	static SPI_HandleTypeDef gh_display_spi;
+
+	#if ( ILI9488_SPI_DMA_EN )
+
+		// SPI TX DMA handler
+		static DMA_HandleTypeDef gh_display_dma;
+
+	#endif
+
+#endif
+
+// GRAM stream
+static ili9488_gram_stream_t g_gram_stream;
+
+// Pixel format of GRAM data
+static ili9488_pixel_format_t g_pixel_format = eILI9488_PIXEL_FORMAT_18_BIT;
 
-// LED PWM timer
-static TIM_HandleTypeDef gh_led_timer;
+// GRAM transfer in progress
+static volatile ili9488_gram_tx_t g_gram_tx;
+static volatile bool gb_is_busy;
 
-// SPI handler
-static SPI_HandleTypeDef gh_display_spi;
+// Transfer complete callback
+static pf_ili9488_tx_cplt_cb_t gpf_tx_cplt_cb;
 
 
 //////////////////////////////////////////////////////////////
 // FUNCTION PROTOTYPES
 //////////////////////////////////////////////////////////////
-static void				ili9488_low_if_gpio_init	(void);
-static ili9488_status_t ili9488_low_if_timer_init	(void);
-static ili9488_status_t ili9488_low_if_spi_init		(void);
+static ili9488_status_t ili9488_low_if_gram_transmit	(const uint8_t * const p_data, const uint32_t size, const uint32_t repeat, const bool end);
+static ili9488_status_t ili9488_low_if_gram_flush		(const bool end);
+
+#if ( ILI9488_HAL_TRANSPORT_EN )
+
+	static ili9488_status_t ili9488_low_if_hal_init			(void);
+	static void				ili9488_low_if_gpio_init		(void);
+	static ili9488_status_t ili9488_low_if_timer_init		(void);
+	static ili9488_status_t ili9488_low_if_spi_init			(void);
+
+	static ili9488_spi_status_t ili9488_low_if_spi_transmit (const uint8_t * p_data, const uint32_t size);
+	static ili9488_spi_status_t ili9488_low_if_spi_receive 	(uint8_t * const p_data, const uint32_t size);
+
+	static void				ili9488_low_if_hal_set_cs		(const bool state);
+	static void				ili9488_low_if_hal_set_dc		(const bool state);
+	static void				ili9488_low_if_hal_set_reset	(const bool state);
+	static ili9488_status_t	ili9488_low_if_hal_set_led		(const float32_t brightness);
+	static void				ili9488_low_if_hal_delay_ms		(const uint32_t ms);
+
+	#if ( ILI9488_SPI_DMA_EN )
+		static ili9488_status_t 	ili9488_low_if_dma_init				(void);
+		static ili9488_spi_status_t ili9488_low_if_spi_transmit_dma 	(const uint8_t * p_data, const uint32_t size);
+	#endif
+
+	// STM32 HAL transport
+	static const ili9488_transport_t g_hal_transport =
+	{
+		.pf_init			= &ili9488_low_if_hal_init,
+		.pf_transmit		= &ili9488_low_if_spi_transmit,
+
+		#if ( ILI9488_SPI_DMA_EN )
+			.pf_transmit_async	= &ili9488_low_if_spi_transmit_dma,
+		#else
+			.pf_transmit_async	= NULL,
+		#endif
+
+		.pf_receive			= &ili9488_low_if_spi_receive,
+		.pf_set_cs			= &ili9488_low_if_hal_set_cs,
+		.pf_set_dc			= &ili9488_low_if_hal_set_dc,
+		.pf_set_reset		= &ili9488_low_if_hal_set_reset,
+		.pf_set_led			= &ili9488_low_if_hal_set_led,
+		.pf_delay_ms		= &ili9488_low_if_hal_delay_ms,
+	};
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS 
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Low level initialization
+*
+*	param: 		none
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_init(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Use STM32 HAL transport by default
+	#if ( ILI9488_HAL_TRANSPORT_EN )
+		if ( NULL == gp_transport )
+		{
+			gp_transport = &g_hal_transport;
+		}
+	#endif
+
+	// Check transport
+	if ( NULL == gp_transport )
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Transport not set..." );
+		ILI9488_ASSERT( 0 );
+	}
+
+	// Init transport
+	else if ( NULL != gp_transport -> pf_init )
+	{
+		if ( eILI9488_OK != gp_transport -> pf_init())
+		{
+			status = eILI9488_ERROR;
+		}
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set transport
+*
+*	Must be called before "ili9488_low_if_init". If never
+*	called STM32 HAL transport is used.
+*
+*	param: 		p_transport - Pointer to transport interface
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_set_transport(const ili9488_transport_t * const p_transport)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Check mandatory functions
+	if 	(	( NULL == p_transport )
+		||	( NULL == p_transport -> pf_transmit )
+		||	( NULL == p_transport -> pf_receive )
+		||	( NULL == p_transport -> pf_set_cs )
+		||	( NULL == p_transport -> pf_set_dc )
+		||	( NULL == p_transport -> pf_set_reset )
+		||	( NULL == p_transport -> pf_set_led )
+		||	( NULL == p_transport -> pf_delay_ms ))
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Invalid transport..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		status |= ili9488_low_if_wait();
+		gp_transport = p_transport;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write to LCD register
+*
+*	If sending only command, size shall be 0. Add size only
+*	for data bytes.
+*
+*
+*	param: 		cmd - command name
+*	param: 		tx_data - pointer to transmit data
+*	param: 		size - number of data to transmit
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_write_register(const ili9488_cmd_t cmd, const uint8_t * const tx_data, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint8_t command = cmd;
+
+	// Check if transport is set
+	if ( NULL == gp_transport )
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Transport not set..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Wait for GRAM transfer to finish
+		status |= ili9488_low_if_wait();
+
+		// Set CS & DC
+		ILI9488_LOW_IF_CS_LOW();
+		ILI9488_LOW_IF_DC_COMMAND();
+
+		// Send command
+		if ( eILI9488_SPI_OK != gp_transport -> pf_transmit( &command, 1U ))
+		{
+			status = eILI9488_ERROR;
+		}
+
+		// Command send OK
+		else
+		{
+			// In case of parameters send them as well
+			if ( size > 0 )
+			{
+				// Data transmit
+				ILI9488_LOW_IF_DC_DATA();
+
+				if ( eILI9488_SPI_OK != gp_transport -> pf_transmit((uint8_t*) tx_data, size ))
+				{
+					status = eILI9488_ERROR;
+				}
+			}
+		}
+
+		// Set CS
+		ILI9488_LOW_IF_CS_HIGH();
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set pixel format of GRAM data
+*
+*	NOTE: Only tells low level interface how to encode pixels,
+*	display must be switched to same format separately.
+*
+*	param: 		format - Pixel format
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_set_pixel_format(const ili9488_pixel_format_t format)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	status |= ili9488_low_if_wait();
+
+	g_pixel_format = format;
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get pixel format of GRAM data
+*
+*	param: 		none
+*	return:		format - Pixel format
+*/
+//////////////////////////////////////////////////////////////
+ili9488_pixel_format_t ili9488_low_if_get_pixel_format(void)
+{
+	return g_pixel_format;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write to RGB code to GRAM
+*
+*	This function writes constant RGB code and write size
+*	number pixels.
+*
+*	RGB code is first expanded into GRAM line buffer and
+*	then buffer is transmitted in bursts until all pixels
+*	are written. In DMA mode function returns as soon as
+*	first burst is started.
+*
+*	In 3-bit format odd number of pixels is padded with one
+*	more pixel of same color. It wraps to start of window,
+*	which is already of that color.
+*
+*	param: 		rgb - pointer to rgb code
+*	param: 		size - number of data to transmit
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_write_rgb_to_gram (const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint32_t i;
+	uint32_t bytes;
+	uint32_t chunk;
+	uint32_t bursts;
+	uint32_t rest;
+	uint8_t * p_buf;
+	uint8_t code;
+
+	// Start memory write
+	status = ili9488_low_if_gram_start();
+
+	if ( eILI9488_OK == status )
+	{
+		if ( size > 0 )
+		{
+			// Expand color into line buffer
+			p_buf = (uint8_t*) &g_gram_stream.buf[ g_gram_stream.active ];
+
+			if ( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format )
+			{
+				code = ILI9488_LOW_IF_RGB_TO_3_BIT( p_rgb );
+				bytes = (( size + 1U ) / 2U );
+				chunk = (( bytes < ILI9488_LOW_IF_GRAM_BUF_SIZE ) ? ( bytes ) : ( ILI9488_LOW_IF_GRAM_BUF_SIZE ));
+
+				memset( p_buf, (( code << 3U ) | code ), chunk );
+			}
+			else
+			{
+				bytes = ( 3U * size );
+				chunk = (( bytes < ILI9488_LOW_IF_GRAM_BUF_SIZE ) ? ( bytes ) : ( ILI9488_LOW_IF_GRAM_BUF_SIZE ));
+
+				for ( i = 0; i < chunk; i += 3U )
+				{
+					p_buf[ i + 0U ] = p_rgb -> R;
+					p_buf[ i + 1U ] = p_rgb -> G;
+					p_buf[ i + 2U ] = p_rgb -> B;
+				}
+			}
+
+			// Stream whole line buffer as many times as possible
+			bursts = ( bytes / ILI9488_LOW_IF_GRAM_BUF_SIZE );
+			rest = ( bytes % ILI9488_LOW_IF_GRAM_BUF_SIZE );
+
+			if ( bursts > 0U )
+			{
+				status |= ili9488_low_if_gram_transmit( p_buf, ILI9488_LOW_IF_GRAM_BUF_SIZE, bursts, ( 0U == rest ));
+			}
+
+			// Stream the rest
+			if ( rest > 0U )
+			{
+				status |= ili9488_low_if_gram_transmit( p_buf, rest, 1U, true );
+			}
+
+			// Buffer is now on the wire
+			g_gram_stream.active = (( g_gram_stream.active + 1U ) % ILI9488_LOW_IF_GRAM_BUF_NUM );
+			g_gram_stream.fill = 0U;
+		}
+		else
+		{
+			status |= ili9488_low_if_gram_end();
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Start GRAM write stream
+*
+*	Sends memory write command and leaves CS asserted. Pixels
+*	are then added with "ili9488_low_if_gram_put" and stream
+*	must be closed with "ili9488_low_if_gram_end".
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_gram_start(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+	const uint8_t cmd = eILI9488_WRITE_MEM_CMD;
+
+	// Check if transport is set
+	if ( NULL == gp_transport )
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "Transport not set..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		// Wait for previous transfer to finish
+		status |= ili9488_low_if_wait();
+
+		// Set CS & DC
+		ILI9488_LOW_IF_CS_LOW();
+		ILI9488_LOW_IF_DC_COMMAND();
+
+		// Send command
+		if ( eILI9488_SPI_OK != gp_transport -> pf_transmit((uint8_t*) &cmd, 1U ))
+		{
+			status = eILI9488_ERROR;
+			ILI9488_LOW_IF_CS_HIGH();
+		}
+		else
+		{
+			// Pixel data follows
+			ILI9488_LOW_IF_DC_DATA();
+
+			g_gram_stream.fill = 0U;
+			g_gram_stream.is_pend = false;
+			g_gram_stream.has_first = false;
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put pixels to GRAM write stream
+*
+*	Color is added size times into line buffer. When buffer
+*	gets full it is transmitted.
+*
+*	param: 		p_rgb - pointer to rgb code
+*	param: 		size - number of pixels
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_gram_put(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint32_t i;
+	uint8_t * p_buf;
+	uint8_t code;
+
+	// Two pixels per byte
+	if ( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format )
+	{
+		code = ILI9488_LOW_IF_RGB_TO_3_BIT( p_rgb );
+
+		if (( false == g_gram_stream.has_first ) && ( size > 0U ))
+		{
+			g_gram_stream.first = code;
+			g_gram_stream.has_first = true;
+		}
+
+		for ( i = 0; ( i < size ) && ( eILI9488_OK == status ); i++ )
+		{
+			if ( false == g_gram_stream.is_pend )
+			{
+				g_gram_stream.pend = code;
+				g_gram_stream.is_pend = true;
+			}
+			else
+			{
+				g_gram_stream.buf[ g_gram_stream.active ][ g_gram_stream.fill ] = (( g_gram_stream.pend << 3U ) | code );
+				g_gram_stream.fill++;
+				g_gram_stream.is_pend = false;
+
+				// Buffer full
+				if ( g_gram_stream.fill >= ILI9488_LOW_IF_GRAM_BUF_SIZE )
+				{
+					status = ili9488_low_if_gram_flush( false );
+				}
+			}
+		}
+	}
+	else
+	{
+		for ( i = 0; ( i < size ) && ( eILI9488_OK == status ); i++ )
+		{
+			p_buf = &g_gram_stream.buf[ g_gram_stream.active ][ g_gram_stream.fill ];
+
+			p_buf[0] = p_rgb -> R;
+			p_buf[1] = p_rgb -> G;
+			p_buf[2] = p_rgb -> B;
+
+			g_gram_stream.fill += 3U;
+
+			// Buffer full
+			if ( g_gram_stream.fill >= ILI9488_LOW_IF_GRAM_BUF_SIZE )
+			{
+				status = ili9488_low_if_gram_flush( false );
+			}
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put encoded pixels to GRAM write stream
+*
+*	Data must already be in current pixel format. In 3-bit
+*	format stream must be on byte boundary.
+*
+*	param: 		p_data - Pointer to encoded pixels
+*	param: 		size - Size of data in bytes
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_gram_put_raw(const uint8_t * const p_data, const uint32_t size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	uint32_t done = 0;
+	uint32_t chunk;
+
+	if ( true == g_gram_stream.is_pend )
+	{
+		status = eILI9488_ERROR;
+
+		ILI9488_DBG_PRINT( "GRAM stream not aligned..." );
+		ILI9488_ASSERT( 0 );
+	}
+	else
+	{
+		if (( false == g_gram_stream.has_first ) && ( size > 0U ))
+		{
+			g_gram_stream.first = (( p_data[0] >> 3U ) & 0x07U );
+			g_gram_stream.has_first = true;
+		}
+
+		while (( done < size ) && ( eILI9488_OK == status ))
+		{
+			chunk = ( ILI9488_LOW_IF_GRAM_BUF_SIZE - g_gram_stream.fill );
+			chunk = ((( size - done ) < chunk ) ? ( size - done ) : ( chunk ));
+
+			memcpy( &g_gram_stream.buf[ g_gram_stream.active ][ g_gram_stream.fill ], &p_data[ done ], chunk );
+			g_gram_stream.fill += chunk;
+			done += chunk;
+
+			// Buffer full
+			if ( g_gram_stream.fill >= ILI9488_LOW_IF_GRAM_BUF_SIZE )
+			{
+				status = ili9488_low_if_gram_flush( false );
+			}
+		}
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get size of encoded pixels
+*
+*	param: 		size - Number of pixels
+*	return:		Size in bytes for current pixel format
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_low_if_gram_bytes(const uint32_t size)
+{
+	return (( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format ) ? (( size + 1U ) / 2U ) : ( 3U * size ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Encode pixels in current pixel format
+*
+*	Color is encoded size times into buffer, starting at
+*	pixel position offset. Buffer can later be streamed
+*	with "ili9488_low_if_gram_put_raw".
+*
+*	param: 		p_rgb - pointer to rgb code
+*	param: 		size - Number of pixels
+*	param: 		p_buf - Pointer to buffer
+*	param: 		offset - Position of first pixel in buffer
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_low_if_encode_rgb(const ili9488_rgb_t * const p_rgb, const uint32_t size, uint8_t * const p_buf, const uint32_t offset)
+{
+	uint32_t i;
+	uint8_t code;
+
+	if ( eILI9488_PIXEL_FORMAT_3_BIT == g_pixel_format )
+	{
+		code = ILI9488_LOW_IF_RGB_TO_3_BIT( p_rgb );
+
+		for ( i = offset; i < ( offset + size ); i++ )
+		{
+			if ( 0U == ( i % 2U ))
+			{
+				p_buf[ i / 2U ] = ( code << 3U );
+			}
+			else
+			{
+				p_buf[ i / 2U ] |= code;
+			}
+		}
+	}
+	else
+	{
+		for ( i = offset; i < ( offset + size ); i++ )
+		{
+			p_buf[ ( 3U * i ) + 0U ] = p_rgb -> R;
+			p_buf[ ( 3U * i ) + 1U ] = p_rgb -> G;
+			p_buf[ ( 3U * i ) + 2U ] = p_rgb -> B;
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			End GRAM write stream
+*
+*	Transmits what is left in line buffer and releases CS.
+*	In DMA mode CS is released from transfer complete
+*	interrupt.
+*
+*	In 3-bit format unpaired last pixel is padded with
+*	first pixel of stream. When stream fills whole window
+*	padding wraps to start of window and rewrites it with
+*	the same color.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_gram_end(void)
+{
+	if ( true == g_gram_stream.is_pend )
+	{
+		g_gram_stream.buf[ g_gram_stream.active ][ g_gram_stream.fill ] = (( g_gram_stream.pend << 3U ) | g_gram_stream.first );
+		g_gram_stream.fill++;
+		g_gram_stream.is_pend = false;
+	}
+
+	return ili9488_low_if_gram_flush( true );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get GRAM transfer status
+*
+*	param: 		none
+*	return:		true if transfer is in progress
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_low_if_is_busy(void)
+{
+	return gb_is_busy;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Wait for GRAM transfer to finish
+*
+*	Failure of burst chained from interrupt is reported
+*	here, once.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_low_if_wait(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	while ( true == gb_is_busy )
+	{
+		// Wait...
+	}
+
+	if ( true == g_gram_tx.is_error )
+	{
+		g_gram_tx.is_error = false;
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set GRAM transfer complete callback
+*
+*	NOTE: In DMA mode callback is called from interrupt!
+*
+*	param: 		pf_cb - Pointer to callback, NULL to disable
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_low_if_set_tx_cplt_cb(const pf_ili9488_tx_cplt_cb_t pf_cb)
+{
+	gpf_tx_cplt_cb = pf_cb;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			DMA interrupt handler
+*
+*	Must be called from ILI9488_SPI_DMA_IRQ interrupt routine.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_low_if_dma_hndl(void)
+{
+	#if ( ILI9488_HAL_TRANSPORT_EN && ILI9488_SPI_DMA_EN )
 
-static ili9488_spi_status_t ili9488_low_if_spi_transmit (const uint8_t * p_data, const uint32_t size);
-static ili9488_spi_status_t ili9488_low_if_spi_receive 	(uint8_t * const p_data, const uint32_t size);
+		HAL_DMA_IRQHandler( &gh_display_dma );
 
+		// Burst finished
+		if 	(	( true == gb_is_busy )
+			&&	( HAL_SPI_STATE_READY == HAL_SPI_GetState( &gh_display_spi )))
+		{
+			ili9488_low_if_tx_cplt_hndl();
+		}
 
-//////////////////////////////////////////////////////////////
-// FUNCTIONS 
-//////////////////////////////////////////////////////////////
+	#endif
+}
 
 
 //////////////////////////////////////////////////////////////
 /*
-*			Low level initialization
+*			Transmit GRAM data
 *
-*	param: 		none
-*	return:		status 	- Status of operation
+*	Same burst is transmitted repeat times. In DMA mode only
+*	first burst is started, rest are chained from interrupt.
+*
+*	param: 		p_data - Pointer to burst data
+*	param: 		size - Size of burst in bytes
+*	param: 		repeat - Number of bursts
+*	param: 		end - Release CS after last burst
+*	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_low_if_init(void)
+static ili9488_status_t ili9488_low_if_gram_transmit(const uint8_t * const p_data, const uint32_t size, const uint32_t repeat, const bool end)
 {
 	ili9488_status_t status = eILI9488_OK;
+	uint32_t i;
 
-	// Init GPIOS
-	ili9488_low_if_gpio_init();
+	// Only one transfer at a time
+	status |= ili9488_low_if_wait();
 
-	// Init timer
-	if ( eILI9488_OK != ili9488_low_if_timer_init())
+	// Non-blocking
+	if ( NULL != gp_transport -> pf_transmit_async )
 	{
-		status |= eILI9488_ERROR;
+		g_gram_tx.p_data = p_data;
+		g_gram_tx.size = size;
+		g_gram_tx.repeat = repeat;
+		g_gram_tx.end = end;
+		gb_is_busy = true;
+
+		if ( eILI9488_SPI_OK != gp_transport -> pf_transmit_async( p_data, size ))
+		{
+			gb_is_busy = false;
+			status = eILI9488_ERROR;
+
+			if ( true == end )
+			{
+				ILI9488_LOW_IF_CS_HIGH();
+			}
+		}
 	}
 
-	// Init SPI
-	if ( eILI9488_OK != ili9488_low_if_spi_init())
+	// Blocking
+	else
 	{
-		status |= eILI9488_ERROR;
+		for ( i = 0; ( i < repeat ) && ( eILI9488_OK == status ); i++ )
+		{
+			if ( eILI9488_SPI_OK != gp_transport -> pf_transmit( p_data, size ))
+			{
+				status = eILI9488_ERROR;
+			}
+		}
+
+		if ( true == end )
+		{
+			ILI9488_LOW_IF_CS_HIGH();
+		}
+
+		if ( NULL != gpf_tx_cplt_cb )
+		{
+			gpf_tx_cplt_cb();
+		}
 	}
 
 	return status;
@@ -106,63 +891,47 @@ ili9488_status_t ili9488_low_if_init(void)
 
 //////////////////////////////////////////////////////////////
 /*
-*			Write to LCD register
-*
-*	If sending only command, size shall be 0. Add size only
-*	for data bytes.
+*			Flush GRAM line buffer
 *
+*	Active buffer is put on the wire and the other one
+*	becomes active.
 *
-*	param: 		cmd - command name
-*	param: 		tx_data - pointer to transmit data
-*	param: 		size - number of data to transmit
+*	param: 		end - Release CS after transmit
 *	return:		status - Either Ok or Error
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_low_if_write_register(const ili9488_cmd_t cmd, const uint8_t * const tx_data, const uint32_t size)
+static ili9488_status_t ili9488_low_if_gram_flush(const bool end)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint8_t command = cmd;
 
-	// Check if functions are set
-	if 	(	( NULL == gpf_spi_receive )
-		||	( NULL == gpf_spi_receive ))
+	if ( g_gram_stream.fill > 0U )
 	{
-		status = eILI9488_ERROR;
+		status = ili9488_low_if_gram_transmit((uint8_t*) &g_gram_stream.buf[ g_gram_stream.active ], g_gram_stream.fill, 1U, end );
 
-		ILI9488_DBG_PRINT( "SPI interface function not set..." );
-		ILI9488_ASSERT( 0 );
-	}
-	else
-	{
-		// Set CS & DC
-		ILI9488_LOW_IF_CS_LOW();
-		ILI9488_LOW_IF_DC_COMMAND();
+		// Swap buffers
+		g_gram_stream.active = (( g_gram_stream.active + 1U ) % ILI9488_LOW_IF_GRAM_BUF_NUM );
+		g_gram_stream.fill = 0U;
 
-		// Send command
-		if ( eILI9488_SPI_OK != gpf_spi_transmit( &command, 1U ))
-		{
-			status = eILI9488_ERROR;
-		}
+		#if ( 1U == ILI9488_LOW_IF_GRAM_BUF_NUM )
 
-		// Command send OK
-		else
-		{
-			// In case of parameters send them as well
-			if ( size > 0 )
+			// Single buffer is still on the wire if transport is non-blocking
+			// NOTE: Next stream waits in "ili9488_low_if_gram_start"
+			if ( false == end )
 			{
-				// Data transmit
-				ILI9488_LOW_IF_DC_DATA();
-
-				if ( eILI9488_SPI_OK != gpf_spi_transmit((uint8_t*) tx_data, size ))
-				{
-					status = eILI9488_ERROR;
-				}
+				status |= ili9488_low_if_wait();
 			}
-		}
 
-		// Set CS
+		#endif
+	}
+	else if ( true == end )
+	{
+		status |= ili9488_low_if_wait();
 		ILI9488_LOW_IF_CS_HIGH();
 	}
+	else
+	{
+		// No actions...
+	}
 
 	return status;
 }
@@ -170,63 +939,58 @@ ili9488_status_t ili9488_low_if_write_register(const ili9488_cmd_t cmd, const ui
 
 //////////////////////////////////////////////////////////////
 /*
-*			Write to RGB code to GRAM
+*			GRAM burst transmit complete
 *
-*	This function writes constant RGB code and write size
-*	number pixels.
+*	Transport must call this function every time burst
+*	started with "pf_transmit_async" is finished.
 *
+*	If next burst can not be started, rest of transfer is
+*	dropped and error is reported by "ili9488_low_if_wait".
 *
-*	param: 		rgb - pointer to rgb code
-*	param: 		size - number of data to transmit
-*	return:		status - Either Ok or Error
+*	NOTE: Called from interrupt!
+*
+*	param: 		none
+*	return:		none
 */
 //////////////////////////////////////////////////////////////
-ili9488_status_t ili9488_low_if_write_rgb_to_gram (const ili9488_rgb_t * const p_rgb, const uint32_t size)
+void ili9488_low_if_tx_cplt_hndl(void)
 {
-	ili9488_status_t status = eILI9488_OK;
-	const uint8_t cmd = eILI9488_WRITE_MEM_CMD;
-	uint32_t i;
+	bool is_chained = false;
 
-	// Check if functions are set
-	if 	(	( NULL == gpf_spi_receive )
-		||	( NULL == gpf_spi_receive ))
-	{
-		status = eILI9488_ERROR;
+	g_gram_tx.repeat--;
 
-		ILI9488_DBG_PRINT( "SPI interface function not set..." );
-		ILI9488_ASSERT( 0 );
-	}
-	else
+	// Chain next burst
+	if ( g_gram_tx.repeat > 0U )
 	{
-		// Set CS & DC
-		ILI9488_LOW_IF_CS_LOW();
-		ILI9488_LOW_IF_DC_COMMAND();
-
-		// Send command
-		if ( eILI9488_SPI_OK != gpf_spi_transmit((uint8_t*) &cmd, 1U ))
+		if ( eILI9488_SPI_OK == gp_transport -> pf_transmit_async( g_gram_tx.p_data, g_gram_tx.size ))
 		{
-			status = eILI9488_ERROR;
+			is_chained = true;
 		}
 		else
 		{
-			// In case of parameters send them as well
-			if ( size > 0 )
-			{
-				// Data transmit
-				ILI9488_LOW_IF_DC_DATA();
+			g_gram_tx.is_error = true;
+		}
+	}
 
-				for ( i = 0; i < size; i++ )
-				{
-					gpf_spi_transmit((uint8_t*) p_rgb, 3U );
-				}
-			}
+	// Transfer done
+	if ( false == is_chained )
+	{
+		if ( true == g_gram_tx.end )
+		{
+			ILI9488_LOW_IF_CS_HIGH();
 		}
 
-		// Set CS
-		ILI9488_LOW_IF_CS_HIGH();
-	}
+		gb_is_busy = false;
 
-	return status;
+		if ( NULL != gpf_tx_cplt_cb )
+		{
+			gpf_tx_cplt_cb();
+		}
+	}
+	else
+	{
+		// No actions...
+	}
 }
 
 
@@ -247,23 +1011,25 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 	ili9488_status_t status = eILI9488_OK;
 	uint8_t command = cmd;
 
-	// Check if functions are set
-	if 	(	( NULL == gpf_spi_receive )
-		||	( NULL == gpf_spi_receive ))
+	// Check if transport is set
+	if ( NULL == gp_transport )
 	{
 		status = eILI9488_ERROR;
 
-		ILI9488_DBG_PRINT( "SPI interface function not set..." );
+		ILI9488_DBG_PRINT( "Transport not set..." );
 		ILI9488_ASSERT( 0 );
 	}
 	else
 	{
+		// Wait for GRAM transfer to finish
+		status |= ili9488_low_if_wait();
+
 		// Set CS & DC
 		ILI9488_LOW_IF_CS_LOW();
 		ILI9488_LOW_IF_DC_COMMAND();
 
 		// Send command
-		if ( eILI9488_SPI_OK != gpf_spi_transmit( &command, 1U ))
+		if ( eILI9488_SPI_OK != gp_transport -> pf_transmit( &command, 1U ))
 		{
 			status = eILI9488_ERROR;
 		}
@@ -277,7 +1043,7 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 				// Data transmit
 				ILI9488_LOW_IF_DC_DATA();
 
-				if ( eILI9488_SPI_OK != gpf_spi_receive( rx_data, size ))
+				if ( eILI9488_SPI_OK != gp_transport -> pf_receive( rx_data, size ))
 				{
 					status = eILI9488_ERROR;
 				}
@@ -302,13 +1068,9 @@ ili9488_status_t ili9488_low_if_read_register(const ili9488_cmd_t cmd, uint8_t *
 //////////////////////////////////////////////////////////////
 void ili9488_low_if_set_reset(const ili9488_reset_t rst)
 {
-	if ( eILI9488_RESET_OFF == rst )
-	{
-		HAL_GPIO_WritePin( ILI9488_RESET__PORT, ILI9488_RESET__PIN, GPIO_PIN_SET );
-	}
-	else
+	if ( NULL != gp_transport )
 	{
-		HAL_GPIO_WritePin( ILI9488_RESET__PORT, ILI9488_RESET__PIN, GPIO_PIN_RESET );
+		gp_transport -> pf_set_reset(( eILI9488_RESET_OFF == rst ));
 	}
 }
 
@@ -324,15 +1086,10 @@ void ili9488_low_if_set_reset(const ili9488_reset_t rst)
 ili9488_status_t ili9488_low_if_set_led(const float32_t brightness)
 {
 	ili9488_status_t status = eILI9488_OK;
-	uint16_t CMPR;
 
-	if (( brightness >= 0.0f ) && ( brightness <= 1.0f ))
+	if (( brightness >= 0.0f ) && ( brightness <= 1.0f ) && ( NULL != gp_transport ))
 	{
-		// Calculate duty
-		CMPR = (uint16_t) ( brightness * __HAL_TIM_GET_AUTORELOAD( &gh_led_timer ));
-
-	    // Set duty
-	    __HAL_TIM_SET_COMPARE( &gh_led_timer, ILI9488_LED_TIMER_CH, CMPR );
+		status = gp_transport -> pf_set_led( brightness );
 	}
 	else
 	{
@@ -346,6 +1103,134 @@ ili9488_status_t ili9488_low_if_set_led(const float32_t brightness)
 }
 
 
+//////////////////////////////////////////////////////////////
+/*
+*			Delay
+*
+*	param: 		ms - Time in miliseconds
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_low_if_delay_ms(const uint32_t ms)
+{
+	if ( NULL != gp_transport )
+	{
+		gp_transport -> pf_delay_ms( ms );
+	}
+}
+
+
+#if ( ILI9488_HAL_TRANSPORT_EN )
+
+//////////////////////////////////////////////////////////////
+/*
+*			Initialize STM32 HAL transport
+*
+*	param: 		none
+*	return:		status 	- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_low_if_hal_init(void)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	// Init GPIOS
+	ili9488_low_if_gpio_init();
+
+	// Init timer
+	if ( eILI9488_OK != ili9488_low_if_timer_init())
+	{
+		status |= eILI9488_ERROR;
+	}
+
+	// Init SPI
+	if ( eILI9488_OK != ili9488_low_if_spi_init())
+	{
+		status |= eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set CS line
+*
+*	param: 		state - Line state (true - high)
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_low_if_hal_set_cs(const bool state)
+{
+	HAL_GPIO_WritePin( ILI9488_CS__PORT, ILI9488_CS__PIN, (( true == state ) ? ( GPIO_PIN_SET ) : ( GPIO_PIN_RESET )));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set DC line
+*
+*	param: 		state - Line state (true - data, false - command)
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_low_if_hal_set_dc(const bool state)
+{
+	HAL_GPIO_WritePin( ILI9488_DC__PORT, ILI9488_DC__PIN, (( true == state ) ? ( GPIO_PIN_SET ) : ( GPIO_PIN_RESET )));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set reset line
+*
+*	param: 		state - Line state (true - high)
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_low_if_hal_set_reset(const bool state)
+{
+	HAL_GPIO_WritePin( ILI9488_RESET__PORT, ILI9488_RESET__PIN, (( true == state ) ? ( GPIO_PIN_SET ) : ( GPIO_PIN_RESET )));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Set backlight PWM duty
+*
+*	param: 		brightness 	- Brightness in value of 0.0 - 1.0
+*	return:		status 		- Status of operation
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_low_if_hal_set_led(const float32_t brightness)
+{
+	uint16_t CMPR;
+
+	// Calculate duty
+	CMPR = (uint16_t) ( brightness * __HAL_TIM_GET_AUTORELOAD( &gh_led_timer ));
+
+    // Set duty
+    __HAL_TIM_SET_COMPARE( &gh_led_timer, ILI9488_LED_TIMER_CH, CMPR );
+
+	return eILI9488_OK;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Delay
+*
+*	param: 		ms - Time in miliseconds
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_low_if_hal_delay_ms(const uint32_t ms)
+{
+	HAL_Delay( ms );
+}
+
+
 //////////////////////////////////////////////////////////////
 /*
 *			Initialize timer for backlight PWM control
@@ -482,7 +1367,7 @@ static void	ili9488_low_if_gpio_init(void)
 	GPIO_InitStruct.Pull		= ILI9488_CS__PULL;
 	GPIO_InitStruct.Speed		= GPIO_SPEED_MEDIUM;
 	HAL_GPIO_Init( ILI9488_CS__PORT, &GPIO_InitStruct );
-	ILI9488_LOW_IF_CS_HIGH();
+	ili9488_low_if_hal_set_cs( true );
 
 	// RESET pin
 	GPIO_InitStruct.Pin			= ILI9488_RESET__PIN;
@@ -490,7 +1375,7 @@ static void	ili9488_low_if_gpio_init(void)
 	GPIO_InitStruct.Pull		= ILI9488_RESET__PULL;
 	GPIO_InitStruct.Speed		= GPIO_SPEED_MEDIUM;
 	HAL_GPIO_Init( ILI9488_CS__PORT, &GPIO_InitStruct );
-	ILI9488_LOW_IF_CS_HIGH();
+	ili9488_low_if_hal_set_cs( true );
 }
 
 
@@ -528,16 +1413,20 @@ static ili9488_status_t ili9488_low_if_spi_init	(void)
 	if ( HAL_OK != HAL_SPI_Init( &gh_display_spi ))
 	{
 		status = eILI9488_ERROR;
-		gpf_spi_receive = NULL;
-		gpf_spi_transmit = NULL;
 
 		ILI9488_DBG_PRINT( "Touch SPI init failed! ");
 		ILI9488_ASSERT( 0 );
 	}
 	else
 	{
-		gpf_spi_receive = &ili9488_low_if_spi_receive;
-		gpf_spi_transmit = &ili9488_low_if_spi_transmit;
+		#if ( ILI9488_SPI_DMA_EN )
+
+			if ( eILI9488_OK != ili9488_low_if_dma_init())
+			{
+				status = eILI9488_ERROR;
+			}
+
+		#endif
 	}
 
 	return status;
@@ -588,6 +1477,86 @@ static ili9488_spi_status_t ili9488_low_if_spi_receive(uint8_t * const p_data, c
 }
 
 
+#if ( ILI9488_SPI_DMA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Initialize SPI TX DMA
+	*
+	*	param: 		none
+	*	return:		status - Status of operation
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_status_t ili9488_low_if_dma_init(void)
+	{
+		ili9488_status_t status = eILI9488_OK;
+
+		// Enable clock
+		ILI9488_SPI_DMA_EN_CLK();
+
+		// Init DMA
+		gh_display_dma.Instance 					= ILI9488_SPI_DMA_STREAM;
+		gh_display_dma.Init.Channel 				= ILI9488_SPI_DMA_CHANNEL;
+		gh_display_dma.Init.Direction 				= DMA_MEMORY_TO_PERIPH;
+		gh_display_dma.Init.PeriphInc 				= DMA_PINC_DISABLE;
+		gh_display_dma.Init.MemInc 					= DMA_MINC_ENABLE;
+		gh_display_dma.Init.PeriphDataAlignment 	= DMA_PDATAALIGN_BYTE;
+		gh_display_dma.Init.MemDataAlignment 		= DMA_MDATAALIGN_BYTE;
+		gh_display_dma.Init.Mode 					= DMA_NORMAL;
+		gh_display_dma.Init.Priority 				= DMA_PRIORITY_HIGH;
+		gh_display_dma.Init.FIFOMode 				= DMA_FIFOMODE_DISABLE;
+
+		if ( HAL_OK != HAL_DMA_Init( &gh_display_dma ))
+		{
+			status = eILI9488_ERROR;
+
+			ILI9488_DBG_PRINT( "Display SPI DMA init failed! ");
+			ILI9488_ASSERT( 0 );
+		}
+		else
+		{
+			__HAL_LINKDMA( &gh_display_spi, hdmatx, gh_display_dma );
+
+			HAL_NVIC_SetPriority( ILI9488_SPI_DMA_IRQ, ILI9488_SPI_DMA_IRQ_PRIO, 0 );
+			HAL_NVIC_EnableIRQ( ILI9488_SPI_DMA_IRQ );
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			SPI tranmit over DMA
+	*
+	*	Function only starts transfer, completion is reported
+	*	via "ili9488_low_if_dma_hndl".
+	*
+	*	param: 		p_data 	- Pointer to trasmited data
+	*	param: 		size 	- Size of transmited data in bytes
+	*	return:		status 	- Status of operation
+	*/
+	//////////////////////////////////////////////////////////////
+	static ili9488_spi_status_t ili9488_low_if_spi_transmit_dma(const uint8_t * p_data, const uint32_t size)
+	{
+		ili9488_spi_status_t status = eILI9488_SPI_OK;
+		const uintptr_t addr = ((uintptr_t) p_data & ~((uintptr_t) 0x1FU ));
+
+		// Write data from D-cache to RAM before DMA reads it
+		SCB_CleanDCache_by_Addr((uint32_t*) addr, (int32_t)( size + ((uintptr_t) p_data - addr )));
+
+		if ( HAL_OK != HAL_SPI_Transmit_DMA( &gh_display_spi, (uint8_t*) p_data, size ))
+		{
+			status = eILI9488_SPI_ERROR;
+		}
+
+		return status;
+	}
+
+#endif
+
+#endif // ILI9488_HAL_TRANSPORT_EN
+
 
 //////////////////////////////////////////////////////////////
 // END OF FILE
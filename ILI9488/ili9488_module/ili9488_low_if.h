@@ -14,7 +14,6 @@
 //	INCLUDES
 //////////////////////////////////////////////////////////////
 #include "stdbool.h"
-#include "stm32f7xx_hal.h"
 
 #include "ili9488.h"
 #include "ili9488_regdef.h"
@@ -54,6 +53,15 @@ typedef struct
 	uint8_t B;
 } ili9488_rgb_t;
 
+// Pixel format
+typedef enum
+{
+	eILI9488_PIXEL_FORMAT_3_BIT = 0,
+	eILI9488_PIXEL_FORMAT_16_BIT,
+	eILI9488_PIXEL_FORMAT_18_BIT,
+	eILI9488_PIXEL_FORMAT_24_BIT,
+} ili9488_pixel_format_t;
+
 
 //////////////////////////////////////////////////////////////
 //	VARIABLES
@@ -64,11 +72,26 @@ typedef struct
 // FUNCTIONS PROTOTYPES
 //////////////////////////////////////////////////////////////
 ili9488_status_t 	ili9488_low_if_init					(void);
+ili9488_status_t 	ili9488_low_if_set_transport		(const ili9488_transport_t * const p_transport);
 ili9488_status_t 	ili9488_low_if_write_register		(const ili9488_cmd_t cmd, const uint8_t * const tx_data, const uint32_t size);
 ili9488_status_t 	ili9488_low_if_read_register		(const ili9488_cmd_t cmd, uint8_t * const rx_data, const uint32_t size);
+ili9488_status_t	ili9488_low_if_set_pixel_format		(const ili9488_pixel_format_t format);
+ili9488_pixel_format_t	ili9488_low_if_get_pixel_format	(void);
 ili9488_status_t 	ili9488_low_if_write_rgb_to_gram 	(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+ili9488_status_t 	ili9488_low_if_gram_start			(void);
+ili9488_status_t 	ili9488_low_if_gram_put				(const ili9488_rgb_t * const p_rgb, const uint32_t size);
+ili9488_status_t 	ili9488_low_if_gram_put_raw			(const uint8_t * const p_data, const uint32_t size);
+ili9488_status_t 	ili9488_low_if_gram_end				(void);
+uint32_t			ili9488_low_if_gram_bytes			(const uint32_t size);
+void				ili9488_low_if_encode_rgb			(const ili9488_rgb_t * const p_rgb, const uint32_t size, uint8_t * const p_buf, const uint32_t offset);
+bool				ili9488_low_if_is_busy				(void);
+ili9488_status_t	ili9488_low_if_wait					(void);
+void				ili9488_low_if_set_tx_cplt_cb		(const pf_ili9488_tx_cplt_cb_t pf_cb);
+void				ili9488_low_if_dma_hndl				(void);
+void				ili9488_low_if_tx_cplt_hndl			(void);
 void 				ili9488_low_if_set_reset			(const ili9488_reset_t rst);
 ili9488_status_t	ili9488_low_if_set_led				(const float32_t brigthness);
+void				ili9488_low_if_delay_ms				(const uint32_t ms);
 
 
 //////////////////////////////////////////////////////////////
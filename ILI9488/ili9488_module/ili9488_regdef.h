@@ -86,6 +86,12 @@ typedef enum
 	// Set page address
 	eILI9488_SET_PAGE_ADDR_CMD					= 0x2BU,
 
+	// Vertical scrolling definition
+	eILI9488_SET_VSCRDEF_CMD					= 0x33U,
+
+	// Vertical scrolling start address
+	eILI9488_SET_VSCRSADD_CMD					= 0x37U,
+
 	// Memory write/read
 	eILI9488_WRITE_MEM_CMD						= 0x2CU,
 	eILI9488_READ_MEM_CMD						= 0x2EU,
@@ -138,7 +144,7 @@ typedef enum
 } ili9488_cmd_t;
 
 
-// Display size
+// Display size (landscape orientation)
 #define ILI9488_DISPLAY_SIZE_COLUMN				( 320 )
 #define ILI9488_DISPLAY_SIZE_PAGE				( 480 )
 
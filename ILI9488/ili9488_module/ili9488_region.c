@@ -0,0 +1,352 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_region.h"
+#include "ili9488_config.h"
+
+#include <string.h>
+
+#if ( ILI9488_RENDER_EN )
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Region tracker
+//
+// NOTE: Regions are kept merged, so that sending any two of
+// them separately costs less than sending their bounding area.
+typedef struct
+{
+	ili9488_region_t		region[ ILI9488_RENDER_DIRTY_NUM ];
+	uint32_t				num;		// Number of regions
+	uint32_t				requested;	// Pixels invalidated in current frame
+	ili9488_region_stats_t	stats;
+} ili9488_region_tracker_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Region tracker
+static ili9488_region_tracker_t g_region;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static uint32_t ili9488_region_get_cost	(const ili9488_region_t * const p_area);
+static void		ili9488_region_remove	(const uint32_t idx);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove all regions
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_clear(void)
+{
+	g_region.num = 0;
+	g_region.requested = 0;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add invalidated area
+*
+*	Area is merged with every region for which sending their
+*	bounding area costs no more than sending both of them.
+*	Cost of area is its pixels plus ILI9488_RENDER_AREA_COST.
+*	When there is no free region left, area is merged with
+*	region adding least extra pixels.
+*
+*	param: 		p_area - Pointer to area, must be inside display
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_add(const ili9488_region_t * const p_area)
+{
+	ili9488_region_t area;
+	ili9488_region_t bound;
+	uint32_t best_idx;
+	uint32_t best_cost;
+	uint32_t cost;
+	uint32_t i;
+	bool is_merged;
+
+	if (( p_area -> page_size > 0U ) && ( p_area -> col_size > 0U ))
+	{
+		area = *p_area;
+
+		g_region.requested += ((uint32_t) area.page_size * area.col_size );
+		g_region.stats.rects++;
+
+		do
+		{
+			is_merged = false;
+
+			// Merge if cheaper
+			for ( i = 0; i < g_region.num; i++ )
+			{
+				bound = area;
+				ili9488_region_unite( &bound, &g_region.region[i] );
+
+				if ( ili9488_region_get_cost( &bound ) <= ( ili9488_region_get_cost( &area ) + ili9488_region_get_cost( &g_region.region[i] )))
+				{
+					area = bound;
+					ili9488_region_remove( i );
+					is_merged = true;
+					break;
+				}
+			}
+
+			// No space, merge with cheapest one
+			if (( false == is_merged ) && ( g_region.num >= ILI9488_RENDER_DIRTY_NUM ))
+			{
+				best_idx = 0;
+				best_cost = UINT32_MAX;
+
+				for ( i = 0; i < g_region.num; i++ )
+				{
+					bound = area;
+					ili9488_region_unite( &bound, &g_region.region[i] );
+
+					cost = ( ili9488_region_get_cost( &bound ) - ili9488_region_get_cost( &g_region.region[i] ));
+
+					if ( cost < best_cost )
+					{
+						best_cost = cost;
+						best_idx = i;
+					}
+				}
+
+				ili9488_region_unite( &area, &g_region.region[ best_idx ] );
+				ili9488_region_remove( best_idx );
+				is_merged = true;
+			}
+
+			if ( true == is_merged )
+			{
+				g_region.stats.merges++;
+			}
+
+		// Bigger area might merge with others
+		} while ( true == is_merged );
+
+		g_region.region[ g_region.num ] = area;
+		g_region.num++;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Account regions of finished frame
+*
+*	param: 		display_size - Number of pixels on display
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_end_frame(const uint32_t display_size)
+{
+	uint32_t pixels = 0;
+	uint32_t i;
+
+	for ( i = 0; i < g_region.num; i++ )
+	{
+		pixels += ((uint32_t) g_region.region[i].page_size * g_region.region[i].col_size );
+	}
+
+	g_region.stats.frames++;
+	g_region.stats.regions += g_region.num;
+	g_region.stats.pixels += pixels;
+	g_region.stats.overdraw += (( pixels > g_region.requested ) ? ( pixels - g_region.requested ) : ( 0U ));
+	g_region.stats.saved += (( display_size > pixels ) ? ( display_size - pixels ) : ( 0U ));
+
+	g_region.stats.last_pixels = pixels;
+	g_region.stats.last_saved = (( display_size > pixels ) ? ( display_size - pixels ) : ( 0U ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get number of regions
+*
+*	param: 		none
+*	return:		Number of regions
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_region_get_num(void)
+{
+	return g_region.num;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get region
+*
+*	param: 		idx - Index of region
+*	return:		Pointer to region, NULL if out of range
+*/
+//////////////////////////////////////////////////////////////
+const ili9488_region_t * ili9488_region_get(const uint32_t idx)
+{
+	const ili9488_region_t * p_region = NULL;
+
+	if ( idx < g_region.num )
+	{
+		p_region = &g_region.region[ idx ];
+	}
+
+	return p_region;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Intersect two areas
+*
+*	param: 		p_a - Pointer to first area
+*	param: 		p_b - Pointer to second area
+*	param: 		p_res - Pointer to intersection, can be one of inputs
+*	return:		true if areas intersect
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_region_intersect(const ili9488_region_t * const p_a, const ili9488_region_t * const p_b, ili9488_region_t * const p_res)
+{
+	uint32_t page_s;
+	uint32_t page_e;
+	uint32_t col_s;
+	uint32_t col_e;
+	bool is_intersect = false;
+
+	page_s = (( p_a -> page > p_b -> page ) ? ( p_a -> page ) : ( p_b -> page ));
+	col_s = (( p_a -> col > p_b -> col ) ? ( p_a -> col ) : ( p_b -> col ));
+	page_e = ((( p_a -> page + p_a -> page_size ) < ( p_b -> page + p_b -> page_size )) ? ( p_a -> page + p_a -> page_size ) : ( p_b -> page + p_b -> page_size ));
+	col_e = ((( p_a -> col + p_a -> col_size ) < ( p_b -> col + p_b -> col_size )) ? ( p_a -> col + p_a -> col_size ) : ( p_b -> col + p_b -> col_size ));
+
+	if (( page_s < page_e ) && ( col_s < col_e ))
+	{
+		p_res -> page = page_s;
+		p_res -> col = col_s;
+		p_res -> page_size = ( page_e - page_s );
+		p_res -> col_size = ( col_e - col_s );
+		is_intersect = true;
+	}
+
+	return is_intersect;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Extend area to bound another one
+*
+*	param: 		p_a - Pointer to area to extend
+*	param: 		p_b - Pointer to area to bound
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_unite(ili9488_region_t * const p_a, const ili9488_region_t * const p_b)
+{
+	uint32_t page_s;
+	uint32_t page_e;
+	uint32_t col_s;
+	uint32_t col_e;
+
+	page_s = (( p_a -> page < p_b -> page ) ? ( p_a -> page ) : ( p_b -> page ));
+	col_s = (( p_a -> col < p_b -> col ) ? ( p_a -> col ) : ( p_b -> col ));
+	page_e = ((( p_a -> page + p_a -> page_size ) > ( p_b -> page + p_b -> page_size )) ? ( p_a -> page + p_a -> page_size ) : ( p_b -> page + p_b -> page_size ));
+	col_e = ((( p_a -> col + p_a -> col_size ) > ( p_b -> col + p_b -> col_size )) ? ( p_a -> col + p_a -> col_size ) : ( p_b -> col + p_b -> col_size ));
+
+	p_a -> page = page_s;
+	p_a -> col = col_s;
+	p_a -> page_size = ( page_e - page_s );
+	p_a -> col_size = ( col_e - col_s );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get region tracker statistics
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_get_stats(ili9488_region_stats_t * const p_stats)
+{
+	*p_stats = g_region.stats;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset region tracker statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_region_reset_stats(void)
+{
+	memset( &g_region.stats, 0, sizeof( g_region.stats ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get cost of sending area
+*
+*	param: 		p_area - Pointer to area
+*	return:		Cost in pixels
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t ili9488_region_get_cost(const ili9488_region_t * const p_area)
+{
+	return (((uint32_t) p_area -> page_size * p_area -> col_size ) + ILI9488_RENDER_AREA_COST );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Remove region
+*
+*	NOTE: Order of regions is not kept.
+*
+*	param: 		idx - Index of region
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_region_remove(const uint32_t idx)
+{
+	g_region.num--;
+	g_region.region[ idx ] = g_region.region[ g_region.num ];
+}
+
+#endif // ILI9488_RENDER_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_REGION_H_
+#define _ILI9488_REGION_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Area of display
+typedef struct
+{
+	uint16_t	page;
+	uint16_t	col;
+	uint16_t	page_size;
+	uint16_t	col_size;
+} ili9488_region_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+void						ili9488_region_clear		(void);
+void						ili9488_region_add			(const ili9488_region_t * const p_area);
+void						ili9488_region_end_frame	(const uint32_t display_size);
+uint32_t					ili9488_region_get_num		(void);
+const ili9488_region_t *	ili9488_region_get			(const uint32_t idx);
+
+bool						ili9488_region_intersect	(const ili9488_region_t * const p_a, const ili9488_region_t * const p_b, ili9488_region_t * const p_res);
+void						ili9488_region_unite		(ili9488_region_t * const p_a, const ili9488_region_t * const p_b);
+
+void						ili9488_region_get_stats	(ili9488_region_stats_t * const p_stats);
+void						ili9488_region_reset_stats	(void);
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
+
+#endif // _ILI9488_REGION_H_
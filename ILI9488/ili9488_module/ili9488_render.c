@@ -0,0 +1,1644 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_render.h"
+#include "ili9488_region.h"
+#include "ili9488_driver.h"
+#include "ili9488_font.h"
+#include "ili9488_config.h"
+
+#include <string.h>
+
+#if ( ILI9488_RENDER_EN )
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Check renderer setup
+#if (( ILI9488_RENDER_STRIP_SIZE < 1 ) || ( ILI9488_RENDER_CMD_NUM < 1 ) || ( ILI9488_RENDER_DIRTY_NUM < 1 ) || ( ILI9488_RENDER_TEXT_SIZE > 0xFFFF ))
+	#error "Frame renderer setup out of range!"
+#endif
+
+// Strip buffer size in pixels
+// NOTE: Longer side of display, so that strip fits in all orientations.
+#define ILI9488_RENDER_STRIP_BUF_SIZE		( ILI9488_DISPLAY_SIZE_PAGE * ILI9488_RENDER_STRIP_SIZE )
+
+// Draw commands
+typedef enum
+{
+	eILI9488_RENDER_CMD_RECT = 0,
+	eILI9488_RENDER_CMD_ROUND_RECT,
+	eILI9488_RENDER_CMD_CIRCLE,
+	eILI9488_RENDER_CMD_BORDERED_CIRCLE,
+	eILI9488_RENDER_CMD_ARC,
+	eILI9488_RENDER_CMD_TEXT,
+	eILI9488_RENDER_CMD_BITMAP,
+	eILI9488_RENDER_CMD_POLYLINE,
+	eILI9488_RENDER_CMD_POLYGON,
+	eILI9488_RENDER_CMD_LINE_AA,
+	eILI9488_RENDER_CMD_CIRCLE_AA,
+	eILI9488_RENDER_CMD_TEXT_AA,
+} ili9488_render_cmd_type_t;
+
+// Draw command
+typedef struct
+{
+	ili9488_render_cmd_type_t	type;
+	uint16_t					page;			// Start page, center of circle
+	uint16_t					col;			// Start column, center of circle
+	uint16_t					page_size;		// Size of rectangle, radius of arc
+	uint16_t					col_size;		// Width of arc
+	uint16_t					text;			// Start of text or points in storage
+	uint16_t					text_num;		// Number of characters, size of points in bytes
+	uint16_t					angle_s;		// Start and end angle of arc
+	uint16_t					angle_e;
+	uint8_t						radius;
+	uint8_t						border_width;
+	bool						fill_en;
+	ili9488_color_t				fill_color;		// Fill, text foreground
+	ili9488_color_t				border_color;	// Border, text background
+	ili9488_font_opt_t			font_opt;
+	ili9488_fill_rule_t			fill_rule;
+	const ili9488_bitmap_t *	p_bitmap;
+} ili9488_render_cmd_t;
+
+// Frame
+typedef struct
+{
+	ili9488_render_cmd_t	cmd[ ILI9488_RENDER_CMD_NUM ];
+	char					text[ ILI9488_RENDER_TEXT_SIZE ];
+	uint32_t				cmd_num;
+	uint32_t				text_used;
+	ili9488_status_t		status;			// Status of recording
+} ili9488_render_frame_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Current and previous frame
+static ili9488_render_frame_t g_frames[2];
+static ili9488_render_frame_t * gp_frame = &g_frames[0];
+static ili9488_render_frame_t * gp_prev_frame = &g_frames[1];
+
+// Previous frame is on display
+static bool gb_prev_valid;
+
+// Frame recording in progress
+static bool gb_is_open;
+
+// Compare frame with previous one
+static bool gb_find_changes;
+
+// Strip buffer
+static ili9488_rgb_t g_strip[ ILI9488_RENDER_STRIP_BUF_SIZE ];
+
+// Statistics
+static ili9488_render_stats_t g_render_stats;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_render_cmd_t *	ili9488_render_add_cmd		(const ili9488_render_cmd_type_t type);
+static ili9488_status_t			ili9488_render_add_text		(const ili9488_render_cmd_type_t type, const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt);
+static ili9488_render_cmd_t *	ili9488_render_add_points	(const ili9488_render_cmd_type_t type, const ili9488_point_t * const p_points, const uint16_t num);
+static ili9488_status_t			ili9488_render_draw_cmd		(const ili9488_render_cmd_t * const p_cmd);
+static ili9488_status_t			ili9488_render_draw_area	(const ili9488_region_t * const p_area);
+static void						ili9488_render_get_area		(const ili9488_render_cmd_t * const p_cmd, const char * const p_text, ili9488_region_t * const p_area);
+static bool						ili9488_render_is_equal		(const ili9488_render_cmd_t * const p_a, const char * const p_a_text, const ili9488_render_cmd_t * const p_b, const char * const p_b_text);
+static void						ili9488_render_diff			(void);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Begin frame
+*
+*	Commands of previous frame are kept to find changes.
+*	Without finding changes only areas invalidated since
+*	previous frame are sent to display.
+*
+*	param: 		find_changes - Invalidate commands changed since previous frame
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_begin(const bool find_changes)
+{
+	ili9488_render_frame_t * p_tmp;
+
+	p_tmp = gp_prev_frame;
+	gp_prev_frame = gp_frame;
+	gp_frame = p_tmp;
+
+	gp_frame -> cmd_num = 0;
+	gp_frame -> text_used = 0;
+	gp_frame -> status = eILI9488_OK;
+
+	gb_find_changes = find_changes;
+	gb_is_open = true;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			End frame
+*
+*	When finding changes, commands that differ from previous
+*	frame invalidate their old and new area. Merged
+*	invalidated regions are then rasterised in bands that
+*	fit strip buffer. All commands touching band are drawn
+*	into strip buffer in recorded order and band is written
+*	to display.
+*
+*	NOTE: Area not covered by any command is black.
+*
+*	param: 		none
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_end(void)
+{
+	ili9488_status_t status = gp_frame -> status;
+	const ili9488_region_t * p_region;
+	ili9488_region_t band;
+	uint16_t band_size;
+	uint32_t i;
+
+	ili9488_render_diff();
+
+	for ( i = 0; i < ili9488_region_get_num(); i++ )
+	{
+		p_region = ili9488_region_get( i );
+
+		// Band of as many columns as fits into strip buffer
+		band = *p_region;
+		band_size = ( ILI9488_RENDER_STRIP_BUF_SIZE / p_region -> page_size );
+
+		for ( band.col = p_region -> col; band.col < ( p_region -> col + p_region -> col_size ); band.col += band_size )
+		{
+			band.col_size = (( p_region -> col + p_region -> col_size ) - band.col );
+
+			if ( band.col_size > band_size )
+			{
+				band.col_size = band_size;
+			}
+
+			status |= ili9488_render_draw_area( &band );
+		}
+	}
+
+	ili9488_region_end_frame((uint32_t) ili9488_driver_get_page_size() * ili9488_driver_get_col_size());
+	ili9488_region_clear();
+
+	gb_is_open = false;
+
+	g_render_stats.frames++;
+
+	// Incomplete frame can not be compared with
+	gb_prev_valid = ( eILI9488_OK == gp_frame -> status );
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Invalidate area of display
+*
+*	Area is sent to display at end of next frame, therefore
+*	can be invalidated also between frames.
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_invalidate(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_region_t display;
+	ili9488_region_t area;
+
+	display.page = 0;
+	display.col = 0;
+	display.page_size = ili9488_driver_get_page_size();
+	display.col_size = ili9488_driver_get_col_size();
+
+	area.page = page;
+	area.col = col;
+	area.page_size = page_size;
+	area.col_size = col_size;
+
+	if ( true == ili9488_region_intersect( &area, &display, &area ))
+	{
+		ili9488_region_add( &area );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Forget content of display
+*
+*	Next frame is sent to display as whole.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_reset(void)
+{
+	gb_prev_valid = false;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get frame recording status
+*
+*	param: 		none
+*	return:		true if frame is being recorded
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_render_is_open(void)
+{
+	return gb_is_open;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record filled rectangle
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		color - Color of rectangle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_RECT );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> page_size = page_size;
+		p_cmd -> col_size = col_size;
+		p_cmd -> fill_color = color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record rounded and/or bordered rectangle
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		radius - Radius of corners
+*	param: 		border_width - Width of border
+*	param: 		fill_en - Fill interior
+*	param: 		fill_color - Color of interior
+*	param: 		border_color - Color of border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_round_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_ROUND_RECT );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> page_size = page_size;
+		p_cmd -> col_size = col_size;
+		p_cmd -> radius = radius;
+		p_cmd -> border_width = border_width;
+		p_cmd -> fill_en = fill_en;
+		p_cmd -> fill_color = fill_color;
+		p_cmd -> border_color = border_color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record filled circle
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Radius of circle
+*	param: 		color - Color of circle
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_CIRCLE );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> page_size = radius;
+		p_cmd -> fill_color = color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record bordered circle
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Radius of circle
+*	param: 		border_width - Width of border
+*	param: 		fill_en - Fill interior
+*	param: 		fill_color - Color of interior
+*	param: 		border_color - Color of border
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_bordered_circle(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_BORDERED_CIRCLE );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> radius = radius;
+		p_cmd -> border_width = border_width;
+		p_cmd -> fill_en = fill_en;
+		p_cmd -> fill_color = fill_color;
+		p_cmd -> border_color = border_color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record arc
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Outer radius
+*	param: 		width - Width of ring, radius + 1 for pie
+*	param: 		angle_s - Start angle
+*	param: 		angle_e - End angle
+*	param: 		color - Color of arc
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_arc(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_ARC );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> page_size = radius;
+		p_cmd -> col_size = width;
+		p_cmd -> angle_s = angle_s;
+		p_cmd -> angle_e = angle_e;
+		p_cmd -> fill_color = color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record row of characters
+*
+*	Characters are copied into frame text storage.
+*
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_text(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+{
+	return ili9488_render_add_text( eILI9488_RENDER_CMD_TEXT, p_chars, num, page, col, fg_color, bg_color, font_opt );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record bitmap
+*
+*	NOTE: Bitmap is not copied, it must stay unchanged
+*	until it is no longer part of frame.
+*
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd;
+
+	p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_BITMAP );
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> page_size = p_bitmap -> width;
+		p_cmd -> col_size = p_bitmap -> height;
+		p_cmd -> p_bitmap = p_bitmap;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record polyline
+*
+*	Points are copied into frame text storage.
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	param: 		color - Color of line
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_polyline(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd = NULL;
+
+	if (( NULL == p_points ) || ( 0U == num ))
+	{
+		gp_frame -> status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Drawing line invalid spacing..." );
+	}
+	else
+	{
+		p_cmd = ili9488_render_add_points( eILI9488_RENDER_CMD_POLYLINE, p_points, num );
+	}
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> fill_color = color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record polygon fill
+*
+*	Points are copied into frame text storage.
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	param: 		rule - Fill rule
+*	param: 		color - Color of polygon
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_polygon(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd = NULL;
+
+	if (( NULL == p_points ) || ( num < 3U ) || ( num > ILI9488_POLYGON_POINT_NUM ))
+	{
+		gp_frame -> status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Filling polygon invalid spacing..." );
+	}
+	else
+	{
+		p_cmd = ili9488_render_add_points( eILI9488_RENDER_CMD_POLYGON, p_points, num );
+	}
+
+	if ( NULL != p_cmd )
+	{
+		p_cmd -> fill_rule = rule;
+		p_cmd -> fill_color = color;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+#if ( ILI9488_AA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record anti-aliased line
+	*
+	*	param: 		page_s - Start page
+	*	param: 		col_s - Start column
+	*	param: 		page_e - End page
+	*	param: 		col_e - End column
+	*	param: 		color - Color of line
+	*	param: 		bg_color - Background color, unused in strip
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_line_aa(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		ili9488_render_cmd_t * p_cmd;
+		ili9488_point_t points[2];
+
+		points[0].page = page_s;
+		points[0].col = col_s;
+		points[1].page = page_e;
+		points[1].col = col_e;
+
+		p_cmd = ili9488_render_add_points( eILI9488_RENDER_CMD_LINE_AA, points, 2U );
+
+		if ( NULL != p_cmd )
+		{
+			p_cmd -> fill_color = color;
+			p_cmd -> border_color = bg_color;
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record anti-aliased circle
+	*
+	*	param: 		page - Center page
+	*	param: 		col - Center column
+	*	param: 		radius - Radius of circle
+	*	param: 		fill_en - Fill interior
+	*	param: 		color - Color of circle
+	*	param: 		bg_color - Background color, unused in strip
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_circle_aa(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		ili9488_status_t status = eILI9488_OK;
+		ili9488_render_cmd_t * p_cmd;
+
+		p_cmd = ili9488_render_add_cmd( eILI9488_RENDER_CMD_CIRCLE_AA );
+
+		if ( NULL != p_cmd )
+		{
+			p_cmd -> page = page;
+			p_cmd -> col = col;
+			p_cmd -> page_size = radius;
+			p_cmd -> fill_en = fill_en;
+			p_cmd -> fill_color = color;
+			p_cmd -> border_color = bg_color;
+		}
+		else
+		{
+			status = eILI9488_ERROR;
+		}
+
+		return status;
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record row of anti-aliased characters
+	*
+	*	param: 		p_chars - Pointer to characters
+	*	param: 		num - Number of characters
+	*	param: 		page - Start page
+	*	param: 		col - Start column
+	*	param: 		fg_color - Foreground color
+	*	param: 		bg_color - Background color
+	*	param: 		font_opt - Font of choise, drawn at half size
+	*	return:		status - Either Ok or Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_text_aa(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+	{
+		return ili9488_render_add_text( eILI9488_RENDER_CMD_TEXT_AA, p_chars, num, page, col, fg_color, bg_color, font_opt );
+	}
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get area covered by circle
+*
+*	Area is clipped at display origin.
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Radius of circle
+*	param: 		p_area - Pointer to area
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_get_circle_area(const uint16_t page, const uint16_t col, const uint16_t radius, ili9488_region_t * const p_area)
+{
+	p_area -> page = (( page > radius ) ? ((uint16_t)( page - radius )) : ( 0U ));
+	p_area -> col = (( col > radius ) ? ((uint16_t)( col - radius )) : ( 0U ));
+	p_area -> page_size = (( page + radius + 1U ) - p_area -> page );
+	p_area -> col_size = (( col + radius + 1U ) - p_area -> col );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get area covered by row of characters
+*
+*	Row of compiled font is as wide as its characters
+*	placed by advance and kerning.
+*
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		font_opt - Font of choise
+*	param: 		p_area - Pointer to area, empty for unknown font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_get_text_area(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_font_opt_t font_opt, ili9488_region_t * const p_area)
+{
+	const ili9488_font_t * p_font;
+	uint8_t line_size_byte;
+	uint32_t width;
+
+	p_font = ili9488_font_get( font_opt );
+
+	if ( NULL != p_font )
+	{
+		// NOTE: Same strip start as in "ili9488_driver_set_chars", compiled fonts start at page
+		line_size_byte = (( p_font -> width / 8U ) + 1U );
+
+		p_area -> page = (( NULL != p_font -> p_glyph ) ? ( page ) : ( page + ( 2U * p_font -> width ) - ( 8U * line_size_byte )));
+		p_area -> col = col;
+		p_area -> page_size = ( num * p_font -> width );
+		p_area -> col_size = p_font -> height;
+
+		if ( NULL != p_font -> p_glyph )
+		{
+			(void) ili9488_font_fit_string( p_font, p_chars, num, UINT32_MAX, &width );
+			p_area -> page_size = width;
+		}
+	}
+	else
+	{
+		memset( p_area, 0, sizeof( ili9488_region_t ));
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get renderer statistics
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_get_stats(ili9488_render_stats_t * const p_stats)
+{
+	*p_stats = g_render_stats;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset renderer statistics
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_reset_stats(void)
+{
+	memset( &g_render_stats, 0, sizeof( g_render_stats ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add command to frame
+*
+*	Failure is remembered and reported at frame end.
+*
+*	param: 		type - Type of command
+*	return:		Pointer to cleared command, NULL if frame is full
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_render_cmd_t * ili9488_render_add_cmd(const ili9488_render_cmd_type_t type)
+{
+	ili9488_render_cmd_t * p_cmd = NULL;
+
+	if ( gp_frame -> cmd_num < ILI9488_RENDER_CMD_NUM )
+	{
+		p_cmd = &gp_frame -> cmd[ gp_frame -> cmd_num ];
+		gp_frame -> cmd_num++;
+
+		memset( p_cmd, 0, sizeof( ili9488_render_cmd_t ));
+		p_cmd -> type = type;
+	}
+	else
+	{
+		gp_frame -> status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Frame command list full..." );
+	}
+
+	return p_cmd;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add command with text to frame
+*
+*	Characters are copied into frame text storage.
+*
+*	param: 		type - Command type
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_render_add_text(const ili9488_render_cmd_type_t type, const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_render_cmd_t * p_cmd = NULL;
+
+	if (( gp_frame -> text_used + num ) <= ILI9488_RENDER_TEXT_SIZE )
+	{
+		p_cmd = ili9488_render_add_cmd( type );
+	}
+	else
+	{
+		gp_frame -> status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Frame text storage full..." );
+	}
+
+	if ( NULL != p_cmd )
+	{
+		memcpy( &gp_frame -> text[ gp_frame -> text_used ], p_chars, num );
+
+		p_cmd -> page = page;
+		p_cmd -> col = col;
+		p_cmd -> text = gp_frame -> text_used;
+		p_cmd -> text_num = num;
+		p_cmd -> fill_color = fg_color;
+		p_cmd -> border_color = bg_color;
+		p_cmd -> font_opt = font_opt;
+
+		gp_frame -> text_used += num;
+	}
+	else
+	{
+		status = eILI9488_ERROR;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add command with points to frame
+*
+*	Points are copied into frame text storage and bounding
+*	area of them is set to command.
+*
+*	param: 		type - Command type
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	return:		Pointer to command, NULL when frame is full
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_render_cmd_t * ili9488_render_add_points(const ili9488_render_cmd_type_t type, const ili9488_point_t * const p_points, const uint16_t num)
+{
+	ili9488_render_cmd_t * p_cmd = NULL;
+	uint32_t start;
+	uint32_t size;
+	uint16_t page_e;
+	uint16_t col_e;
+	uint32_t i;
+
+	// Points are read from storage in place
+	start = (( gp_frame -> text_used + ( sizeof( uint16_t ) - 1U )) & ~( sizeof( uint16_t ) - 1U ));
+	size = ( num * sizeof( ili9488_point_t ));
+
+	if (( start + size ) <= ILI9488_RENDER_TEXT_SIZE )
+	{
+		p_cmd = ili9488_render_add_cmd( type );
+	}
+	else
+	{
+		gp_frame -> status = eILI9488_ERROR;
+		ILI9488_DBG_PRINT( "Frame text storage full..." );
+	}
+
+	if ( NULL != p_cmd )
+	{
+		memcpy( &gp_frame -> text[ start ], p_points, size );
+
+		// Bounding area
+		p_cmd -> page = p_points[0].page;
+		p_cmd -> col = p_points[0].col;
+		page_e = p_points[0].page;
+		col_e = p_points[0].col;
+
+		for ( i = 1U; i < num; i++ )
+		{
+			p_cmd -> page = (( p_points[i].page < p_cmd -> page ) ? ( p_points[i].page ) : ( p_cmd -> page ));
+			p_cmd -> col = (( p_points[i].col < p_cmd -> col ) ? ( p_points[i].col ) : ( p_cmd -> col ));
+			page_e = (( p_points[i].page > page_e ) ? ( p_points[i].page ) : ( page_e ));
+			col_e = (( p_points[i].col > col_e ) ? ( p_points[i].col ) : ( col_e ));
+		}
+
+		p_cmd -> page_size = ( page_e - p_cmd -> page + 1U );
+		p_cmd -> col_size = ( col_e - p_cmd -> col + 1U );
+		p_cmd -> text = start;
+		p_cmd -> text_num = size;
+
+		gp_frame -> text_used = ( start + size );
+	}
+
+	return p_cmd;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw command with driver primitives
+*
+*	param: 		p_cmd - Pointer to command
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_render_draw_cmd(const ili9488_render_cmd_t * const p_cmd)
+{
+	ili9488_status_t status = eILI9488_OK;
+
+	#if ( ILI9488_AA_EN )
+		const ili9488_point_t * p_points;
+	#endif
+
+	switch( p_cmd -> type )
+	{
+		case eILI9488_RENDER_CMD_RECT:
+			status = ili9488_driver_fill_rectangle( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> col_size, p_cmd -> fill_color );
+			break;
+
+		case eILI9488_RENDER_CMD_ROUND_RECT:
+			status = ili9488_driver_fill_round_rectangle( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> col_size, p_cmd -> radius, p_cmd -> border_width, p_cmd -> fill_en, p_cmd -> fill_color, p_cmd -> border_color );
+			break;
+
+		case eILI9488_RENDER_CMD_CIRCLE:
+			status = ili9488_driver_fill_circle( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> fill_color );
+			break;
+
+		case eILI9488_RENDER_CMD_BORDERED_CIRCLE:
+			status = ili9488_driver_fill_bordered_circle( p_cmd -> page, p_cmd -> col, p_cmd -> radius, p_cmd -> border_width, p_cmd -> fill_en, p_cmd -> fill_color, p_cmd -> border_color );
+			break;
+
+		case eILI9488_RENDER_CMD_ARC:
+			status = ili9488_driver_fill_arc( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> col_size, p_cmd -> angle_s, p_cmd -> angle_e, p_cmd -> fill_color );
+			break;
+
+		case eILI9488_RENDER_CMD_TEXT:
+			status = ili9488_driver_set_chars( &gp_frame -> text[ p_cmd -> text ], p_cmd -> text_num, p_cmd -> page, p_cmd -> col, p_cmd -> fill_color, p_cmd -> border_color, p_cmd -> font_opt );
+			break;
+
+		case eILI9488_RENDER_CMD_BITMAP:
+			status = ili9488_driver_draw_bitmap( p_cmd -> p_bitmap, p_cmd -> page, p_cmd -> col );
+			break;
+
+		case eILI9488_RENDER_CMD_POLYLINE:
+			status = ili9488_driver_draw_polyline((const ili9488_point_t*) &gp_frame -> text[ p_cmd -> text ], ( p_cmd -> text_num / sizeof( ili9488_point_t )), p_cmd -> fill_color );
+			break;
+
+		case eILI9488_RENDER_CMD_POLYGON:
+			status = ili9488_driver_fill_polygon((const ili9488_point_t*) &gp_frame -> text[ p_cmd -> text ], ( p_cmd -> text_num / sizeof( ili9488_point_t )), p_cmd -> fill_rule, p_cmd -> fill_color );
+			break;
+
+		#if ( ILI9488_AA_EN )
+			case eILI9488_RENDER_CMD_LINE_AA:
+				p_points = (const ili9488_point_t*) &gp_frame -> text[ p_cmd -> text ];
+				status = ili9488_driver_draw_line_aa( p_points[0].page, p_points[0].col, p_points[1].page, p_points[1].col, p_cmd -> fill_color, p_cmd -> border_color );
+				break;
+
+			case eILI9488_RENDER_CMD_CIRCLE_AA:
+				status = ili9488_driver_draw_circle_aa( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> fill_en, p_cmd -> fill_color, p_cmd -> border_color );
+				break;
+
+			case eILI9488_RENDER_CMD_TEXT_AA:
+				status = ili9488_driver_set_chars_aa( &gp_frame -> text[ p_cmd -> text ], p_cmd -> text_num, p_cmd -> page, p_cmd -> col, p_cmd -> fill_color, p_cmd -> border_color, p_cmd -> font_opt );
+				break;
+		#endif
+
+		default:
+			status = eILI9488_ERROR;
+			ILI9488_ASSERT( 0 );
+			break;
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get area covered by command
+*
+*	param: 		p_cmd - Pointer to command
+*	param: 		p_text - Pointer to text storage of command frame
+*	param: 		p_area - Pointer to area
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_render_get_area(const ili9488_render_cmd_t * const p_cmd, const char * const p_text, ili9488_region_t * const p_area)
+{
+	uint16_t radius;
+
+	switch( p_cmd -> type )
+	{
+		case eILI9488_RENDER_CMD_CIRCLE:
+		case eILI9488_RENDER_CMD_CIRCLE_AA:
+		case eILI9488_RENDER_CMD_BORDERED_CIRCLE:
+			radius = (( eILI9488_RENDER_CMD_BORDERED_CIRCLE != p_cmd -> type ) ? ( p_cmd -> page_size ) : ( p_cmd -> radius ));
+
+			ili9488_render_get_circle_area( p_cmd -> page, p_cmd -> col, radius, p_area );
+			break;
+
+		case eILI9488_RENDER_CMD_ARC:
+			ili9488_driver_get_arc_area( p_cmd -> page, p_cmd -> col, p_cmd -> page_size, p_cmd -> col_size, p_cmd -> angle_s, p_cmd -> angle_e, &p_area -> page, &p_area -> col, &p_area -> page_size, &p_area -> col_size );
+			break;
+
+		case eILI9488_RENDER_CMD_TEXT:
+			ili9488_render_get_text_area( &p_text[ p_cmd -> text ], p_cmd -> text_num, p_cmd -> page, p_cmd -> col, p_cmd -> font_opt, p_area );
+			break;
+
+		case eILI9488_RENDER_CMD_TEXT_AA:
+			// Half of font size, starting at given page
+			p_area -> page = p_cmd -> page;
+			p_area -> col = p_cmd -> col;
+			p_area -> page_size = ( p_cmd -> text_num * (( ili9488_font_get_width( p_cmd -> font_opt ) + 1U ) / 2U ));
+			p_area -> col_size = (( ili9488_font_get_height( p_cmd -> font_opt ) + 1U ) / 2U );
+			break;
+
+		default:
+			p_area -> page = p_cmd -> page;
+			p_area -> col = p_cmd -> col;
+			p_area -> page_size = p_cmd -> page_size;
+			p_area -> col_size = p_cmd -> col_size;
+			break;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Rasterise area and send it to display
+*
+*	param: 		p_area - Pointer to area, must fit strip buffer
+*	return:		status - Either Ok or Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_render_draw_area(const ili9488_region_t * const p_area)
+{
+	ili9488_status_t status = eILI9488_OK;
+	ili9488_region_t cmd_area;
+	uint32_t i;
+
+	memset( g_strip, 0, ((uint32_t) p_area -> page_size * p_area -> col_size * sizeof( ili9488_rgb_t )));
+	ili9488_driver_set_target( g_strip, p_area -> page, p_area -> col, p_area -> page_size, p_area -> col_size );
+
+	for ( i = 0; i < gp_frame -> cmd_num; i++ )
+	{
+		ili9488_render_get_area( &gp_frame -> cmd[i], gp_frame -> text, &cmd_area );
+
+		if ( true == ili9488_region_intersect( &cmd_area, p_area, &cmd_area ))
+		{
+			status |= ili9488_render_draw_cmd( &gp_frame -> cmd[i] );
+			g_render_stats.commands++;
+		}
+	}
+
+	ili9488_driver_set_target( NULL, 0, 0, 0, 0 );
+
+	// Flush
+	status |= ili9488_driver_write_buffer( g_strip, p_area -> page, p_area -> col, p_area -> page_size, p_area -> col_size );
+
+	g_render_stats.strips++;
+	g_render_stats.pixels += ((uint32_t) p_area -> page_size * p_area -> col_size );
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare two commands
+*
+*	param: 		p_a - Pointer to first command
+*	param: 		p_a_text - Text storage of first command
+*	param: 		p_b - Pointer to second command
+*	param: 		p_b_text - Text storage of second command
+*	return:		true if commands draw the same
+*/
+//////////////////////////////////////////////////////////////
+static bool ili9488_render_is_equal(const ili9488_render_cmd_t * const p_a, const char * const p_a_text, const ili9488_render_cmd_t * const p_b, const char * const p_b_text)
+{
+	bool is_equal;
+
+	is_equal = 	(	( p_a -> type == p_b -> type )
+				&&	( p_a -> page == p_b -> page )
+				&&	( p_a -> col == p_b -> col )
+				&&	( p_a -> page_size == p_b -> page_size )
+				&&	( p_a -> col_size == p_b -> col_size )
+				&&	( p_a -> text_num == p_b -> text_num )
+				&&	( p_a -> angle_s == p_b -> angle_s )
+				&&	( p_a -> angle_e == p_b -> angle_e )
+				&&	( p_a -> radius == p_b -> radius )
+				&&	( p_a -> border_width == p_b -> border_width )
+				&&	( p_a -> fill_en == p_b -> fill_en )
+				&&	( p_a -> fill_color == p_b -> fill_color )
+				&&	( p_a -> border_color == p_b -> border_color )
+				&&	( p_a -> font_opt == p_b -> font_opt )
+				&&	( p_a -> fill_rule == p_b -> fill_rule )
+				&&	( p_a -> p_bitmap == p_b -> p_bitmap ));
+
+	if (( true == is_equal ) && ( p_a -> text_num > 0U ))
+	{
+		is_equal = ( 0 == memcmp( &p_a_text[ p_a -> text ], &p_b_text[ p_b -> text ], p_a -> text_num ));
+	}
+
+	return is_equal;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Invalidate changes against previous frame
+*
+*	Commands are compared in recorded order. Every command
+*	that differs invalidates its old and new area. Pixels
+*	outside of them are covered by the same commands in the
+*	same order as before and therefore did not change.
+*
+*	NOTE: Whole display is invalidated if previous frame is
+*	not on display, even without finding changes.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void ili9488_render_diff(void)
+{
+	ili9488_region_t area;
+	uint32_t i;
+
+	// Content of display unknown
+	if ( false == gb_prev_valid )
+	{
+		(void) ili9488_render_invalidate( 0, 0, ili9488_driver_get_page_size(), ili9488_driver_get_col_size());
+	}
+
+	else if ( true == gb_find_changes )
+	{
+		for ( i = 0; ( i < gp_frame -> cmd_num ) || ( i < gp_prev_frame -> cmd_num ); i++ )
+		{
+			if 	(	( i < gp_frame -> cmd_num )
+				&&	( i < gp_prev_frame -> cmd_num )
+				&&	( true == ili9488_render_is_equal( &gp_frame -> cmd[i], gp_frame -> text, &gp_prev_frame -> cmd[i], gp_prev_frame -> text )))
+			{
+				// No change...
+			}
+			else
+			{
+				if ( i < gp_frame -> cmd_num )
+				{
+					ili9488_render_get_area( &gp_frame -> cmd[i], gp_frame -> text, &area );
+					(void) ili9488_render_invalidate( area.page, area.col, area.page_size, area.col_size );
+				}
+
+				if ( i < gp_prev_frame -> cmd_num )
+				{
+					ili9488_render_get_area( &gp_prev_frame -> cmd[i], gp_prev_frame -> text, &area );
+					(void) ili9488_render_invalidate( area.page, area.col, area.page_size, area.col_size );
+				}
+			}
+		}
+	}
+
+	else
+	{
+		// No actions...
+	}
+}
+
+#else
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_render_disabled(void);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get frame recording status
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN), so all
+*	calls draw directly.
+*
+*	param: 		none
+*	return:		Always false
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_render_is_open(void)
+{
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reset recorded frames
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_render_reset(void)
+{
+	// No actions...
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record filled rectangle
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		color - Color of rectangle
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color)
+{
+	(void) page;
+	(void) col;
+	(void) page_size;
+	(void) col_size;
+	(void) color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record rounded and/or bordered rectangle
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Size of page
+*	param: 		col_size - Size of column
+*	param: 		radius - Radius of corners
+*	param: 		border_width - Width of border
+*	param: 		fill_en - Fill interior
+*	param: 		fill_color - Color of interior
+*	param: 		border_color - Color of border
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_round_rect(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	(void) page;
+	(void) col;
+	(void) page_size;
+	(void) col_size;
+	(void) radius;
+	(void) border_width;
+	(void) fill_en;
+	(void) fill_color;
+	(void) border_color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record filled circle
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Radius of circle
+*	param: 		color - Color of circle
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_circle(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color)
+{
+	(void) page;
+	(void) col;
+	(void) radius;
+	(void) color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record bordered circle
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Radius of circle
+*	param: 		border_width - Width of border
+*	param: 		fill_en - Fill interior
+*	param: 		fill_color - Color of interior
+*	param: 		border_color - Color of border
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_bordered_circle(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color)
+{
+	(void) page;
+	(void) col;
+	(void) radius;
+	(void) border_width;
+	(void) fill_en;
+	(void) fill_color;
+	(void) border_color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record arc
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		page - Center page
+*	param: 		col - Center column
+*	param: 		radius - Outer radius
+*	param: 		width - Width of ring, radius + 1 for pie
+*	param: 		angle_s - Start angle
+*	param: 		angle_e - End angle
+*	param: 		color - Color of arc
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_arc(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color)
+{
+	(void) page;
+	(void) col;
+	(void) radius;
+	(void) width;
+	(void) angle_s;
+	(void) angle_e;
+	(void) color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record row of characters
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		p_chars - Pointer to characters
+*	param: 		num - Number of characters
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		fg_color - Foreground color
+*	param: 		bg_color - Background color
+*	param: 		font_opt - Font of choise
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_text(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+{
+	(void) p_chars;
+	(void) num;
+	(void) page;
+	(void) col;
+	(void) fg_color;
+	(void) bg_color;
+	(void) font_opt;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record bitmap
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_bitmap(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col)
+{
+	(void) p_bitmap;
+	(void) page;
+	(void) col;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record polyline
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	param: 		color - Color of line
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_polyline(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_color_t color)
+{
+	(void) p_points;
+	(void) num;
+	(void) color;
+
+	return ili9488_render_disabled();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Record polygon fill
+*
+*	Frame renderer is disabled (ILI9488_RENDER_EN).
+*
+*	param: 		p_points - Pointer to points
+*	param: 		num - Number of points
+*	param: 		rule - Fill rule
+*	param: 		color - Color of polygon
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+ili9488_status_t ili9488_render_polygon(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color)
+{
+	(void) p_points;
+	(void) num;
+	(void) rule;
+	(void) color;
+
+	return ili9488_render_disabled();
+}
+
+
+#if ( ILI9488_AA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record anti-aliased line
+	*
+	*	Frame renderer is disabled (ILI9488_RENDER_EN).
+	*
+	*	param: 		page_s - Start page
+	*	param: 		col_s - Start column
+	*	param: 		page_e - End page
+	*	param: 		col_e - End column
+	*	param: 		color - Color of line
+	*	param: 		bg_color - Background color, unused in strip
+	*	return:		status - Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_line_aa(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		(void) page_s;
+		(void) col_s;
+		(void) page_e;
+		(void) col_e;
+		(void) color;
+		(void) bg_color;
+
+		return ili9488_render_disabled();
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record anti-aliased circle
+	*
+	*	Frame renderer is disabled (ILI9488_RENDER_EN).
+	*
+	*	param: 		page - Center page
+	*	param: 		col - Center column
+	*	param: 		radius - Radius of circle
+	*	param: 		fill_en - Fill interior
+	*	param: 		color - Color of circle
+	*	param: 		bg_color - Background color, unused in strip
+	*	return:		status - Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_circle_aa(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color)
+	{
+		(void) page;
+		(void) col;
+		(void) radius;
+		(void) fill_en;
+		(void) color;
+		(void) bg_color;
+
+		return ili9488_render_disabled();
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Record row of anti-aliased characters
+	*
+	*	Frame renderer is disabled (ILI9488_RENDER_EN).
+	*
+	*	param: 		p_chars - Pointer to characters
+	*	param: 		num - Number of characters
+	*	param: 		page - Start page
+	*	param: 		col - Start column
+	*	param: 		fg_color - Foreground color
+	*	param: 		bg_color - Background color
+	*	param: 		font_opt - Font of choise, drawn at half size
+	*	return:		status - Always Error
+	*/
+	//////////////////////////////////////////////////////////////
+	ili9488_status_t ili9488_render_text_aa(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt)
+	{
+		(void) p_chars;
+		(void) num;
+		(void) page;
+		(void) col;
+		(void) fg_color;
+		(void) bg_color;
+		(void) font_opt;
+
+		return ili9488_render_disabled();
+	}
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report disabled frame renderer
+*
+*	param: 		none
+*	return:		status - Always Error
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t ili9488_render_disabled(void)
+{
+	ILI9488_DBG_PRINT( "Frame renderer not enabled..." );
+
+	return eILI9488_ERROR;
+}
+
+#endif // ILI9488_RENDER_EN
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
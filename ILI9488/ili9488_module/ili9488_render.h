@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_RENDER_H_
+#define _ILI9488_RENDER_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488.h"
+#include "ili9488_region.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+void				ili9488_render_begin			(const bool find_changes);
+ili9488_status_t	ili9488_render_end				(void);
+ili9488_status_t	ili9488_render_invalidate		(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size);
+void				ili9488_render_reset			(void);
+bool				ili9488_render_is_open			(void);
+
+ili9488_status_t	ili9488_render_rect				(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const ili9488_color_t color);
+ili9488_status_t	ili9488_render_round_rect		(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
+ili9488_status_t	ili9488_render_circle			(const uint16_t page, const uint16_t col, const uint16_t radius, const ili9488_color_t color);
+ili9488_status_t	ili9488_render_bordered_circle	(const uint16_t page, const uint16_t col, const uint8_t radius, const uint8_t border_width, const bool fill_en, const ili9488_color_t fill_color, const ili9488_color_t border_color);
+ili9488_status_t	ili9488_render_arc				(const uint16_t page, const uint16_t col, const uint16_t radius, const uint16_t width, const uint16_t angle_s, const uint16_t angle_e, const ili9488_color_t color);
+ili9488_status_t	ili9488_render_text				(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt);
+ili9488_status_t	ili9488_render_bitmap			(const ili9488_bitmap_t * const p_bitmap, const uint16_t page, const uint16_t col);
+ili9488_status_t	ili9488_render_polyline			(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_color_t color);
+ili9488_status_t	ili9488_render_polygon			(const ili9488_point_t * const p_points, const uint16_t num, const ili9488_fill_rule_t rule, const ili9488_color_t color);
+ili9488_status_t	ili9488_render_line_aa			(const uint16_t page_s, const uint16_t col_s, const uint16_t page_e, const uint16_t col_e, const ili9488_color_t color, const ili9488_color_t bg_color);
+ili9488_status_t	ili9488_render_circle_aa		(const uint16_t page, const uint16_t col, const uint16_t radius, const bool fill_en, const ili9488_color_t color, const ili9488_color_t bg_color);
+ili9488_status_t	ili9488_render_text_aa			(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_color_t fg_color, const ili9488_color_t bg_color, const ili9488_font_opt_t font_opt);
+void				ili9488_render_get_circle_area	(const uint16_t page, const uint16_t col, const uint16_t radius, ili9488_region_t * const p_area);
+void				ili9488_render_get_text_area	(const char * const p_chars, const uint32_t num, const uint16_t page, const uint16_t col, const ili9488_font_opt_t font_opt, ili9488_region_t * const p_area);
+
+void				ili9488_render_get_stats		(ili9488_render_stats_t * const p_stats);
+void				ili9488_render_reset_stats		(void);
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
+
+#endif // _ILI9488_RENDER_H_
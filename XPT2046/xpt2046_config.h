@@ -98,6 +98,10 @@
 // 	3 POINT CALIBRATION
 // **********************************************************
 
+// Display orientation of calibration points and factors
+// NOTE: Calibrated touch follows current display orientation.
+#define XPT2046_CAL_ORIENTATION			( eILI9488_ORIENTATION_LANDSCAPE )
+
 // Coordinates
 #define XPT2046_POINT_1_XY				{ 48,  32  }
 #define XPT2046_POINT_2_XY				{ 240, 288 }
@@ -105,11 +109,11 @@
 
 // Point graphics
 // NOTE: For know only rectangle is supported
-#define XPT2046_POINT_COLOR_BG			( eILI9488_COLOR_BLACK )
-#define XPT2046_POINT_COLOR_FG			( eILI9488_COLOR_YELLOW )
+#define XPT2046_POINT_COLOR_BG			( ILI9488_COLOR_BLACK )
+#define XPT2046_POINT_COLOR_FG			( ILI9488_COLOR_YELLOW )
 #define XPT2046_POINT_SIZE				( 4 )
 
-// Display limitations
+// Display limitations (in calibration orientation)
 #define XPT2046_DISPLAY_MAX_X			( 480 )
 #define XPT2046_DISPLAY_MAX_Y			( 320 )
 
@@ -128,7 +128,7 @@ ili9488_circ_attr_t g_cal_circ_attr =
 
 	.border.enable		= false,
 	.border.width		= 0,
-	.border.color		= eILI9488_COLOR_BLACK,
+	.border.color		= ILI9488_COLOR_BLACK,
 
 	.fill.enable		= true,
 };
@@ -300,6 +300,9 @@ void xpt2046_hndl(void)
 		if ( g_cal_data.done )
 		{
 			xpt2046_calibrate_data( &X, &Y, (const int32_t*)&g_cal_data.factors );
+
+			// Follow display orientation
+			(void) ili9488_map_point( XPT2046_CAL_ORIENTATION, ili9488_get_orientation(), X, Y, &X, &Y );
 		}
 
 		// Store
@@ -584,7 +587,7 @@ static void xpt2046_fsm_p1_acq(void)
 	if ( true == g_cal_fsm.time.first_entry )
 	{
 		// Clear display
-		ili9488_set_background( eILI9488_COLOR_BLACK );
+		ili9488_set_background( ILI9488_COLOR_BLACK );
 
 		// Set up P1
 		xpt2046_set_cal_point( eXPT2046_CAL_P1 );
@@ -759,14 +762,21 @@ static void xpt2046_fsm_calc_factors(void)
 //////////////////////////////////////////////////////////////
 static void xpt2046_set_cal_point(const xpt2046_points_t px)
 {
+	uint16_t page;
+	uint16_t col;
+
 	if ( px < eXPT2046_CAL_P_NUM_OF )
 	{
 		//ili9488_fill_rectangle( g_cal_data.Dp[ px ].x, g_cal_data.Dp[ px ].y, XPT2046_POINT_SIZE, XPT2046_POINT_SIZE, XPT2046_POINT_COLOR_FG );
 
-		g_cal_circ_attr.position.start_page = g_cal_data.Dp[ px ].x;
-		g_cal_circ_attr.position.start_col 	= g_cal_data.Dp[ px ].y;
-		g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_FG;
-		ili9488_draw_circle( &g_cal_circ_attr );
+		// Point is given in calibration orientation
+		if ( eILI9488_OK == ili9488_map_point( XPT2046_CAL_ORIENTATION, ili9488_get_orientation(), g_cal_data.Dp[ px ].x, g_cal_data.Dp[ px ].y, &page, &col ))
+		{
+			g_cal_circ_attr.position.start_page = page;
+			g_cal_circ_attr.position.start_col 	= col;
+			g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_FG;
+			ili9488_draw_circle( &g_cal_circ_attr );
+		}
 	}
 }
 
@@ -781,14 +791,21 @@ static void xpt2046_set_cal_point(const xpt2046_points_t px)
 //////////////////////////////////////////////////////////////
 static void xpt2046_clear_cal_point(const xpt2046_points_t px)
 {
+	uint16_t page;
+	uint16_t col;
+
 	if ( px < eXPT2046_CAL_P_NUM_OF )
 	{
 		//ili9488_fill_rectangle( g_cal_data.Dp[ px ].x, g_cal_data.Dp[ px ].y, XPT2046_POINT_SIZE, XPT2046_POINT_SIZE, XPT2046_POINT_COLOR_BG );
 
-		g_cal_circ_attr.position.start_page = g_cal_data.Dp[ px ].x;
-		g_cal_circ_attr.position.start_col 	= g_cal_data.Dp[ px ].y;
-		g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_BG;
-		ili9488_draw_circle( &g_cal_circ_attr );
+		// Point is given in calibration orientation
+		if ( eILI9488_OK == ili9488_map_point( XPT2046_CAL_ORIENTATION, ili9488_get_orientation(), g_cal_data.Dp[ px ].x, g_cal_data.Dp[ px ].y, &page, &col ))
+		{
+			g_cal_circ_attr.position.start_page = page;
+			g_cal_circ_attr.position.start_col 	= col;
+			g_cal_circ_attr.fill.color			= XPT2046_POINT_COLOR_BG;
+			ili9488_draw_circle( &g_cal_circ_attr );
+		}
 	}
 }
 
@@ -881,9 +898,9 @@ static int32_t xpt2046_limit_cal_X_data(const int32_t unlimited_data)
 	{
 		lim_data = 0;
 	}
-	else if ( unlimited_data > XPT2046_DISPLAY_MAX_X )
+	else if ( unlimited_data >= XPT2046_DISPLAY_MAX_X )
 	{
-		lim_data = XPT2046_DISPLAY_MAX_X;
+		lim_data = ( XPT2046_DISPLAY_MAX_X - 1 );
 	}
 	else
 	{
@@ -910,9 +927,9 @@ static int32_t xpt2046_limit_cal_Y_data(const int32_t unlimited_data)
 	{
 		lim_data = 0;
 	}
-	else if ( unlimited_data > XPT2046_DISPLAY_MAX_Y )
+	else if ( unlimited_data >= XPT2046_DISPLAY_MAX_Y )
 	{
-		lim_data = XPT2046_DISPLAY_MAX_Y;
+		lim_data = ( XPT2046_DISPLAY_MAX_Y - 1 );
 	}
 	else
 	{
@@ -0,0 +1,228 @@
+// Generated by ili9488_fontconv from build/font_24.bdf, 1 bpp raw
+#include "ili9488_font.h"
+
+static const uint8_t g_font_24_1bpp_data[ 1770 ] =
+{
+	0xFF, 0x87, 0xFF, 0xCF, 0xFE, 0x18, 0xE1, 0xFF, 0x80, 0x00, 0x1C, 0x3F, 0xF0, 0x06, 0x60, 0x06,
+	0x60, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x06, 0x60, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x06,
+	0x60, 0x06, 0x60, 0x0E, 0x3E, 0x03, 0xE7, 0xC0, 0xCE, 0x70, 0x18, 0xC3, 0x0F, 0x18, 0x7F, 0xE3,
+	0x8F, 0xC7, 0x33, 0x81, 0xE7, 0xE0, 0x3C, 0x78, 0x00, 0x3C, 0x80, 0xFD, 0x03, 0x9F, 0xE6, 0x1F,
+	0xEC, 0x3C, 0xFC, 0xF0, 0xDF, 0xE1, 0x9F, 0xE7, 0x02, 0xFC, 0x04, 0xF0, 0x00, 0xE1, 0xCF, 0x9F,
+	0xE7, 0x8E, 0x3C, 0x39, 0xE0, 0xEF, 0x83, 0xFC, 0x1E, 0xC1, 0xF8, 0x0C, 0xC0, 0x66, 0xE1, 0xFF,
+	0x80, 0x03, 0xF0, 0x07, 0xFF, 0x03, 0xFF, 0xF1, 0xF0, 0x3E, 0xF0, 0x03, 0xF0, 0x00, 0x30, 0xC0,
+	0x00, 0xFC, 0x00, 0xF7, 0xC0, 0xF8, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0xFC, 0x00, 0x18, 0x06, 0x01,
+	0xCC, 0x3F, 0xFF, 0x3F, 0xC0, 0xFC, 0x73, 0x18, 0x06, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+	0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x7F, 0xE7, 0x08,
+	0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0,
+	0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x0F,
+	0xE0, 0x7F, 0xF1, 0xC0, 0x76, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xB8, 0x0E, 0x3F, 0xF8,
+	0x1F, 0xC0, 0x30, 0x06, 0x60, 0x0D, 0xC0, 0x1B, 0x00, 0x37, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0x80,
+	0x03, 0x00, 0x06, 0x00, 0x0C, 0x38, 0x06, 0xF0, 0x1D, 0x80, 0x7E, 0x01, 0xBC, 0x06, 0x78, 0x18,
+	0xF0, 0x31, 0xE0, 0xC3, 0x63, 0x06, 0xFC, 0x0C, 0x70, 0x18, 0x00, 0x0C, 0xC0, 0x1D, 0x80, 0x1E,
+	0x18, 0x3C, 0x30, 0x78, 0x60, 0xF9, 0xE1, 0xBE, 0xC6, 0x38, 0xFC, 0x00, 0xF0, 0x00, 0x70, 0x01,
+	0xE0, 0x0E, 0xC0, 0x79, 0x81, 0xC3, 0x6E, 0x06, 0xF8, 0x0D, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x6C,
+	0x00, 0xD8, 0x00, 0x0D, 0xFE, 0x1B, 0xFC, 0x1E, 0x18, 0x3C, 0x60, 0x78, 0xC0, 0xF1, 0x81, 0xE3,
+	0x03, 0xC3, 0x0D, 0x87, 0xF8, 0x03, 0xC0, 0x07, 0xF0, 0x3F, 0xF8, 0xE6, 0x33, 0x98, 0x36, 0x30,
+	0x78, 0x60, 0xF0, 0xC1, 0xE0, 0xC7, 0xC1, 0xFD, 0x80, 0xF0, 0xF0, 0x01, 0xE0, 0x03, 0x00, 0x06,
+	0x00, 0x0C, 0x00, 0xF8, 0x0F, 0xF0, 0xFE, 0x6F, 0xE0, 0xFE, 0x01, 0xE0, 0x00, 0x38, 0x78, 0xF9,
+	0xFB, 0x9E, 0x3E, 0x18, 0x3C, 0x30, 0x78, 0x60, 0xF0, 0xC1, 0xF3, 0xC7, 0x7C, 0xFC, 0x70, 0xF0,
+	0x3C, 0x06, 0xFE, 0x0F, 0x8C, 0x1E, 0x0C, 0x3C, 0x18, 0x78, 0x31, 0xB0, 0x67, 0x31, 0x9C, 0x7F,
+	0xF0, 0x3F, 0x80, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x70, 0x00, 0x18, 0x07, 0xB8, 0x79, 0xC3, 0x0E,
+	0x10, 0x70, 0x00, 0x02, 0x00, 0x10, 0x01, 0xC0, 0x0E, 0x00, 0xD8, 0x06, 0xC0, 0x63, 0x03, 0x18,
+	0x30, 0x61, 0x83, 0x18, 0x0D, 0xC0, 0x7C, 0x01, 0xE0, 0x0C, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3,
+	0xCF, 0x3C, 0xF3, 0xCC, 0xC0, 0x1E, 0x00, 0xF8, 0x0E, 0xC0, 0x63, 0x06, 0x18, 0x30, 0x63, 0x03,
+	0x18, 0x0D, 0x80, 0x6C, 0x01, 0xC0, 0x0E, 0x00, 0x20, 0x01, 0x00, 0x38, 0x01, 0xE0, 0x0C, 0x00,
+	0xF0, 0x73, 0xC1, 0xCF, 0x0E, 0x0E, 0x70, 0x1F, 0x80, 0x3C, 0x00, 0x0F, 0xF8, 0x1F, 0xFF, 0x1C,
+	0x01, 0xDC, 0x00, 0x7C, 0x3C, 0x1E, 0x3F, 0x0F, 0x38, 0xC7, 0xD8, 0x63, 0x7F, 0xF3, 0x1F, 0xF9,
+	0x80, 0x00, 0x0C, 0x00, 0x30, 0x01, 0xF0, 0x1F, 0xC1, 0xEF, 0x1F, 0x3D, 0xEC, 0x3E, 0x30, 0xE0,
+	0xC1, 0xE3, 0x31, 0xFC, 0xC1, 0xF3, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0xC0, 0x0F, 0x00,
+	0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x9C, 0x37, 0xF8,
+	0xCF, 0x7E, 0x00, 0xF0, 0x0F, 0xC0, 0xFF, 0xC7, 0x03, 0x98, 0x06, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+	0xF0, 0x03, 0xC0, 0x0D, 0x80, 0x7F, 0x83, 0xBE, 0x0C, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+	0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0D, 0x80, 0x77, 0x03, 0x8F, 0xFC, 0x0F, 0xC0,
+	0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0x0F, 0x0C, 0x3C, 0xFC, 0xF3, 0xF3, 0xC0, 0x0F,
+	0x00, 0x3F, 0x87, 0xFE, 0x1F, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0x0F, 0x0C, 0x3C,
+	0xFC, 0xF3, 0xF3, 0xC0, 0x03, 0x00, 0x0F, 0x80, 0x3E, 0x00, 0x0F, 0xE0, 0xFF, 0xC7, 0x03, 0x98,
+	0x06, 0xC0, 0x0F, 0x00, 0x3C, 0x18, 0xF0, 0x63, 0xC1, 0x8D, 0x86, 0x7F, 0x9F, 0xBE, 0x7E, 0x01,
+	0x80, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0x0F, 0x0C, 0x30, 0x30, 0x00, 0xC0, 0xC3,
+	0x0F, 0x0C, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0x00, 0x30, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0,
+	0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x30, 0x01, 0xF8, 0x07, 0xE0,
+	0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x06, 0xFF, 0xFB, 0xFF, 0x8C, 0x00, 0x30,
+	0x00, 0xC0, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0x8F, 0x0C, 0x3C, 0x70, 0xC3,
+	0xE0, 0x19, 0xC3, 0xC3, 0xCE, 0x07, 0xF0, 0x07, 0xC0, 0x0F, 0x00, 0x30, 0x00, 0xC0, 0xC0, 0x0F,
+	0x00, 0x3C, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+	0x00, 0xC0, 0x3F, 0x00, 0xFC, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x78, 0x0C, 0x78, 0x30,
+	0x78, 0xC0, 0x70, 0x01, 0xC0, 0x1E, 0x31, 0xE0, 0xDE, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xF0,
+	0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x38, 0x0C, 0x78, 0x30, 0xF0, 0xF0, 0xF0, 0xC1,
+	0xE3, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0xC0, 0xFF, 0xC7, 0x87, 0x98,
+	0x06, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0x60, 0x19, 0xE1, 0xE3, 0xFF, 0x03, 0xF0, 0xC0,
+	0x0F, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC1, 0x8F, 0x06, 0x3C, 0x18, 0xF0, 0x63, 0xC1, 0x83, 0x8C,
+	0x07, 0xF0, 0x0F, 0x00, 0x0F, 0xC0, 0x1F, 0xF8, 0x1E, 0x1E, 0x6C, 0x03, 0xFC, 0x00, 0xF6, 0x00,
+	0x7B, 0x00, 0x3D, 0x80, 0x1E, 0x60, 0x19, 0xBC, 0x3C, 0xCF, 0xFC, 0xE1, 0xF8, 0x60, 0xC0, 0x0F,
+	0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xE0, 0xC3, 0xC3, 0x9B, 0xC7,
+	0xE7, 0x8F, 0x07, 0x00, 0x0C, 0x00, 0x30, 0x3C, 0x7D, 0xF9, 0xFE, 0x61, 0xB1, 0xC3, 0xC3, 0x0F,
+	0x0C, 0x3C, 0x38, 0xD8, 0x67, 0xF9, 0xFB, 0xE3, 0xC0, 0xFC, 0x03, 0xF0, 0x0C, 0x00, 0xF0, 0x03,
+	0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3F, 0xC0, 0x3F, 0x00, 0xC0, 0x03,
+	0x00, 0x0F, 0xFE, 0x3F, 0xFE, 0xC0, 0x1B, 0x00, 0x30, 0x00, 0xC0, 0x03, 0xC0, 0x0F, 0x00, 0x6F,
+	0xFF, 0xBF, 0xF8, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0E, 0x00, 0x3F, 0x00, 0xDF, 0x03,
+	0x0F, 0x8C, 0x0F, 0x80, 0x07, 0xC0, 0xFB, 0x0F, 0x8D, 0xF0, 0x3F, 0x00, 0xE0, 0x03, 0x00, 0x0C,
+	0x00, 0x00, 0xC0, 0x03, 0x00, 0x0F, 0x80, 0x3F, 0xF0, 0xC7, 0xFF, 0x01, 0xFC, 0x1F, 0x01, 0xE0,
+	0x0E, 0x00, 0x1F, 0x0C, 0x1F, 0x30, 0x1F, 0xC7, 0xFF, 0xFF, 0x0F, 0x80, 0x30, 0x00, 0xC0, 0x00,
+	0xC0, 0x0F, 0x00, 0x3E, 0x01, 0xFC, 0x0F, 0xD8, 0x6F, 0x33, 0x30, 0x78, 0x01, 0xE0, 0xCC, 0xCF,
+	0x61, 0xBF, 0x03, 0xF8, 0x07, 0xC0, 0x0F, 0x00, 0x30, 0xC0, 0x03, 0x00, 0x0E, 0x00, 0x3C, 0x03,
+	0xDC, 0x0C, 0x38, 0x30, 0x3F, 0xC0, 0xFF, 0xCE, 0x0F, 0x70, 0x3F, 0x00, 0xF8, 0x00, 0xC0, 0x03,
+	0x00, 0x00, 0x00, 0x1F, 0xF0, 0xFF, 0xC6, 0xF0, 0x33, 0xC1, 0x8F, 0x0C, 0x3C, 0x60, 0xF3, 0x03,
+	0xD8, 0x0F, 0xC3, 0xFE, 0x0F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+	0x00, 0xC0, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x07,
+	0x80, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+	0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0x06, 0x1C, 0x38, 0x70, 0xE0, 0x70, 0x38, 0x1C,
+	0x06, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x63, 0x30, 0x03, 0x88, 0xFB, 0x19, 0xE6, 0x3C, 0xC7,
+	0x98, 0xF3, 0x1E, 0x66, 0x7F, 0xE7, 0xFC, 0x01, 0x80, 0x30, 0xC0, 0x07, 0x80, 0x0F, 0xFF, 0xFF,
+	0xFF, 0xF0, 0x60, 0xC1, 0x80, 0xC3, 0x01, 0x86, 0x03, 0x0C, 0x06, 0x18, 0x0C, 0x18, 0x30, 0x3F,
+	0xE0, 0x1F, 0x00, 0x1F, 0x07, 0xF1, 0xC7, 0x30, 0x6C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x6C,
+	0x1F, 0xE7, 0x7C, 0xC0, 0x01, 0xF0, 0x0F, 0xF8, 0x18, 0x30, 0x60, 0x30, 0xC0, 0x61, 0x80, 0xC3,
+	0x01, 0xE6, 0x03, 0xC6, 0x0D, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x30, 0x00, 0x60, 0x1F, 0x0F, 0xF9,
+	0xB3, 0x66, 0x3C, 0xC7, 0x98, 0xF3, 0x1E, 0x63, 0xCC, 0x6D, 0x8D, 0xF3, 0x0E, 0x60, 0x0C, 0x06,
+	0x18, 0x0C, 0x30, 0x19, 0xFF, 0xF7, 0xFF, 0xF9, 0x80, 0xF3, 0x01, 0xE6, 0x03, 0xCC, 0x07, 0x98,
+	0x0F, 0x30, 0x06, 0x00, 0x00, 0x1F, 0x00, 0x7F, 0xC0, 0x60, 0xC3, 0xC0, 0x63, 0xC0, 0x63, 0xC0,
+	0x63, 0xC0, 0x63, 0xC0, 0x63, 0x60, 0xC6, 0xFF, 0xFE, 0xFF, 0xFC, 0xC0, 0x00, 0xC0, 0x00, 0xC0,
+	0x07, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x60, 0x61, 0x80, 0xC3, 0x00, 0x06, 0x00, 0x0C, 0x06,
+	0x1C, 0x0C, 0x1F, 0xF8, 0x1F, 0xF0, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x06, 0x18, 0x0C, 0x30, 0x18,
+	0x60, 0x30, 0xC0, 0x79, 0xFF, 0xF3, 0xFF, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00,
+	0x30, 0x0C, 0x00, 0x30, 0xC0, 0x03, 0x0C, 0x00, 0x30, 0xC0, 0x03, 0x0C, 0x00, 0x3C, 0xC0, 0x03,
+	0xCC, 0x00, 0x60, 0xFF, 0xFE, 0x0F, 0xFF, 0xC0, 0xC0, 0x07, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
+	0x0E, 0x00, 0x3E, 0x03, 0xEE, 0x07, 0x0F, 0x0C, 0x0E, 0x18, 0x0C, 0x30, 0x18, 0x00, 0x30, 0x00,
+	0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0x00, 0x06,
+	0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0xC0, 0x78, 0x0F, 0xFF, 0xFF, 0xF6, 0x07, 0x80, 0xF0, 0x07,
+	0xFF, 0x7F, 0xFC, 0x0F, 0x01, 0xE0, 0x0F, 0xFE, 0xFF, 0xC0, 0x18, 0x03, 0xC0, 0x78, 0x0F, 0xFF,
+	0xFF, 0xF6, 0x07, 0x80, 0xF0, 0x06, 0x00, 0xC0, 0x7C, 0x0D, 0xFF, 0x9F, 0xF0, 0x06, 0x00, 0xC0,
+	0x1F, 0x07, 0xF1, 0xC7, 0x30, 0x6C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0x60, 0xCE, 0x38, 0xFE, 0x0F,
+	0x80, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0xC3, 0xC0, 0x63, 0xC0, 0x63, 0xC0,
+	0x60, 0xC0, 0x60, 0xC0, 0x60, 0x60, 0xC0, 0x7F, 0xC0, 0x1F, 0x00, 0x1F, 0x00, 0x7F, 0xC0, 0x60,
+	0xC0, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x63, 0xC0, 0x63, 0x60, 0xC3, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xFF, 0xFF, 0xFE, 0x60, 0xD8, 0x1F, 0x03,
+	0xC0, 0x78, 0x0F, 0x80, 0x30, 0x00, 0x39, 0xEF, 0xBF, 0x31, 0xE6, 0x3C, 0xC7, 0x9C, 0xF1, 0x9E,
+	0x37, 0xF7, 0xDE, 0x70, 0x0C, 0x00, 0x18, 0x03, 0xFF, 0xE7, 0xFF, 0xE0, 0xC0, 0x61, 0x80, 0xC3,
+	0x01, 0x86, 0x03, 0x0C, 0x06, 0x18, 0x1C, 0x00, 0x30, 0x00, 0x60, 0xC0, 0x18, 0x03, 0xFE, 0x7F,
+	0xE0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0xC0, 0x78, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x00, 0xC0, 0xC0,
+	0x18, 0x03, 0xC0, 0x7E, 0x0C, 0xF8, 0x07, 0xC0, 0x38, 0x07, 0x03, 0xF9, 0xF3, 0xF0, 0x78, 0x0C,
+	0x01, 0x80, 0x00, 0xC0, 0x1F, 0x03, 0xFE, 0x63, 0xF0, 0x3E, 0x3E, 0x0E, 0x00, 0xF8, 0x03, 0xF8,
+	0xFF, 0xFC, 0x7C, 0x0C, 0x00, 0xC0, 0x78, 0x0F, 0x83, 0xF8, 0xFD, 0xB6, 0x1C, 0x03, 0x86, 0xDB,
+	0xF1, 0xFC, 0x1F, 0x01, 0xE0, 0x30, 0xC0, 0x00, 0xC0, 0x03, 0xE0, 0x03, 0xF8, 0x03, 0xDE, 0x03,
+	0xC7, 0x87, 0x01, 0xDF, 0x00, 0xFB, 0x01, 0xE3, 0x07, 0x80, 0xDE, 0x00, 0xF8, 0x00, 0xE0, 0x00,
+	0xC0, 0x00, 0xC0, 0x00, 0xF0, 0x7E, 0x1F, 0x07, 0xE1, 0xBC, 0x67, 0x98, 0xF6, 0x1F, 0x83, 0xE1,
+	0xF8, 0x3C, 0x00, 0x40, 0x00, 0x38, 0x07, 0xFF, 0xFB, 0xFE, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x30,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0x00, 0xF0, 0x00, 0x3F, 0xFB, 0xFD, 0xFF, 0xFE, 0x00, 0xE0,
+	0x00, 0x10, 0x00, 0x33, 0xB9, 0x8E, 0x38, 0xE3, 0x3B, 0x98,
+};
+
+static const ili9488_glyph_t g_font_24_1bpp_glyph[ 95 ] =
+{
+	{     0,   0,   0,   0,   0,   0 },	// 32
+	{     0,   3,  15,   6,   2,   0 },	// '!'
+	{     6,   8,   7,   4,   3,   0 },	// '"'
+	{    13,  11,  16,   2,   2,   0 },	// '#'
+	{    35,   9,  19,   3,   1,   0 },	// '$'
+	{    57,  10,  15,   3,   2,   0 },	// '%'
+	{    76,  11,  13,   3,   4,   0 },	// '&'
+	{    94,   3,   7,   6,   3,   0 },	// '''
+	{    97,   6,  18,   7,   2,   0 },	// '('
+	{   111,   6,  18,   3,   2,   0 },	// ')'
+	{   125,  10,  10,   3,   2,   0 },	// '*'
+	{   138,  12,  12,   2,   4,   0 },	// '+'
+	{   156,   5,   7,   6,  14,   0 },	// ','
+	{   161,  10,   2,   3,   9,   0 },	// '-'
+	{   164,   4,   3,   6,  14,   0 },	// '.'
+	{   166,  10,  20,   3,   0,   0 },	// '/'
+	{   191,  10,  15,   3,   2,   0 },	// '0'
+	{   210,  10,  15,   3,   2,   0 },	// '1'
+	{   229,  11,  15,   2,   2,   0 },	// '2'
+	{   250,  10,  15,   3,   2,   0 },	// '3'
+	{   269,  11,  15,   2,   2,   0 },	// '4'
+	{   290,  11,  15,   2,   2,   0 },	// '5'
+	{   311,  10,  15,   3,   2,   0 },	// '6'
+	{   330,  10,  15,   3,   2,   0 },	// '7'
+	{   349,  10,  15,   3,   2,   0 },	// '8'
+	{   368,  10,  15,   3,   2,   0 },	// '9'
+	{   387,   4,  11,   6,   6,   0 },	// ':'
+	{   393,   6,  13,   6,   6,   0 },	// ';'
+	{   403,  14,  13,   0,   4,   0 },	// '<'
+	{   426,  13,   6,   1,   7,   0 },	// '='
+	{   436,  14,  13,   1,   4,   0 },	// '>'
+	{   459,   9,  14,   3,   3,   0 },	// '?'
+	{   475,  10,  17,   3,   2,   0 },	// '@'
+	{   497,  16,  14,   0,   3,   0 },	// 'A'
+	{   525,  13,  14,   1,   3,   0 },	// 'B'
+	{   548,  12,  14,   2,   3,   0 },	// 'C'
+	{   569,  13,  14,   1,   3,   0 },	// 'D'
+	{   592,  12,  14,   1,   3,   0 },	// 'E'
+	{   613,  12,  14,   2,   3,   0 },	// 'F'
+	{   634,  13,  14,   2,   3,   0 },	// 'G'
+	{   657,  14,  14,   1,   3,   0 },	// 'H'
+	{   682,  10,  14,   3,   3,   0 },	// 'I'
+	{   700,  13,  14,   2,   3,   0 },	// 'J'
+	{   723,  15,  14,   1,   3,   0 },	// 'K'
+	{   750,  13,  14,   1,   3,   0 },	// 'L'
+	{   773,  16,  14,   0,   3,   0 },	// 'M'
+	{   801,  14,  14,   1,   3,   0 },	// 'N'
+	{   826,  12,  14,   2,   3,   0 },	// 'O'
+	{   847,  12,  14,   2,   3,   0 },	// 'P'
+	{   868,  12,  17,   2,   3,   0 },	// 'Q'
+	{   894,  14,  14,   1,   3,   0 },	// 'R'
+	{   919,  10,  14,   3,   3,   0 },	// 'S'
+	{   937,  12,  14,   2,   3,   0 },	// 'T'
+	{   958,  14,  14,   1,   3,   0 },	// 'U'
+	{   983,  15,  14,   1,   3,   0 },	// 'V'
+	{  1010,  17,  14,   0,   3,   0 },	// 'W'
+	{  1040,  14,  14,   1,   3,   0 },	// 'X'
+	{  1065,  14,  14,   1,   3,   0 },	// 'Y'
+	{  1090,  11,  14,   2,   3,   0 },	// 'Z'
+	{  1110,   5,  18,   7,   2,   0 },	// '['
+	{  1122,  10,  20,   3,   0,   0 },	// 92
+	{  1147,   5,  18,   4,   2,   0 },	// ']'
+	{  1159,  11,   8,   3,   1,   0 },	// '^'
+	{  1170,  16,   2,   0,  22,   0 },	// '_'
+	{  1174,   5,   4,   6,   1,   0 },	// '`'
+	{  1177,  12,  11,   2,   6,   0 },	// 'a'
+	{  1194,  13,  15,   1,   2,   0 },	// 'b'
+	{  1219,  12,  11,   2,   6,   0 },	// 'c'
+	{  1236,  13,  15,   2,   2,   0 },	// 'd'
+	{  1261,  12,  11,   2,   6,   0 },	// 'e'
+	{  1278,  12,  15,   2,   2,   0 },	// 'f'
+	{  1301,  13,  16,   2,   6,   0 },	// 'g'
+	{  1327,  14,  15,   1,   2,   0 },	// 'h'
+	{  1354,  12,  15,   2,   2,   0 },	// 'i'
+	{  1377,   9,  20,   3,   2,   0 },	// 'j'
+	{  1400,  12,  15,   2,   2,   0 },	// 'k'
+	{  1423,  12,  15,   2,   2,   0 },	// 'l'
+	{  1446,  16,  11,   0,   6,   0 },	// 'm'
+	{  1468,  14,  11,   1,   6,   0 },	// 'n'
+	{  1488,  12,  11,   2,   6,   0 },	// 'o'
+	{  1505,  13,  16,   1,   6,   0 },	// 'p'
+	{  1531,  13,  16,   2,   6,   0 },	// 'q'
+	{  1557,  12,  11,   2,   6,   0 },	// 'r'
+	{  1574,  10,  11,   3,   6,   0 },	// 's'
+	{  1588,  12,  15,   2,   2,   0 },	// 't'
+	{  1611,  14,  11,   1,   6,   0 },	// 'u'
+	{  1631,  14,  11,   1,   6,   0 },	// 'v'
+	{  1651,  13,  11,   1,   6,   0 },	// 'w'
+	{  1669,  12,  11,   2,   6,   0 },	// 'x'
+	{  1686,  15,  16,   1,   6,   0 },	// 'y'
+	{  1716,  10,  11,   3,   6,   0 },	// 'z'
+	{  1730,   6,  18,   5,   2,   0 },	// '{'
+	{  1744,   2,  18,   7,   2,   0 },	// '|'
+	{  1749,   6,  18,   5,   2,   0 },	// '}'
+	{  1763,  11,   5,   2,   8,   0 },	// '~'
+};
+
+const ili9488_font_t g_font_24_1bpp =
+{
+	.width = 17,
+	.height = 24,
+	.p_glyph = g_font_24_1bpp_glyph,
+	.p_data = g_font_24_1bpp_data,
+	.bpp = 1,
+	.is_rle = false,
+	.first = 32,
+	.num = 95,
+};
@@ -0,0 +1,189 @@
+// Generated by ili9488_fontconv from build/font_24.bdf, 2 bpp RLE
+#include "ili9488_font.h"
+
+static const uint8_t g_font_24_2bpp_data[ 1142 ] =
+{
+	0x43, 0x8B, 0x95, 0x55, 0x45, 0x8F, 0x75, 0x50, 0x50, 0x75, 0xAF, 0x05, 0x50, 0x5A, 0xFF, 0x5A,
+	0x50, 0x5A, 0xFF, 0x5A, 0x50, 0x05, 0x50, 0xB1, 0x05, 0x15, 0x01, 0xA9, 0xE0, 0x64, 0xC3, 0x55,
+	0x99, 0x75, 0x1D, 0x7D, 0x00, 0xAF, 0x14, 0x40, 0xAA, 0x94, 0xC3, 0xDD, 0xAB, 0x45, 0x16, 0xDD,
+	0x01, 0x54, 0x03, 0xA5, 0x51, 0xEA, 0x9C, 0x75, 0x74, 0x79, 0xD1, 0xF4, 0x05, 0x50, 0x87, 0x75,
+	0x50, 0xA3, 0x01, 0x50, 0x0B, 0xFF, 0x4B, 0x40, 0x79, 0x00, 0x01, 0xA3, 0x40, 0x00, 0x6D, 0x01,
+	0xE1, 0xFF, 0xE0, 0x05, 0x40, 0x9D, 0x14, 0x06, 0x15, 0xF5, 0x7D, 0x18, 0x45, 0x00, 0xA3, 0x05,
+	0x00, 0x50, 0x5A, 0x55, 0xA5, 0x05, 0x00, 0x50, 0x8B, 0x19, 0xE4, 0x40, 0x8B, 0x55, 0x55, 0x55,
+	0x83, 0xDD, 0x07, 0xAB, 0x50, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x69, 0x00, 0x79, 0x00, 0x05, 0x07,
+	0xAF, 0x05, 0x50, 0x75, 0x68, 0xC0, 0x05, 0xC0, 0x05, 0x75, 0x68, 0x05, 0x50, 0xAF, 0x10, 0x05,
+	0x70, 0x05, 0x65, 0x59, 0x55, 0x59, 0x00, 0x05, 0x00, 0x05, 0xAF, 0x74, 0x09, 0x90, 0x29, 0xC0,
+	0x95, 0xC1, 0x85, 0x66, 0x05, 0x14, 0x05, 0x05, 0xA9, 0x45, 0x00, 0x9C, 0x30, 0x5D, 0x74, 0x57,
+	0x99, 0xC0, 0x05, 0x40, 0x03, 0xAB, 0xB0, 0x07, 0x70, 0x64, 0x35, 0xE5, 0x79, 0x55, 0x79, 0x00,
+	0x15, 0xAF, 0x55, 0x0C, 0xD7, 0x05, 0xC5, 0x05, 0xC5, 0x05, 0xC3, 0x5C, 0x00, 0x50, 0xAF, 0x05,
+	0x50, 0x2A, 0x9C, 0x63, 0x05, 0xC3, 0x05, 0xC1, 0x9D, 0x40, 0x54, 0xAF, 0x50, 0x00, 0xD0, 0x00,
+	0xC0, 0x05, 0xC1, 0xB9, 0xEE, 0x40, 0x50, 0x00, 0xAF, 0x14, 0x54, 0xA9, 0x9D, 0xC3, 0x05, 0xC3,
+	0x05, 0xA9, 0x9D, 0x14, 0x54, 0xAF, 0x14, 0x05, 0xA7, 0x05, 0xC1, 0x45, 0xC1, 0x5C, 0x67, 0x74,
+	0x15, 0x40, 0x8B, 0xD0, 0xDD, 0x0D, 0x03, 0x90, 0x67, 0x46, 0x4D, 0x10, 0x00, 0xB0, 0x01, 0x00,
+	0x1C, 0x00, 0xD4, 0x05, 0x30, 0x30, 0x52, 0x40, 0xDC, 0x01, 0x40, 0x9B, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0xB7, 0x40, 0x17, 0x40, 0x96, 0x06, 0x09, 0x24, 0x19, 0x80, 0x29, 0x00, 0x60,
+	0x00, 0x40, 0xA7, 0x14, 0x00, 0x64, 0x05, 0x50, 0xD5, 0x62, 0x80, 0x2E, 0x00, 0xB5, 0x05, 0x54,
+	0x1D, 0x56, 0x8D, 0x14, 0x27, 0x29, 0x85, 0xAD, 0x72, 0x45, 0x54, 0x40, 0x05, 0xB9, 0x55, 0x01,
+	0xD5, 0x1E, 0x56, 0xD5, 0x07, 0x45, 0x50, 0x7D, 0x50, 0x06, 0xD0, 0x00, 0x50, 0xB7, 0x50, 0x05,
+	0x65, 0x59, 0x66, 0x99, 0x51, 0x45, 0x51, 0x45, 0x77, 0x85, 0x15, 0xB8, 0xAF, 0x1B, 0xE4, 0x34,
+	0x1C, 0x50, 0x05, 0x50, 0x05, 0x60, 0x09, 0x7C, 0x18, 0xB7, 0x50, 0x05, 0x65, 0x59, 0x65, 0x59,
+	0x50, 0x05, 0x50, 0x05, 0x34, 0x1D, 0x1B, 0xE4, 0xB7, 0x50, 0x05, 0x65, 0x59, 0x66, 0x99, 0x56,
+	0x95, 0x55, 0x55, 0x64, 0x19, 0x54, 0x15, 0xAF, 0x50, 0x05, 0x7F, 0xFD, 0x51, 0x45, 0x57, 0xD5,
+	0x50, 0x00, 0x7C, 0x00, 0xB7, 0x1B, 0xF4, 0x34, 0x1C, 0x50, 0x05, 0x50, 0xC5, 0x60, 0xC9, 0x7C,
+	0xFC, 0x00, 0x40, 0xBF, 0x50, 0x05, 0x65, 0x59, 0x66, 0x99, 0x51, 0x45, 0x51, 0x45, 0x66, 0x99,
+	0x65, 0x59, 0x50, 0x05, 0xAF, 0x50, 0x05, 0x50, 0x05, 0x65, 0x59, 0x65, 0x59, 0x50, 0x05, 0x50,
+	0x05, 0x03, 0xB3, 0xFC, 0x50, 0x05, 0x50, 0x05, 0x50, 0x09, 0x7F, 0xF4, 0x50, 0x00, 0x50, 0x00,
+	0xBF, 0x50, 0x05, 0x65, 0x59, 0x65, 0xD9, 0x52, 0x45, 0x09, 0xD0, 0x74, 0x79, 0x50, 0x09, 0x50,
+	0x05, 0xB7, 0x50, 0x05, 0x50, 0x05, 0x7F, 0xFD, 0x50, 0x05, 0x50, 0x05, 0x00, 0x05, 0x00, 0x7D,
+	0xBF, 0x50, 0x05, 0x7F, 0xFD, 0x1D, 0x05, 0x01, 0xD5, 0x01, 0xD5, 0x1D, 0x05, 0x7F, 0xFD, 0x50,
+	0x05, 0xBF, 0x50, 0x05, 0x65, 0x59, 0x6D, 0x59, 0x0B, 0x45, 0x51, 0xE0, 0x65, 0x79, 0x65, 0x55,
+	0x50, 0x00, 0xAF, 0x1B, 0xE4, 0x34, 0x1C, 0x50, 0x05, 0x50, 0x05, 0x34, 0x1C, 0x1B, 0xE4, 0xAF,
+	0x50, 0x05, 0x7F, 0xFD, 0x50, 0xC5, 0x50, 0xC5, 0x61, 0x80, 0x2E, 0x40, 0xB5, 0x1B, 0xE4, 0x0D,
+	0x07, 0x75, 0x00, 0x75, 0x40, 0x1D, 0x34, 0x1C, 0xC6, 0xF9, 0x60, 0xBF, 0x50, 0x05, 0x65, 0x59,
+	0x66, 0x99, 0x51, 0x45, 0x51, 0xD0, 0x77, 0x78, 0x15, 0x09, 0x00, 0x05, 0xAF, 0x15, 0x15, 0x77,
+	0x1D, 0x52, 0x45, 0x51, 0x85, 0x74, 0xDD, 0x54, 0x54, 0xAF, 0x7D, 0x00, 0x50, 0x05, 0x65, 0x59,
+	0x65, 0x59, 0x50, 0x05, 0x7D, 0x00, 0xBF, 0x50, 0x00, 0x65, 0x50, 0x65, 0x5C, 0x50, 0x05, 0x50,
+	0x05, 0x65, 0x5C, 0x65, 0x50, 0x50, 0x00, 0xBF, 0x50, 0x00, 0x60, 0x00, 0x6E, 0x40, 0x51, 0xB4,
+	0x50, 0x5D, 0x56, 0x90, 0x75, 0x00, 0x50, 0x00, 0xBF, 0x50, 0x00, 0x7D, 0x50, 0x51, 0x7D, 0x51,
+	0xD4, 0x07, 0x50, 0x50, 0x79, 0x67, 0xE5, 0x64, 0x00, 0x87, 0x50, 0x00, 0xBF, 0x50, 0x05, 0x60,
+	0x09, 0x68, 0x29, 0x56, 0x95, 0x56, 0x95, 0x68, 0x29, 0x60, 0x09, 0x50, 0x05, 0xBF, 0x50, 0x00,
+	0x60, 0x00, 0x69, 0x05, 0x06, 0x59, 0x56, 0x59, 0x69, 0x05, 0x60, 0x00, 0x50, 0x00, 0xAF, 0x55,
+	0x1D, 0x65, 0x65, 0x51, 0x85, 0x56, 0x05, 0x68, 0x59, 0x50, 0x55, 0x9A, 0x55, 0x55, 0x75, 0x55,
+	0x7C, 0x00, 0x0C, 0x81, 0x50, 0x07, 0x83, 0x79, 0x07, 0x83, 0x69, 0x07, 0x83, 0x69, 0x07, 0x83,
+	0x6D, 0x07, 0x81, 0x50, 0x9A, 0xC0, 0x00, 0xF5, 0x55, 0x75, 0x55, 0x54, 0x9D, 0x01, 0x41, 0x82,
+	0x81, 0xD0, 0x1D, 0x00, 0x90, 0x47, 0x88, 0x50, 0x91, 0x40, 0xA3, 0x47, 0x8C, 0x95, 0xCC, 0x5C,
+	0xC9, 0x7F, 0xD0, 0x05, 0xB7, 0x40, 0x05, 0xD5, 0x59, 0x5A, 0x5D, 0x0C, 0x05, 0x0C, 0x05, 0x09,
+	0x09, 0x06, 0xF4, 0xA3, 0x2F, 0x46, 0x1C, 0xC0, 0x5C, 0x05, 0x90, 0x9F, 0x58, 0xB7, 0x06, 0xF4,
+	0x09, 0x09, 0x0C, 0x05, 0x4C, 0x05, 0xDA, 0x5D, 0x55, 0x59, 0x00, 0x05, 0xA3, 0x6F, 0x49, 0xC9,
+	0xCC, 0x5C, 0xC5, 0x9C, 0x56, 0xCC, 0xAF, 0x0C, 0x05, 0x1D, 0x59, 0x9D, 0x59, 0xCC, 0x05, 0xCC,
+	0x05, 0xC4, 0x00, 0xB7, 0x6F, 0x40, 0x90, 0x93, 0xC0, 0x53, 0xC0, 0x53, 0xA5, 0xD9, 0xD5, 0x54,
+	0x40, 0x00, 0xBF, 0x40, 0x05, 0xD5, 0x59, 0x5A, 0x59, 0x0C, 0x05, 0x0C, 0x05, 0x0A, 0x59, 0x01,
+	0x59, 0x00, 0x05, 0xAF, 0x04, 0x05, 0x0C, 0x05, 0x4D, 0x59, 0x45, 0x59, 0x00, 0x05, 0x00, 0x05,
+	0xB1, 0x04, 0x00, 0x10, 0xC0, 0x03, 0x0C, 0x00, 0x3C, 0xC0, 0x06, 0x0F, 0xFF, 0xD0, 0xAF, 0xC0,
+	0x05, 0xFF, 0xFD, 0x01, 0xE0, 0x0E, 0x69, 0x0C, 0x09, 0x04, 0x05, 0xAF, 0x40, 0x05, 0xC0, 0x05,
+	0xD5, 0x59, 0x55, 0x59, 0x00, 0x05, 0x00, 0x05, 0xAF, 0xC0, 0x5F, 0xFD, 0x90, 0x5D, 0x55, 0xA5,
+	0x9C, 0x05, 0xBF, 0xD0, 0x05, 0xAF, 0x40, 0x5D, 0x59, 0xA5, 0x9C, 0x05, 0xC0, 0x5A, 0x59, 0x15,
+	0x90, 0x05, 0xA3, 0x2F, 0x46, 0x1C, 0xC0, 0x5C, 0x05, 0x61, 0xC2, 0xF4, 0xB7, 0x40, 0x01, 0xD5,
+	0x57, 0xA5, 0xD7, 0xC0, 0x53, 0xC0, 0x50, 0x90, 0x90, 0x6F, 0x40, 0xB7, 0x6F, 0x40, 0x90, 0x90,
+	0xC0, 0x50, 0xC0, 0x53, 0xA5, 0xD7, 0xD5, 0x57, 0x40, 0x01, 0xA3, 0xC0, 0x5D, 0x59, 0x75, 0x99,
+	0x05, 0xC0, 0x59, 0x00, 0xA3, 0x15, 0x59, 0xD9, 0xCC, 0x5C, 0x95, 0xD6, 0xD5, 0x14, 0xAF, 0x0C,
+	0x00, 0xFF, 0xF8, 0x0C, 0x05, 0x0C, 0x05, 0x0C, 0x09, 0x00, 0x0C, 0xAF, 0x40, 0x0D, 0x54, 0x55,
+	0x90, 0x05, 0x40, 0x5D, 0x5D, 0x55, 0x90, 0x05, 0xAF, 0x40, 0x0D, 0x00, 0xDD, 0x40, 0x1D, 0x01,
+	0xDD, 0xD4, 0xD0, 0x04, 0x00, 0xA9, 0x40, 0x0F, 0x94, 0x47, 0xD2, 0x90, 0x17, 0x5D, 0xB5, 0xD4,
+	0x00, 0xA3, 0xC0, 0x5E, 0x1D, 0x5A, 0x55, 0xA5, 0xE1, 0xDC, 0x05, 0xBF, 0x40, 0x00, 0xD0, 0x03,
+	0xE9, 0x03, 0x46, 0x9B, 0x01, 0xE7, 0x5A, 0x40, 0xE4, 0x00, 0xC0, 0x00, 0xA3, 0x50, 0x5D, 0x1D,
+	0xC6, 0x5D, 0x85, 0xE1, 0x94, 0x15, 0x03, 0x9F, 0x40, 0x15, 0x79, 0x5D, 0x55, 0x5D, 0x00, 0x01,
+	0x91, 0x55, 0x55, 0x55, 0x55, 0x50, 0xA3, 0x40, 0x00, 0x75, 0x55, 0x75, 0x5E, 0x54, 0x01, 0x00,
+	0x91, 0x73, 0x4A, 0x09, 0x75, 0x40,
+};
+
+static const ili9488_glyph_t g_font_24_2bpp_glyph[ 95 ] =
+{
+	{     0,   0,   0,   0,   0,   0 },	// 32
+	{     0,   2,   8,   3,   1,   0 },	// '!'
+	{     5,   4,   4,   2,   1,   0 },	// '"'
+	{    10,   6,   8,   1,   1,   0 },	// '#'
+	{    23,   5,  10,   1,   0,   0 },	// '$'
+	{    37,   6,   8,   1,   1,   0 },	// '%'
+	{    50,   6,   7,   1,   2,   0 },	// '&'
+	{    62,   2,   4,   3,   1,   0 },	// '''
+	{    65,   4,   9,   3,   1,   0 },	// '('
+	{    75,   4,   9,   1,   1,   0 },	// ')'
+	{    85,   6,   5,   1,   1,   0 },	// '*'
+	{    94,   6,   6,   1,   2,   0 },	// '+'
+	{   104,   3,   4,   3,   7,   0 },	// ','
+	{   108,   6,   2,   1,   4,   0 },	// '-'
+	{   112,   2,   2,   3,   7,   0 },	// '.'
+	{   114,   6,  10,   1,   0,   0 },	// '/'
+	{   128,   6,   8,   1,   1,   0 },	// '0'
+	{   141,   6,   8,   1,   1,   0 },	// '1'
+	{   154,   6,   8,   1,   1,   0 },	// '2'
+	{   167,   6,   8,   1,   1,   0 },	// '3'
+	{   180,   6,   8,   1,   1,   0 },	// '4'
+	{   193,   6,   8,   1,   1,   0 },	// '5'
+	{   206,   6,   8,   1,   1,   0 },	// '6'
+	{   219,   6,   8,   1,   1,   0 },	// '7'
+	{   232,   6,   8,   1,   1,   0 },	// '8'
+	{   245,   6,   8,   1,   1,   0 },	// '9'
+	{   258,   2,   6,   3,   3,   0 },	// ':'
+	{   262,   3,   7,   3,   3,   0 },	// ';'
+	{   269,   7,   7,   0,   2,   0 },	// '<'
+	{   283,   7,   4,   0,   3,   0 },	// '='
+	{   291,   8,   7,   0,   2,   0 },	// '>'
+	{   306,   5,   8,   1,   1,   0 },	// '?'
+	{   317,   6,   9,   1,   1,   0 },	// '@'
+	{   332,   8,   8,   0,   1,   0 },	// 'A'
+	{   349,   7,   8,   0,   1,   0 },	// 'B'
+	{   364,   6,   8,   1,   1,   0 },	// 'C'
+	{   377,   7,   8,   0,   1,   0 },	// 'D'
+	{   392,   7,   8,   0,   1,   0 },	// 'E'
+	{   407,   6,   8,   1,   1,   0 },	// 'F'
+	{   420,   7,   8,   1,   1,   0 },	// 'G'
+	{   435,   8,   8,   0,   1,   0 },	// 'H'
+	{   452,   6,   8,   1,   1,   0 },	// 'I'
+	{   465,   7,   8,   1,   1,   0 },	// 'J'
+	{   480,   8,   8,   0,   1,   0 },	// 'K'
+	{   497,   7,   8,   0,   1,   0 },	// 'L'
+	{   512,   8,   8,   0,   1,   0 },	// 'M'
+	{   529,   8,   8,   0,   1,   0 },	// 'N'
+	{   546,   6,   8,   1,   1,   0 },	// 'O'
+	{   559,   6,   8,   1,   1,   0 },	// 'P'
+	{   572,   6,   9,   1,   1,   0 },	// 'Q'
+	{   587,   8,   8,   0,   1,   0 },	// 'R'
+	{   604,   6,   8,   1,   1,   0 },	// 'S'
+	{   617,   6,   8,   1,   1,   0 },	// 'T'
+	{   630,   8,   8,   0,   1,   0 },	// 'U'
+	{   647,   8,   8,   0,   1,   0 },	// 'V'
+	{   664,   9,   8,   0,   1,   0 },	// 'W'
+	{   684,   8,   8,   0,   1,   0 },	// 'X'
+	{   701,   8,   8,   0,   1,   0 },	// 'Y'
+	{   718,   6,   8,   1,   1,   0 },	// 'Z'
+	{   731,   3,   9,   3,   1,   0 },	// '['
+	{   739,   6,  10,   1,   0,   0 },	// 92
+	{   756,   3,   9,   2,   1,   0 },	// ']'
+	{   764,   6,   5,   1,   0,   0 },	// '^'
+	{   773,   8,   1,   0,  11,   0 },	// '_'
+	{   774,   3,   3,   3,   0,   0 },	// '`'
+	{   778,   6,   6,   1,   3,   0 },	// 'a'
+	{   788,   7,   8,   0,   1,   0 },	// 'b'
+	{   803,   6,   6,   1,   3,   0 },	// 'c'
+	{   813,   7,   8,   1,   1,   0 },	// 'd'
+	{   828,   6,   6,   1,   3,   0 },	// 'e'
+	{   838,   6,   8,   1,   1,   0 },	// 'f'
+	{   851,   7,   8,   1,   3,   0 },	// 'g'
+	{   866,   8,   8,   0,   1,   0 },	// 'h'
+	{   883,   6,   8,   1,   1,   0 },	// 'i'
+	{   896,   5,  10,   1,   1,   0 },	// 'j'
+	{   910,   6,   8,   1,   1,   0 },	// 'k'
+	{   923,   6,   8,   1,   1,   0 },	// 'l'
+	{   936,   8,   6,   0,   3,   0 },	// 'm'
+	{   949,   8,   6,   0,   3,   0 },	// 'n'
+	{   962,   6,   6,   1,   3,   0 },	// 'o'
+	{   972,   7,   8,   0,   3,   0 },	// 'p'
+	{   987,   7,   8,   1,   3,   0 },	// 'q'
+	{  1002,   6,   6,   1,   3,   0 },	// 'r'
+	{  1012,   6,   6,   1,   3,   0 },	// 's'
+	{  1022,   6,   8,   1,   1,   0 },	// 't'
+	{  1035,   8,   6,   0,   3,   0 },	// 'u'
+	{  1048,   8,   6,   0,   3,   0 },	// 'v'
+	{  1061,   7,   6,   0,   3,   0 },	// 'w'
+	{  1073,   6,   6,   1,   3,   0 },	// 'x'
+	{  1083,   8,   8,   0,   3,   0 },	// 'y'
+	{  1100,   6,   6,   1,   3,   0 },	// 'z'
+	{  1110,   4,   9,   2,   1,   0 },	// '{'
+	{  1120,   2,   9,   3,   1,   0 },	// '|'
+	{  1126,   4,   9,   2,   1,   0 },	// '}'
+	{  1136,   6,   3,   1,   4,   0 },	// '~'
+};
+
+const ili9488_font_t g_font_24_2bpp =
+{
+	.width = 9,
+	.height = 12,
+	.p_glyph = g_font_24_2bpp_glyph,
+	.p_data = g_font_24_2bpp_data,
+	.bpp = 2,
+	.is_rle = true,
+	.first = 32,
+	.num = 95,
+};
@@ -0,0 +1,42 @@
+// Test font for kerning and glyph overlap, written by hand in format
+// of ili9488_fontconv, 1 bpp raw. Glyphs are solid boxes, see test_kern.c
+#include "ili9488_font.h"
+
+static const uint8_t g_font_kern_data[ 15 ] =
+{
+	0xFF, 0xFF, 0xFF,										// 'A' 4x6
+	0xFF, 0xFF,												// 'B' 2x8
+	0xFF, 0xFF,												// 'C' 8x2
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,			// 'E' 8x8, first and last page
+};
+
+static const ili9488_glyph_t g_font_kern_glyph[ 5 ] =
+{
+	{     0,   4,   6,   1,   1,   6 },	// 'A'
+	{     3,   2,   8,   0,   0,   3 },	// 'B'
+	{     5,   8,   2,   0,   6,   4 },	// 'C', reaches into next character
+	{     7,   0,   0,   0,   0,   0 },	// 'D', empty, advances for font width
+	{     7,   8,   8,   0,   0,   1 },	// 'E', overlaps next seven characters
+};
+
+static const ili9488_kern_t g_font_kern_kern[ 4 ] =
+{
+	{  65,  66,   -3 },	// 'A' 'B'
+	{  66,  65,    2 },	// 'B' 'A'
+	{  66,  66,   -5 },	// 'B' 'B'
+	{  67,  65,   -2 },	// 'C' 'A'
+};
+
+const ili9488_font_t g_font_kern =
+{
+	.width = 6,
+	.height = 8,
+	.p_glyph = g_font_kern_glyph,
+	.p_data = g_font_kern_data,
+	.bpp = 1,
+	.is_rle = false,
+	.first = 65,
+	.num = 5,
+	.p_kern = g_font_kern_kern,
+	.kern_num = 4,
+};
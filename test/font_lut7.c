@@ -0,0 +1,20 @@
+// Test font in format of built-in fonts, 5x7 px lut of characters
+// 32 to 35, written by hand. Glyph has odd number of pixels, so it
+// ends inside of byte in 3-bit pixel format, see test_cache.c. No
+// glyph table, so it is drawn as font lut.
+#include "ili9488_font.h"
+
+static const uint8_t g_font_lut7_lut[ 28 ] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	// ' '
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20,	// '!'
+	0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,	// '"'
+	0x50, 0xF8, 0x50, 0x50, 0xF8, 0x50, 0x00,	// '#'
+};
+
+const ili9488_font_t g_font_lut7 =
+{
+	.p_font = g_font_lut7_lut,
+	.width = 5,
+	.height = 7,
+};
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Writes built-in 24 px font as BDF, for font tests.
+//	Every glyph covers whole 17x24 character cell, so font
+//	compiled from it with ili9488_fontconv must draw same
+//	pixels as built-in font.
+//
+//		./gen_font font_24.bdf
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_font.h"
+
+#include <stdio.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Characters of font lut
+#define GEN_FONT_FIRST				( 32U )
+#define GEN_FONT_LAST				( 126U )
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, output file
+*	return:		0 on success
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	const ili9488_font_t * p_font = ili9488_font_get( eILI9488_FONT_24 );
+	const uint8_t * p_glyph;
+	FILE * p_f;
+	uint32_t line_size_byte;
+	uint32_t c;
+	uint32_t i;
+	uint32_t b;
+
+	if ( 2 != argc )
+	{
+		fprintf( stderr, "Usage: gen_font output.bdf\n" );
+		return 1;
+	}
+
+	p_f = fopen( argv[1], "w" );
+
+	if (( NULL == p_f ) || ( NULL == p_font ))
+	{
+		fprintf( stderr, "Cannot create %s\n", argv[1] );
+		return 1;
+	}
+
+	// Rows of lut as in driver, leftmost pixel is MSB
+	line_size_byte = (( p_font -> width / 8U ) + 1U );
+
+	fprintf( p_f, "STARTFONT 2.1\n" );
+	fprintf( p_f, "FONT ili9488_font_24\n" );
+	fprintf( p_f, "SIZE %u 75 75\n", p_font -> height );
+	fprintf( p_f, "FONTBOUNDINGBOX %u %u 0 0\n", p_font -> width, p_font -> height );
+	fprintf( p_f, "STARTPROPERTIES 2\n" );
+	fprintf( p_f, "FONT_ASCENT %u\n", p_font -> height );
+	fprintf( p_f, "FONT_DESCENT 0\n" );
+	fprintf( p_f, "ENDPROPERTIES\n" );
+	fprintf( p_f, "CHARS %u\n", ( GEN_FONT_LAST - GEN_FONT_FIRST + 1U ));
+
+	for ( c = GEN_FONT_FIRST; c <= GEN_FONT_LAST; c++ )
+	{
+		p_glyph = &p_font -> p_font[ ( c - GEN_FONT_FIRST ) * line_size_byte * p_font -> height ];
+
+		fprintf( p_f, "STARTCHAR U+%04X\n", c );
+		fprintf( p_f, "ENCODING %u\n", c );
+		fprintf( p_f, "DWIDTH %u 0\n", p_font -> width );
+		fprintf( p_f, "BBX %u %u 0 0\n", p_font -> width, p_font -> height );
+		fprintf( p_f, "BITMAP\n" );
+
+		for ( i = 0; i < p_font -> height; i++ )
+		{
+			for ( b = 0; b < line_size_byte; b++ )
+			{
+				fprintf( p_f, "%02X", p_glyph[ ( i * line_size_byte ) + b ] );
+			}
+
+			fprintf( p_f, "\n" );
+		}
+
+		fprintf( p_f, "ENDCHAR\n" );
+	}
+
+	fprintf( p_f, "ENDFONT\n" );
+
+	return (( 0 == fclose( p_f )) ? ( 0 ) : ( 1 ));
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Writes test image for image tests as binary PPM (P6).
+//	Image has gradient, flat areas, repeated pattern and
+//	noise, so that literals, runs and copies of compressed
+//	formats are all used.
+//
+//		./gen_image image.ppm
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Image size, see test_image.c
+#define GEN_IMAGE_WIDTH				( 160U )
+#define GEN_IMAGE_HEIGHT			( 100U )
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, output file
+*	return:		0 on success
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	FILE * p_f;
+	uint32_t seed = 1U;
+	uint32_t x;
+	uint32_t y;
+	int32_t dx;
+	int32_t dy;
+	uint8_t rgb[3];
+
+	if ( 2 != argc )
+	{
+		fprintf( stderr, "Usage: gen_image output.ppm\n" );
+		return 1;
+	}
+
+	p_f = fopen( argv[1], "wb" );
+
+	if ( NULL == p_f )
+	{
+		fprintf( stderr, "Cannot create %s\n", argv[1] );
+		return 1;
+	}
+
+	fprintf( p_f, "P6\n%u %u\n255\n", GEN_IMAGE_WIDTH, GEN_IMAGE_HEIGHT );
+
+	for ( y = 0; y < GEN_IMAGE_HEIGHT; y++ )
+	{
+		for ( x = 0; x < GEN_IMAGE_WIDTH; x++ )
+		{
+			dx = ((int32_t) x - 40 );
+			dy = ((int32_t) y - 50 );
+
+			// Gradient
+			rgb[0] = (uint8_t)( 20U + y );
+			rgb[1] = (uint8_t)( 40U + ( y / 2U ));
+			rgb[2] = 160U;
+
+			// Flat disk
+			if ((( dx * dx ) + ( dy * dy )) < ( 30 * 30 ))
+			{
+				rgb[0] = 250U;
+				rgb[1] = 200U;
+				rgb[2] = 30U;
+			}
+
+			// Repeated stripes
+			if (( x >= 80U ) && ( x < 120U ))
+			{
+				rgb[0] = ((( x / 4U ) & 1U ) ? ( 255U ) : ( 0U ));
+				rgb[1] = rgb[0];
+				rgb[2] = rgb[0];
+			}
+
+			// Noise
+			if (( x >= 120U ) && ( y >= 60U ))
+			{
+				seed = (( seed * 1103515245U ) + 12345U );
+				rgb[0] = (uint8_t)( seed >> 16 );
+				rgb[1] = (uint8_t)( seed >> 8 );
+				rgb[2] = (uint8_t)( seed >> 24 );
+			}
+
+			fwrite( rgb, 1, 3, p_f );
+		}
+	}
+
+	return (( 0 == fclose( p_f )) ? ( 0 ) : ( 1 ));
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
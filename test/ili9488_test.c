@@ -0,0 +1,354 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Common part of host tests. Display stack runs on
+//	ILI9488 emulator, results are taken from its GRAM and
+//	transport statistics.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Number of checks
+static uint32_t gu32_checks;
+static uint32_t gu32_fails;
+
+// Emulator transport, blocking transmit can drop data
+static ili9488_transport_t g_transport;
+static pf_spi_tx_t gpf_transmit;
+static bool gb_drop;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_test_transmit(const uint8_t * p_data, const uint32_t size);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Init display on emulator
+*
+*	Driver can be initialized only once, so transport is
+*	chosen for whole test run.
+*
+*	param: 		async - Complete bursts from separate thread
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_init(const bool async)
+{
+	g_transport = *ili9488_emu_get_transport( async );
+	gpf_transmit = g_transport.pf_transmit;
+	g_transport.pf_transmit = &ili9488_test_transmit;
+
+	ili9488_emu_reset();
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_transport( &g_transport ), "set transport" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_init(), "init" );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+	ili9488_emu_reset_stats();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get transport from test arguments
+*
+*	Non-blocking transport is selected with "async" as
+*	first argument.
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments
+*	return:		True when non-blocking transport is selected
+*/
+//////////////////////////////////////////////////////////////
+bool ili9488_test_is_async(const int argc, char ** const argv)
+{
+	return (( argc > 1 ) && ( 0 == strcmp( argv[1], "async" )));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check condition
+*
+*	param: 		cond - Condition, false when check failed
+*	param: 		p_file - Source file of check
+*	param: 		line - Source line of check
+*	param: 		p_format - Description of check
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_check(const bool cond, const char * const p_file, const int line, const char * const p_format, ...)
+{
+	va_list args;
+
+	gu32_checks++;
+
+	if ( false == cond )
+	{
+		gu32_fails++;
+
+		va_start( args, p_format );
+		printf( "%s:%d: FAIL: ", p_file, line );
+		vprintf( p_format, args );
+		printf( "\n" );
+		va_end( args );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Take snapshot of emulated GRAM
+*
+*	param: 		p_gram - Pointer to snapshot
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_snapshot(ili9488_test_gram_t * const p_gram)
+{
+	ili9488_rgb_t rgb;
+	uint16_t x;
+	uint16_t y;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	for ( y = 0; y < ILI9488_EMU_HEIGHT; y++ )
+	{
+		for ( x = 0; x < ILI9488_EMU_WIDTH; x++ )
+		{
+			(void) ili9488_emu_get_pixel( x, y, &rgb );
+
+			p_gram -> rgb[y][x][0] = rgb.R;
+			p_gram -> rgb[y][x][1] = rgb.G;
+			p_gram -> rgb[y][x][2] = rgb.B;
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get pixel of emulated GRAM in display coordinates
+*
+*	Page and column are of current orientation. Flipped
+*	landscape has same axes as GRAM of emulator.
+*
+*	param: 		page - Page of pixel
+*	param: 		col - Column of pixel
+*	param: 		p_rgb - Pointer to pixel color
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_get_pixel(const uint16_t page, const uint16_t col, ili9488_rgb_t * const p_rgb)
+{
+	uint16_t y;
+	uint16_t x;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_map_point( ili9488_get_orientation(), eILI9488_ORIENTATION_LANDSCAPE_FLIP, page, col, &y, &x ), "map point" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_emu_get_pixel( x, y, p_rgb ), "pixel %u, %u", page, col );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare GRAM snapshots
+*
+*	param: 		p_a - Pointer to first snapshot
+*	param: 		p_b - Pointer to second snapshot
+*	param: 		tolerance - Allowed difference of channel
+*	param: 		p_max_diff - Largest difference of channel
+*	return:		num - Number of pixels out of tolerance
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_test_compare(const ili9488_test_gram_t * const p_a, const ili9488_test_gram_t * const p_b, const uint8_t tolerance, uint8_t * const p_max_diff)
+{
+	uint32_t num = 0;
+	uint16_t x;
+	uint16_t y;
+	uint8_t ch;
+	uint8_t diff;
+	bool is_out;
+
+	*p_max_diff = 0;
+
+	for ( y = 0; y < ILI9488_EMU_HEIGHT; y++ )
+	{
+		for ( x = 0; x < ILI9488_EMU_WIDTH; x++ )
+		{
+			is_out = false;
+
+			for ( ch = 0; ch < 3U; ch++ )
+			{
+				diff = (( p_a -> rgb[y][x][ch] > p_b -> rgb[y][x][ch] ) ? ( p_a -> rgb[y][x][ch] - p_b -> rgb[y][x][ch] ) : ( p_b -> rgb[y][x][ch] - p_a -> rgb[y][x][ch] ));
+				*p_max_diff = (( diff > *p_max_diff ) ? ( diff ) : ( *p_max_diff ));
+				is_out = (( diff > tolerance ) || ( true == is_out ));
+			}
+
+			num += (( true == is_out ) ? ( 1U ) : ( 0U ));
+		}
+	}
+
+	return num;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Checksum of GRAM snapshot
+*
+*	CRC-32 (IEEE 802.3) over R, G, B bytes of snapshot, to
+*	keep reference images in test source as single number.
+*
+*	param: 		p_gram - Pointer to snapshot
+*	return:		crc - Checksum of snapshot
+*/
+//////////////////////////////////////////////////////////////
+uint32_t ili9488_test_checksum(const ili9488_test_gram_t * const p_gram)
+{
+	const uint8_t * p_data = &( p_gram -> rgb[0][0][0] );
+	uint32_t crc = 0xFFFFFFFFUL;
+	uint32_t i;
+	uint8_t bit;
+
+	for ( i = 0; i < sizeof( p_gram -> rgb ); i++ )
+	{
+		crc ^= p_data[i];
+
+		for ( bit = 0; bit < 8U; bit++ )
+		{
+			crc = (( crc >> 1 ) ^ (( 0U != ( crc & 1U )) ? ( 0xEDB88320UL ) : ( 0U )));
+		}
+	}
+
+	return ( ~crc );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get transport statistics since last measure
+*
+*	Waits for transfer to finish, so that all of it is
+*	counted.
+*
+*	param: 		p_stats - Pointer to statistics
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_measure(ili9488_emu_stats_t * const p_stats)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+	ili9488_emu_get_stats( p_stats );
+	ili9488_emu_reset_stats();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Drop data of blocking transmit
+*
+*	Lets throughput of driver be measured without emulator.
+*	Emulated GRAM no longer follows driver afterwards.
+*	Non-blocking transmit is not dropped, so it is used with
+*	blocking transport only.
+*
+*	param: 		drop - Drop data
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void ili9488_test_drop(const bool drop)
+{
+	gb_drop = drop;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get monotonic time
+*
+*	param: 		none
+*	return:		Time in nanoseconds
+*/
+//////////////////////////////////////////////////////////////
+uint64_t ili9488_test_time_ns(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return ((((uint64_t) ts.tv_sec ) * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report test result
+*
+*	param: 		p_name - Name of test
+*	param: 		async - Non-blocking transport was used
+*	return:		Exit code, 0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int ili9488_test_result(const char * const p_name, const bool async)
+{
+	printf( "%s (%s): %u checks, %u failed\n", p_name, (( true == async ) ? ( "async" ) : ( "sync" )), gu32_checks, gu32_fails );
+
+	return (( 0U == gu32_fails ) ? ( 0 ) : ( 1 ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Blocking transmit, drops data when selected
+*
+*	param: 		p_data - Pointer to data
+*	param: 		size - Size of data in bytes
+*	return:		status - Status of transfer
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t ili9488_test_transmit(const uint8_t * p_data, const uint32_t size)
+{
+	ili9488_spi_status_t status = eILI9488_SPI_OK;
+
+	if ( false == gb_drop )
+	{
+		status = gpf_transmit( p_data, size );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _ILI9488_TEST_H_
+#define _ILI9488_TEST_H_
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "stdint.h"
+#include "stdbool.h"
+
+#include "ili9488.h"
+#include "ili9488_emu.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Check condition, failed check is reported and counted
+#define ILI9488_TEST_CHECK( cond, ... )		( ili9488_test_check(( cond ), __FILE__, __LINE__, __VA_ARGS__ ))
+
+// Snapshot of emulated GRAM (native portrait orientation)
+typedef struct
+{
+	uint8_t		rgb[ ILI9488_EMU_HEIGHT ][ ILI9488_EMU_WIDTH ][ 3 ];
+} ili9488_test_gram_t;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+void		ili9488_test_init		(const bool async);
+bool		ili9488_test_is_async	(const int argc, char ** const argv);
+void		ili9488_test_check		(const bool cond, const char * const p_file, const int line, const char * const p_format, ...);
+void		ili9488_test_snapshot	(ili9488_test_gram_t * const p_gram);
+void		ili9488_test_get_pixel	(const uint16_t page, const uint16_t col, ili9488_rgb_t * const p_rgb);
+uint32_t	ili9488_test_compare	(const ili9488_test_gram_t * const p_a, const ili9488_test_gram_t * const p_b, const uint8_t tolerance, uint8_t * const p_max_diff);
+uint32_t	ili9488_test_checksum	(const ili9488_test_gram_t * const p_gram);
+void		ili9488_test_measure	(ili9488_emu_stats_t * const p_stats);
+void		ili9488_test_drop		(const bool drop);
+uint64_t	ili9488_test_time_ns	(void);
+int			ili9488_test_result		(const char * const p_name, const bool async);
+
+#endif // _ILI9488_TEST_H_
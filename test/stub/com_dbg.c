@@ -0,0 +1,45 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Host stand-in for debug COM port, prints to stdout.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "com_dbg.h"
+
+#include <stdio.h>
+#include <stdarg.h>
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Print debug message
+*
+*	param: 		ch - Debug channel
+*	param: 		p_format - Formated message
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+void com_dbg_print(const com_dbg_ch_t ch, const char * const p_format, ...)
+{
+	va_list args;
+
+	(void) ch;
+
+	va_start( args, p_format );
+	vprintf( p_format, args );
+	printf( "\n" );
+	va_end( args );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
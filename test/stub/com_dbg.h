@@ -0,0 +1,24 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Host stand-in for debug COM port.
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _COM_DBG_H_
+#define _COM_DBG_H_
+
+// Debug channels
+typedef enum
+{
+	eCOM_DBG_CH_DISPLAY = 0,
+	eCOM_DBG_CH_TOUCH,
+} com_dbg_ch_t;
+
+void com_dbg_print(const com_dbg_ch_t ch, const char * const p_format, ...);
+
+#endif // _COM_DBG_H_
@@ -0,0 +1,17 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Host stand-in for project configuration.
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _PROJECT_CONFIG_H_
+#define _PROJECT_CONFIG_H_
+
+typedef float float32_t;
+
+#endif // _PROJECT_CONFIG_H_
@@ -0,0 +1,22 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Host stand-in for STM32 HAL. With HAL transport disabled
+//	display stack needs nothing of it but what HAL would
+//	include anyway. Failed assert
+//	aborts test, see Makefile.
+//
+//////////////////////////////////////////////////////////////
+
+#ifndef _STM32F7XX_HAL_H_
+#define _STM32F7XX_HAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#endif // _STM32F7XX_HAL_H_
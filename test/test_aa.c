@@ -0,0 +1,202 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Anti-aliased drawing cost, compared to plain drawing
+//	of the same object.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_font.h"
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Test string
+#define TEST_AA_STRING					( "0123456789" )
+
+// Bytes of string besides pixels
+#define TEST_AA_OVERHEAD_BYTES			( 16U )
+
+// Line
+typedef struct
+{
+	uint16_t	page_s;
+	uint16_t	col_s;
+	uint16_t	page_e;
+	uint16_t	col_e;
+	uint16_t	bytes_pct;	// Allowed bytes of AA line, in percent of plain line
+} test_aa_line_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Lines: horizontal, vertical and diagonal ones cost the same
+// as plain lines, sloped ones blend two pixels per step
+static const test_aa_line_t g_lines[] =
+{
+	{ 10U, 100U, 110U, 100U, 100U },
+	{ 10U, 110U, 10U, 210U, 100U },
+	{ 20U, 110U, 120U, 210U, 100U },
+	{ 130U, 110U, 230U, 147U, 150U },
+	{ 130U, 150U, 150U, 250U, 200U },
+};
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost of anti-aliased string
+*
+*	Built-in fonts are downsampled 2x2, so string has a
+*	quarter of pixels of plain string.
+*
+*	param: 		font_opt - Font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_aa_string(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t num = strlen( TEST_AA_STRING );
+	const uint32_t size = ( num * (( ili9488_font_get_width( font_opt ) + 1U ) / 2U ) * ( ili9488_font_get_height( font_opt ) / 2U ));
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK, font_opt ), "string pen" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_aa( TEST_AA_STRING, 10U, 10U ), "string" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( stats.pixels == size, "font %u: %u pixels", font_opt, stats.pixels );
+	ILI9488_TEST_CHECK( stats.mem_writes == 1U, "font %u: %u memory writes", font_opt, stats.mem_writes );
+	ILI9488_TEST_CHECK( stats.bytes <= (( 3U * size ) + TEST_AA_OVERHEAD_BYTES ), "font %u: %u bytes", font_opt, stats.bytes );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost of anti-aliased line
+*
+*	param: 		p_line - Pointer to line
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_aa_line(const test_aa_line_t * const p_line)
+{
+	ili9488_emu_stats_t plain;
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( p_line -> page_s, p_line -> col_s, p_line -> page_e, p_line -> col_e, ILI9488_COLOR_WHITE ), "line" );
+	ili9488_test_measure( &plain );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( p_line -> page_s, p_line -> col_s, p_line -> page_e, p_line -> col_e, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA line" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK(( 100U * stats.bytes ) <= ( p_line -> bytes_pct * plain.bytes ), "line %u,%u-%u,%u: %u bytes, plain %u", p_line -> page_s, p_line -> col_s, p_line -> page_e, p_line -> col_e, stats.bytes, plain.bytes );
+	ILI9488_TEST_CHECK( stats.pixels <= ( 2U * plain.pixels ), "line %u,%u-%u,%u: %u pixels, plain %u", p_line -> page_s, p_line -> col_s, p_line -> page_e, p_line -> col_e, stats.pixels, plain.pixels );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost of anti-aliased circle
+*
+*	Filled circle adds only blended edge, outline blends
+*	two pixels per step.
+*
+*	param: 		radius - Radius of circle
+*	param: 		fill_en - Filled circle
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_aa_circle(const uint8_t radius, const bool fill_en)
+{
+	ili9488_emu_stats_t plain;
+	ili9488_emu_stats_t stats;
+	ili9488_circ_attr_t circ;
+
+	memset( &circ, 0, sizeof( circ ));
+	circ.position.start_page = 200U;
+	circ.position.start_col = 150U;
+	circ.position.radius = radius;
+	circ.fill.enable = fill_en;
+	circ.fill.color = ILI9488_COLOR_WHITE;
+	circ.border.enable = ( false == fill_en );
+	circ.border.width = 1U;
+	circ.border.color = ILI9488_COLOR_WHITE;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+	ili9488_test_measure( &plain );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle_aa( 200U, 150U, radius, fill_en, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA circle" );
+	ili9488_test_measure( &stats );
+
+	if ( true == fill_en )
+	{
+		ILI9488_TEST_CHECK(( 20U * stats.bytes ) <= ( 21U * plain.bytes ), "disk %u: %u bytes, plain %u", radius, stats.bytes, plain.bytes );
+	}
+	else
+	{
+		ILI9488_TEST_CHECK( stats.bytes <= ( 2U * plain.bytes ), "circle %u: %u bytes, plain %u", radius, stats.bytes, plain.bytes );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	uint8_t i;
+
+	ili9488_test_init( async );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+
+	for ( i = eILI9488_FONT_8; i <= eILI9488_FONT_24; i++ )
+	{
+		test_aa_string((ili9488_font_opt_t) i );
+	}
+
+	for ( i = 0; i < ( sizeof( g_lines ) / sizeof( g_lines[0] )); i++ )
+	{
+		test_aa_line( &g_lines[i] );
+	}
+
+	test_aa_circle( 20U, true );
+	test_aa_circle( 50U, true );
+	test_aa_circle( 20U, false );
+	test_aa_circle( 50U, false );
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Arc split and gauge update. Arcs [a, b) and [b, c) are
+//	drawn on their own and must together cover exactly arc
+//	[a, c), with no pixel in both and none left out.
+//
+//	Gauge updated from old to new value must give the same
+//	GRAM as full redraw at new value, while sending only
+//	pixels that change color.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stdio.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Center of test arcs
+#define TEST_ARC_PAGE					( 240U )
+#define TEST_ARC_COL					( 160U )
+
+// Test arc split into [a, b) and [b, c)
+typedef struct
+{
+	const char *	p_name;
+	uint16_t		radius;
+	uint16_t		width;
+	uint16_t		a;
+	uint16_t		b;
+	uint16_t		c;
+} test_arc_split_t;
+
+// Test gauge, steps through its angles
+typedef struct
+{
+	uint16_t		angle_s;
+	uint32_t		num;
+	uint16_t		angle[8];
+} test_arc_gauge_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Test splits
+static const test_arc_split_t g_split[] =
+{
+	{ "ring",		100U,	12U,	30U,	100U,	250U },
+	{ "octants",	100U,	12U,	0U,		45U,	360U },
+	{ "quadrants",	100U,	12U,	90U,	180U,	270U },
+	{ "wrap",		100U,	12U,	300U,	20U,	60U },
+	{ "wrap end",	100U,	12U,	200U,	359U,	10U },
+	{ "thin",		120U,	1U,		10U,	137U,	300U },
+	{ "pie",		80U,	81U,	10U,	135U,	350U },
+};
+
+// Number of test splits
+#define TEST_ARC_SPLIT_NUM				( sizeof( g_split ) / sizeof( test_arc_split_t ))
+
+// Test gauges, value grows, drops, crosses angle 0 and stays
+static const test_arc_gauge_t g_gauge[] =
+{
+	{ 135U, 8U, { 135U, 200U, 300U, 45U, 45U, 250U, 136U, 135U }},
+	{ 0U,	4U, { 0U, 360U, 90U, 89U }},
+};
+
+// Number of test gauges
+#define TEST_ARC_GAUGE_NUM				( sizeof( g_gauge ) / sizeof( test_arc_gauge_t ))
+
+// Gauge geometry and colors
+#define TEST_ARC_GAUGE_RADIUS			( 120U )
+#define TEST_ARC_GAUGE_WIDTH			( 20U )
+#define TEST_ARC_GAUGE_FG				( ILI9488_COLOR_GREEN )
+#define TEST_ARC_GAUGE_BG				( ILI9488_COLOR_BLUE )
+
+// GRAM snapshots
+static ili9488_test_gram_t g_gram[3];
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Is snapshot pixel drawn
+*
+*	param: 		p_gram - Pointer to snapshot
+*	param: 		y - Row of pixel
+*	param: 		x - Column of pixel
+*	return:		true when pixel is not black
+*/
+//////////////////////////////////////////////////////////////
+static bool test_arc_is_set(const ili9488_test_gram_t * const p_gram, const uint16_t y, const uint16_t x)
+{
+	return (( 0U != p_gram -> rgb[y][x][0] ) || ( 0U != p_gram -> rgb[y][x][1] ) || ( 0U != p_gram -> rgb[y][x][2] ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw arc on black display
+*
+*	param: 		p_split - Pointer to split geometry
+*	param: 		angle_s - Start angle
+*	param: 		angle_e - End angle
+*	param: 		p_gram - Snapshot of drawn arc
+*	param: 		p_stats - Stats of drawing arc
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_arc_draw(const test_arc_split_t * const p_split, const uint16_t angle_s, const uint16_t angle_e, ili9488_test_gram_t * const p_gram, ili9488_emu_stats_t * const p_stats)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ili9488_test_measure( p_stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( TEST_ARC_PAGE, TEST_ARC_COL, p_split -> radius, p_split -> width, angle_s, angle_e, ILI9488_COLOR_WHITE ), "%s: arc %u to %u", p_split -> p_name, angle_s, angle_e );
+	ili9488_test_measure( p_stats );
+	ili9488_test_snapshot( p_gram );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check split arcs
+*
+*	Every pixel of [a, c) must be in exactly one of [a, b)
+*	and [b, c), and every arc must send only its pixels.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_arc_split(void)
+{
+	const test_arc_split_t * p_split;
+	ili9488_emu_stats_t stats[3];
+	uint32_t num[3];
+	uint32_t overlap;
+	uint32_t gap;
+	uint32_t i;
+	uint32_t j;
+	uint16_t y;
+	uint16_t x;
+	bool is_set[3];
+
+	for ( i = 0; i < TEST_ARC_SPLIT_NUM; i++ )
+	{
+		p_split = &g_split[i];
+
+		test_arc_draw( p_split, p_split -> a, p_split -> b, &g_gram[0], &stats[0] );
+		test_arc_draw( p_split, p_split -> b, p_split -> c, &g_gram[1], &stats[1] );
+		test_arc_draw( p_split, p_split -> a, p_split -> c, &g_gram[2], &stats[2] );
+
+		num[0] = 0;
+		num[1] = 0;
+		num[2] = 0;
+		overlap = 0;
+		gap = 0;
+
+		for ( y = 0; y < ILI9488_EMU_HEIGHT; y++ )
+		{
+			for ( x = 0; x < ILI9488_EMU_WIDTH; x++ )
+			{
+				for ( j = 0; j < 3U; j++ )
+				{
+					is_set[j] = test_arc_is_set( &g_gram[j], y, x );
+					num[j] += (( true == is_set[j] ) ? ( 1U ) : ( 0U ));
+				}
+
+				overlap += ((( true == is_set[0] ) && ( true == is_set[1] )) ? ( 1U ) : ( 0U ));
+				gap += (( is_set[2] != ( is_set[0] || is_set[1] )) ? ( 1U ) : ( 0U ));
+			}
+		}
+
+		ILI9488_TEST_CHECK( 0U != num[0], "%s: arc %u to %u is empty", p_split -> p_name, p_split -> a, p_split -> b );
+		ILI9488_TEST_CHECK( 0U != num[1], "%s: arc %u to %u is empty", p_split -> p_name, p_split -> b, p_split -> c );
+		ILI9488_TEST_CHECK( 0U == overlap, "%s: %u pixels in both arcs", p_split -> p_name, overlap );
+		ILI9488_TEST_CHECK( 0U == gap, "%s: %u pixels differ from whole arc", p_split -> p_name, gap );
+
+		for ( j = 0; j < 3U; j++ )
+		{
+			// 3-bit pixels are sent two per byte, odd run pads one pixel
+			#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+				ILI9488_TEST_CHECK(( stats[j].pixels >= num[j] ) && ( stats[j].pixels <= ( num[j] + stats[j].mem_writes )), "%s: %u pixels sent, %u drawn", p_split -> p_name, stats[j].pixels, num[j] );
+			#else
+				ILI9488_TEST_CHECK( stats[j].pixels == num[j], "%s: %u pixels sent, %u drawn", p_split -> p_name, stats[j].pixels, num[j] );
+			#endif
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw gauge at value
+*
+*	Whole ring is drawn with background color and arc up to
+*	value with foreground color over it.
+*
+*	param: 		p_gauge - Pointer to gauge
+*	param: 		angle - Angle of value
+*	param: 		p_stats - Stats of drawing gauge
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_arc_gauge_draw(const test_arc_gauge_t * const p_gauge, const uint16_t angle, ili9488_emu_stats_t * const p_stats)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ili9488_test_measure( p_stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( TEST_ARC_PAGE, TEST_ARC_COL, TEST_ARC_GAUGE_RADIUS, TEST_ARC_GAUGE_WIDTH, 0U, 360U, TEST_ARC_GAUGE_BG ), "gauge ring" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( TEST_ARC_PAGE, TEST_ARC_COL, TEST_ARC_GAUGE_RADIUS, TEST_ARC_GAUGE_WIDTH, p_gauge -> angle_s, angle, TEST_ARC_GAUGE_FG ), "gauge %u: value %u", p_gauge -> angle_s, angle );
+	ili9488_test_measure( p_stats );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check gauge update against full redraw
+*
+*	Pixels sent by update must be those that differ between
+*	gauge at old and at new value.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_arc_gauge(void)
+{
+	const test_arc_gauge_t * p_gauge;
+	ili9488_emu_stats_t stats;
+	ili9488_emu_stats_t full;
+	uint32_t changed;
+	uint32_t diff;
+	uint32_t i;
+	uint32_t j;
+	uint16_t angle_old;
+	uint16_t angle_new;
+	uint8_t max_diff;
+
+	for ( i = 0; i < TEST_ARC_GAUGE_NUM; i++ )
+	{
+		p_gauge = &g_gauge[i];
+
+		for ( j = 1; j < p_gauge -> num; j++ )
+		{
+			angle_old = p_gauge -> angle[ j - 1U ];
+			angle_new = p_gauge -> angle[j];
+
+			// Incremental update from old value
+			test_arc_gauge_draw( p_gauge, angle_old, &stats );
+			ili9488_test_snapshot( &g_gram[0] );
+
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_update_arc( TEST_ARC_PAGE, TEST_ARC_COL, TEST_ARC_GAUGE_RADIUS, TEST_ARC_GAUGE_WIDTH, p_gauge -> angle_s, angle_old, angle_new, TEST_ARC_GAUGE_FG, TEST_ARC_GAUGE_BG ), "gauge %u: update %u to %u", p_gauge -> angle_s, angle_old, angle_new );
+			ili9488_test_measure( &stats );
+			ili9488_test_snapshot( &g_gram[1] );
+
+			// Full redraw at new value
+			test_arc_gauge_draw( p_gauge, angle_new, &full );
+			ili9488_test_snapshot( &g_gram[2] );
+
+			changed = ili9488_test_compare( &g_gram[0], &g_gram[1], 0U, &max_diff );
+			diff = ili9488_test_compare( &g_gram[1], &g_gram[2], 0U, &max_diff );
+
+			printf( "  gauge %3u: %3u to %3u, %5u pixels changed, full redraw %5u\n", p_gauge -> angle_s, angle_old, angle_new, changed, full.pixels );
+
+			ILI9488_TEST_CHECK( 0U == diff, "gauge %u: %u to %u, %u pixels differ from full redraw", p_gauge -> angle_s, angle_old, angle_new, diff );
+			ILI9488_TEST_CHECK(( angle_old == angle_new ) == ( 0U == changed ), "gauge %u: %u to %u, %u pixels changed", p_gauge -> angle_s, angle_old, angle_new, changed );
+
+			#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+				ILI9488_TEST_CHECK(( stats.pixels >= changed ) && ( stats.pixels <= ( changed + stats.mem_writes )), "gauge %u: %u to %u, %u pixels sent, %u changed", p_gauge -> angle_s, angle_old, angle_new, stats.pixels, changed );
+			#else
+				ILI9488_TEST_CHECK( stats.pixels == changed, "gauge %u: %u to %u, %u pixels sent, %u changed", p_gauge -> angle_s, angle_old, angle_new, stats.pixels, changed );
+			#endif
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	test_arc_split();
+	test_arc_gauge();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Errors of non-blocking transfers. Burst that fails to
+//	start from transfer complete interrupt must be reported
+//	by next wait, once.
+//
+//	Emulator transport is wrapped, so that chosen burst of
+//	non-blocking transmit fails. Test always uses
+//	non-blocking transport.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Size of filled square, whole number of GRAM bursts
+#define TEST_ASYNC_SIZE					( 80U )
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Wrapped transport
+static ili9488_transport_t g_transport;
+static pf_spi_tx_t gpf_transmit_async;
+
+// Bursts until failure, 0 to never fail
+static volatile uint32_t gu32_fail_in;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Non-blocking transmit, failing on request
+*
+*	param: 		p_data - Pointer to data
+*	param: 		size - Size of data in bytes
+*	return:		status - Status of transmit
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_spi_status_t test_async_transmit(const uint8_t * p_data, const uint32_t size)
+{
+	ili9488_spi_status_t status;
+
+	if (( gu32_fail_in > 0U ) && ( 0U == --gu32_fail_in ))
+	{
+		status = eILI9488_SPI_ERROR;
+	}
+	else
+	{
+		status = gpf_transmit_async( p_data, size );
+	}
+
+	return status;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill rectangle
+*
+*	Fill repeats one burst, so all but first burst are
+*	chained from interrupt.
+*
+*	param: 		color - Color of rectangle
+*	return:		status - Status of drawing
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t test_async_fill(const ili9488_color_t color)
+{
+	ili9488_rect_attr_t rect = { 0 };
+
+	rect.position.page_size = TEST_ASYNC_SIZE;
+	rect.position.col_size = TEST_ASYNC_SIZE;
+	rect.fill.enable = true;
+	rect.fill.color = color;
+
+	return ili9488_draw_rectangle( &rect );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check failed burst reported by wait
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_async_wait_error(void)
+{
+	ili9488_emu_stats_t stats;
+
+	gu32_fail_in = 2U;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == test_async_fill( ILI9488_COLOR_RED ), "fill" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_wait(), "failed burst not reported" );
+	ILI9488_TEST_CHECK( 0U == gu32_fail_in, "burst did not fail" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "failed burst reported twice" );
+
+	ili9488_emu_get_stats( &stats );
+	ili9488_emu_reset_stats();
+	ILI9488_TEST_CHECK( stats.pixels < ( TEST_ASYNC_SIZE * TEST_ASYNC_SIZE ), "%u pixels after failed burst", stats.pixels );
+
+	// Next drawing is not affected
+	ILI9488_TEST_CHECK( eILI9488_OK == test_async_fill( ILI9488_COLOR_GREEN ), "fill" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	ili9488_emu_get_stats( &stats );
+	ili9488_emu_reset_stats();
+	ILI9488_TEST_CHECK( stats.pixels == ( TEST_ASYNC_SIZE * TEST_ASYNC_SIZE ), "%u pixels", stats.pixels );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check failed burst reported by next drawing
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_async_next_error(void)
+{
+	gu32_fail_in = 2U;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == test_async_fill( ILI9488_COLOR_RED ), "fill" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == test_async_fill( ILI9488_COLOR_BLUE ), "failed burst not reported" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "failed burst reported twice" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, ignored
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	(void) argc;
+
+	g_transport = *ili9488_emu_get_transport( true );
+	gpf_transmit_async = g_transport.pf_transmit_async;
+	g_transport.pf_transmit_async = &test_async_transmit;
+
+	ili9488_emu_reset();
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_transport( &g_transport ), "set transport" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_init(), "init" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+	ili9488_emu_reset_stats();
+
+	test_async_wait_error();
+	test_async_next_error();
+
+	return ili9488_test_result( argv[0], true );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Glyph cache, built with small cache. Second draw of the
+//	same string must hit in cache, cache full of glyphs must
+//	evict least recently used one and keep the rest valid
+//	after pool is compacted. Glyph bigger than cache and, in
+//	3-bit pixel format, glyph with odd number of pixels are
+//	not cached. Every string must draw the same pixels as
+//	font lut, i.e. as without cache.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_font.h"
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// String position
+#define TEST_CACHE_PAGE					( 10U )
+#define TEST_CACHE_COL					( 10U )
+
+// Glyphs of test strings
+#define TEST_CACHE_CHARS				"ABCDEFGHIJ"
+
+// Test string of font lut7, characters 33 to 35
+#define TEST_CACHE_LUT7_STRING			"!\"#!"
+
+// Pen
+#define TEST_CACHE_FG					ILI9488_COLOR_WHITE
+#define TEST_CACHE_BG					ILI9488_COLOR_BLUE
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get size of cached glyph
+*
+*	param: 		font_opt - Font
+*	return:		Size of glyph in GRAM data bytes
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t test_cache_glyph_size(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t pixels = ( ili9488_font_get_width( font_opt ) * ili9488_font_get_height( font_opt ));
+
+	#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+		return ( pixels / 2U );
+	#else
+		return ( pixels * 3U );
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Get number of glyphs that fit into cache
+*
+*	param: 		font_opt - Font
+*	return:		Number of glyphs
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t test_cache_capacity(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t num = ( ILI9488_GLYPH_CACHE_SIZE / test_cache_glyph_size( font_opt ));
+
+	return (( num < ILI9488_GLYPH_CACHE_ENTRIES ) ? ( num ) : ( ILI9488_GLYPH_CACHE_ENTRIES ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw string and check it against font lut
+*
+*	Every pixel of string strip is compared with lut bit,
+*	as drawn by driver without cache.
+*
+*	param: 		p_str - String
+*	param: 		font_opt - Font
+*	param: 		p_stats - Cache statistics of string
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_cache_draw(const char * const p_str, const ili9488_font_opt_t font_opt, ili9488_glyph_cache_stats_t * const p_stats)
+{
+	const ili9488_font_t * const p_font = ili9488_font_get( font_opt );
+	const uint32_t line_size_byte = (( p_font -> width / 8U ) + 1U );
+	const uint16_t page_s = ( TEST_CACHE_PAGE + ( 2U * p_font -> width ) - ( 8U * line_size_byte ));
+	const uint8_t * p_glyph;
+	ili9488_color_t color;
+	ili9488_rgb_t rgb;
+	uint32_t num = 0;
+	uint32_t c;
+	uint32_t i;
+	uint32_t j;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( TEST_CACHE_FG, TEST_CACHE_BG, font_opt ), "string pen" );
+
+	ili9488_reset_glyph_cache_stats();
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( p_str, TEST_CACHE_PAGE, TEST_CACHE_COL ), "font %u: string %s", font_opt, p_str );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+	ili9488_get_glyph_cache_stats( p_stats );
+
+	for ( c = 0; c < strlen( p_str ); c++ )
+	{
+		p_glyph = &p_font -> p_font[ p_font -> height * line_size_byte * ((uint8_t) p_str[c] - 32U ) ];
+
+		for ( j = 0; j < p_font -> width; j++ )
+		{
+			for ( i = 0; i < p_font -> height; i++ )
+			{
+				color = (( 0U != ( p_glyph[ ( i * line_size_byte ) + ( j / 8U ) ] & ( 0x80U >> ( j % 8U )))) ? ( TEST_CACHE_FG ) : ( TEST_CACHE_BG ));
+
+				ili9488_test_get_pixel(( page_s + ( c * p_font -> width ) + j ), ( TEST_CACHE_COL + i ), &rgb );
+
+				num += 	(	( ILI9488_COLOR_R( color ) != rgb.R )
+						||	( ILI9488_COLOR_G( color ) != rgb.G )
+						||	( ILI9488_COLOR_B( color ) != rgb.B )) ? ( 1U ) : ( 0U );
+			}
+		}
+	}
+
+	ILI9488_TEST_CHECK( 0U == num, "font %u: string %s, %u pixels differ from font lut", font_opt, p_str, num );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cache hits and misses
+*
+*	First draw of string misses on every glyph, second one
+*	hits, as long as glyphs fit into cache.
+*
+*	param: 		font_opt - Font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_cache_hits(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t cap = test_cache_capacity( font_opt );
+	const uint32_t num = (( cap > 0U ) ? ( cap ) : ( 2U ));
+	ili9488_glyph_cache_stats_t stats;
+	char str[ sizeof( TEST_CACHE_CHARS ) ] = { 0 };
+
+	memcpy( str, TEST_CACHE_CHARS, num );
+
+	ili9488_clear_glyph_cache();
+	ili9488_get_glyph_cache_stats( &stats );
+	ILI9488_TEST_CHECK(( 0U == stats.glyphs ) && ( 0U == stats.used ), "font %u: %u glyphs, %u B after clear", font_opt, stats.glyphs, stats.used );
+
+	// Glyphs encoded into cache
+	test_cache_draw( str, font_opt, &stats );
+
+	ILI9488_TEST_CHECK(( 0U == stats.hits ) && ( num == stats.misses ) && ( 0U == stats.evictions ), "font %u: first draw %u hits, %u misses, %u evictions", font_opt, stats.hits, stats.misses, stats.evictions );
+	ILI9488_TEST_CHECK(( cap == stats.glyphs ) && (( cap * test_cache_glyph_size( font_opt )) == stats.used ), "font %u: %u glyphs, %u B in cache", font_opt, stats.glyphs, stats.used );
+
+	// Glyphs from cache, unless glyph is bigger than cache
+	test_cache_draw( str, font_opt, &stats );
+
+	if ( cap > 0U )
+	{
+		ILI9488_TEST_CHECK(( num == stats.hits ) && ( 0U == stats.misses ) && ( 0U == stats.evictions ), "font %u: second draw %u hits, %u misses, %u evictions", font_opt, stats.hits, stats.misses, stats.evictions );
+	}
+	else
+	{
+		ILI9488_TEST_CHECK(( 0U == stats.hits ) && ( num == stats.misses ) && ( 0U == stats.glyphs ), "font %u: glyph bigger than cache, %u hits, %u misses, %u glyphs", font_opt, stats.hits, stats.misses, stats.glyphs );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check LRU eviction
+*
+*	Cache is filled, then first glyph is used again, so
+*	second one is the least recently used. It must be
+*	evicted from the middle of pool, and glyphs behind it
+*	must still draw right after compaction.
+*
+*	param: 		font_opt - Font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_cache_evict(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t cap = test_cache_capacity( font_opt );
+	ili9488_glyph_cache_stats_t stats;
+	char str[ sizeof( TEST_CACHE_CHARS ) ] = { 0 };
+	char ch[2] = { 0 };
+
+	// Fill cache
+	ili9488_clear_glyph_cache();
+	memcpy( str, TEST_CACHE_CHARS, cap );
+	test_cache_draw( str, font_opt, &stats );
+
+	// Use first glyph again
+	ch[0] = TEST_CACHE_CHARS[0];
+	test_cache_draw( ch, font_opt, &stats );
+	ILI9488_TEST_CHECK(( 1U == stats.hits ) && ( 0U == stats.misses ), "font %u: first glyph %u hits, %u misses", font_opt, stats.hits, stats.misses );
+
+	// New glyph evicts second one
+	ch[0] = TEST_CACHE_CHARS[ cap ];
+	test_cache_draw( ch, font_opt, &stats );
+	ILI9488_TEST_CHECK(( 0U == stats.hits ) && ( 1U == stats.misses ) && ( 1U == stats.evictions ), "font %u: new glyph %u hits, %u misses, %u evictions", font_opt, stats.hits, stats.misses, stats.evictions );
+	ILI9488_TEST_CHECK(( cap == stats.glyphs ) && (( cap * test_cache_glyph_size( font_opt )) == stats.used ), "font %u: %u glyphs, %u B in cache after eviction", font_opt, stats.glyphs, stats.used );
+
+	// All but second glyph are cached, and moved glyphs are intact
+	str[1] = TEST_CACHE_CHARS[ cap ];
+	test_cache_draw( str, font_opt, &stats );
+	ILI9488_TEST_CHECK(( cap == stats.hits ) && ( 0U == stats.misses ) && ( 0U == stats.evictions ), "font %u: compacted %u hits, %u misses, %u evictions", font_opt, stats.hits, stats.misses, stats.evictions );
+
+	ch[0] = TEST_CACHE_CHARS[1];
+	test_cache_draw( ch, font_opt, &stats );
+	ILI9488_TEST_CHECK(( 0U == stats.hits ) && ( 1U == stats.misses ) && ( 1U == stats.evictions ), "font %u: evicted glyph %u hits, %u misses, %u evictions", font_opt, stats.hits, stats.misses, stats.evictions );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check glyph with odd number of pixels
+*
+*	In 3-bit pixel format such glyph ends inside of byte,
+*	thus it can not be cached and cache is not searched.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_cache_odd(void)
+{
+	ili9488_glyph_cache_stats_t stats;
+
+	ILI9488_TEST_CHECK( 1U == (( ili9488_font_get_width( eILI9488_FONT_USER_0 ) * ili9488_font_get_height( eILI9488_FONT_USER_0 )) % 2U ), "lut7 glyph not odd" );
+
+	ili9488_clear_glyph_cache();
+	test_cache_draw( TEST_CACHE_LUT7_STRING, eILI9488_FONT_USER_0, &stats );
+
+	#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+		ILI9488_TEST_CHECK(( 0U == stats.hits ) && ( 0U == stats.misses ) && ( 0U == stats.glyphs ), "3-bit odd glyph: %u hits, %u misses, %u glyphs", stats.hits, stats.misses, stats.glyphs );
+	#else
+		ILI9488_TEST_CHECK(( 1U == stats.hits ) && ( 3U == stats.misses ) && ( 3U == stats.glyphs ), "odd glyph: %u hits, %u misses, %u glyphs", stats.hits, stats.misses, stats.glyphs );
+	#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	uint8_t f;
+
+	ili9488_test_init( async );
+
+	for ( f = eILI9488_FONT_8; f <= eILI9488_FONT_24; f++ )
+	{
+		test_cache_hits((ili9488_font_opt_t) f );
+
+		if ( test_cache_capacity((ili9488_font_opt_t) f ) >= 2U )
+		{
+			test_cache_evict((ili9488_font_opt_t) f );
+		}
+		else
+		{
+			// No actions...
+		}
+	}
+
+	test_cache_odd();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Functions of disabled features. They must link and
+//	report error without drawing anything. Without frame
+//	renderer frame calls are accepted and drawing goes
+//	directly to display.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stddef.h>
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check anti-aliased drawing
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_disabled_aa(void)
+{
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_draw_line_aa( 10U, 10U, 100U, 50U, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA line" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_draw_circle_aa( 100U, 100U, 20U, true, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA circle" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_set_string_aa( "AA", 10U, 10U ), "AA string" );
+
+	ili9488_test_measure( &stats );
+	ILI9488_TEST_CHECK( 0U == stats.transfers, "AA: %u transfers", stats.transfers );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check display list
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_disabled_list(void)
+{
+	ili9488_emu_stats_t stats;
+	ili9488_rect_attr_t rect = { 0 };
+	ili9488_circ_attr_t circ = { 0 };
+	ili9488_item_t item = ILI9488_ITEM_INVALID;
+
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_add_rect( &rect, 0U, &item ), "list add rectangle" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_add_circle( &circ, 0U, &item ), "list add circle" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_add_text( "list", 0U, 0U, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK, eILI9488_FONT_8, 0U, &item ), "list add text" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_add_bitmap( NULL, 0U, 0U, 0U, &item ), "list add bitmap" );
+	ILI9488_TEST_CHECK( ILI9488_ITEM_INVALID == item, "list item %u", item );
+
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_move( item, 1U, 1U ), "list move" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_set_color( item, ILI9488_COLOR_RED, ILI9488_COLOR_RED ), "list set color" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_set_text( item, "text" ), "list set text" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_set_visible( item, false ), "list set visible" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_remove( item ), "list remove" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_clear(), "list clear" );
+	ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_list_refresh(), "list refresh" );
+
+	ili9488_test_measure( &stats );
+	ILI9488_TEST_CHECK( 0U == stats.transfers, "list: %u transfers", stats.transfers );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check drawing inside frame
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_disabled_frame(void)
+{
+	ili9488_emu_stats_t stats;
+	ili9488_rgb_t rgb;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_RED ), "background" );
+
+	// Drawn before frame end
+	ili9488_test_measure( &stats );
+	ILI9488_TEST_CHECK( stats.pixels >= ( ILI9488_EMU_WIDTH * ILI9488_EMU_HEIGHT ), "frame: %u pixels", stats.pixels );
+
+	(void) ili9488_emu_get_pixel( 0U, 0U, &rgb );
+	ILI9488_TEST_CHECK(( ILI9488_COLOR_R( ILI9488_COLOR_RED ) == rgb.R ) && ( 0U == rgb.G ) && ( 0U == rgb.B ), "frame: pixel %u %u %u", rgb.R, rgb.G, rgb.B );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	#if ( 0 == ILI9488_AA_EN )
+		test_disabled_aa();
+	#endif
+
+	#if ( 0 == ILI9488_LIST_EN )
+		test_disabled_list();
+	#endif
+
+	#if ( 0 == ILI9488_RENDER_EN )
+		test_disabled_frame();
+	#endif
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
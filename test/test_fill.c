@@ -0,0 +1,228 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	GRAM fill cost. Fills must be streamed from line buffer,
+//	in bursts of ILI9488_GRAM_BUF_SIZE_PX pixels, and not
+//	pixel by pixel. Address window boundary that did not
+//	change since last fill must not be sent again.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Transfers of single fill besides pixel bursts
+// (address window and memory write command)
+#define TEST_FILL_OVERHEAD				( 8U )
+
+// Number of bursts of fill
+#define TEST_FILL_BURSTS( px )			((( px ) + ILI9488_GRAM_BUF_SIZE_PX - 1U ) / ILI9488_GRAM_BUF_SIZE_PX )
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost and result of background fill
+*
+*	Background is filled twice, whole display and first
+*	three pages once again.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_fill_background(void)
+{
+	const uint32_t size = ((uint32_t) ili9488_get_width() * ili9488_get_height());
+	const uint32_t size_strip = ( 3U * (uint32_t) ili9488_get_height());
+	ili9488_emu_stats_t stats;
+	ili9488_rgb_t rgb;
+	uint16_t x;
+	uint16_t y;
+	uint32_t num = 0;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_TURQUOISE ), "background" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( stats.pixels == ( size + size_strip ), "background: %u pixels", stats.pixels );
+	ILI9488_TEST_CHECK( stats.mem_writes == 2U, "background: %u memory writes", stats.mem_writes );
+	ILI9488_TEST_CHECK( stats.transfers <= ( TEST_FILL_BURSTS( size ) + TEST_FILL_BURSTS( size_strip ) + ( 2U * TEST_FILL_OVERHEAD )), "background: %u transfers", stats.transfers );
+
+	for ( y = 0; y < ILI9488_EMU_HEIGHT; y++ )
+	{
+		for ( x = 0; x < ILI9488_EMU_WIDTH; x++ )
+		{
+			(void) ili9488_emu_get_pixel( x, y, &rgb );
+			num += ((( 0x00U == rgb.R ) && ( 0xFCU == rgb.G ) && ( 0xFCU == rgb.B )) ? ( 0U ) : ( 1U ));
+		}
+	}
+
+	ILI9488_TEST_CHECK( 0U == num, "background: %u pixels of wrong color", num );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost of rectangle fill
+*
+*	param: 		page_size - Width of rectangle
+*	param: 		col_size - Height of rectangle
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_fill_rectangle(const uint16_t page_size, const uint16_t col_size)
+{
+	const uint32_t size = ((uint32_t) page_size * col_size );
+	ili9488_emu_stats_t stats;
+	ili9488_rect_attr_t rect;
+
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = 0U;
+	rect.position.start_col = 0U;
+	rect.position.page_size = page_size;
+	rect.position.col_size = col_size;
+	rect.fill.enable = true;
+	rect.fill.color = ILI9488_COLOR_RED;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( stats.pixels == size, "rectangle %ux%u: %u pixels", page_size, col_size, stats.pixels );
+	ILI9488_TEST_CHECK( stats.mem_writes == 1U, "rectangle %ux%u: %u memory writes", page_size, col_size, stats.mem_writes );
+	ILI9488_TEST_CHECK( stats.transfers <= ( TEST_FILL_BURSTS( size ) + TEST_FILL_OVERHEAD ), "rectangle %ux%u: %u transfers", page_size, col_size, stats.transfers );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill rectangle and check sent boundaries
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		color - Fill color
+*	param: 		col_cmds - Expected column address commands
+*	param: 		page_cmds - Expected page address commands
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_fill_window_rect(const uint16_t page, const uint16_t col, const ili9488_color_t color, const uint32_t col_cmds, const uint32_t page_cmds)
+{
+	ili9488_window_stats_t win;
+	ili9488_emu_stats_t stats;
+	ili9488_rect_attr_t rect;
+	ili9488_rgb_t rgb[2];
+
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = page;
+	rect.position.start_col = col;
+	rect.position.page_size = 40U;
+	rect.position.col_size = 30U;
+	rect.fill.enable = true;
+	rect.fill.color = color;
+
+	ili9488_test_measure( &stats );
+	ili9488_reset_window_stats();
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+	ili9488_test_measure( &stats );
+	ili9488_get_window_stats( &win );
+
+	ILI9488_TEST_CHECK(( col_cmds == stats.col_cmds ) && ( page_cmds == stats.page_cmds ), "rectangle at %u,%u: %u column and %u page commands", page, col, stats.col_cmds, stats.page_cmds );
+	ILI9488_TEST_CHECK(( stats.addr_cmds == win.misses ) && (( 2U - stats.addr_cmds ) == win.hits ), "rectangle at %u,%u: %u hits, %u misses", page, col, win.hits, win.misses );
+	ILI9488_TEST_CHECK( 1U == stats.mem_writes, "rectangle at %u,%u: %u memory writes", page, col, stats.mem_writes );
+
+	// First and last pixel in place
+	ili9488_test_get_pixel( page, col, &rgb[0] );
+	ili9488_test_get_pixel(( page + 39U ), ( col + 29U ), &rgb[1] );
+
+	ILI9488_TEST_CHECK(	( ILI9488_COLOR_R( color ) == rgb[0].R ) && ( ILI9488_COLOR_G( color ) == rgb[0].G ) && ( ILI9488_COLOR_B( color ) == rgb[0].B )
+					&&	( ILI9488_COLOR_R( color ) == rgb[1].R ) && ( ILI9488_COLOR_G( color ) == rgb[1].G ) && ( ILI9488_COLOR_B( color ) == rgb[1].B ), "rectangle at %u,%u: not filled", page, col );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check address window reuse
+*
+*	Rectangles share column range or are drawn at the same
+*	place, and every span of rectangular polygon shares
+*	column range with previous one.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_fill_window(void)
+{
+	const ili9488_point_t points[4] = {{ 300U, 50U }, { 340U, 50U }, { 340U, 90U }, { 300U, 90U }};
+	ili9488_window_stats_t win;
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+
+	// New window, shared columns, same window, shared pages
+	test_fill_window_rect( 10U, 20U, ILI9488_COLOR_RED, 1U, 1U );
+	test_fill_window_rect( 100U, 20U, ILI9488_COLOR_GREEN, 0U, 1U );
+	test_fill_window_rect( 100U, 20U, ILI9488_COLOR_BLUE, 0U, 0U );
+	test_fill_window_rect( 100U, 200U, ILI9488_COLOR_YELLOW, 1U, 0U );
+
+	// Span per page, all in columns 50 - 89
+	ili9488_test_measure( &stats );
+	ili9488_reset_window_stats();
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_polygon( points, 4U, eILI9488_FILL_EVEN_ODD, ILI9488_COLOR_WHITE ), "polygon" );
+	ili9488_test_measure( &stats );
+	ili9488_get_window_stats( &win );
+
+	ILI9488_TEST_CHECK(( 1U == stats.col_cmds ) && ( 40U == stats.page_cmds ) && ( 40U == stats.mem_writes ), "polygon: %u column and %u page commands, %u memory writes", stats.col_cmds, stats.page_cmds, stats.mem_writes );
+	ILI9488_TEST_CHECK(( 39U == win.hits ) && ( 41U == win.misses ), "polygon: %u hits, %u misses", win.hits, win.misses );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	test_fill_background();
+	test_fill_rectangle( 1U, 1U );
+	test_fill_rectangle( 100U, 50U );
+	test_fill_rectangle( 320U, 1U );
+	test_fill_rectangle( 1U, 320U );
+	test_fill_window();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,306 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Compiled fonts. Built-in 24 px font is compiled with
+//	tools/ili9488_fontconv.c twice, see Makefile:
+//
+//		- 1 bpp raw, must draw same pixels as built-in font
+//		- 2 bpp RLE, downsampled by 2, every pixel must be
+//		  blended by coverage of its 2x2 built-in pixels
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_font.h"
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Compiled fonts of test
+#define TEST_FONT_1_BPP					( eILI9488_FONT_USER_0 )
+#define TEST_FONT_2_BPP					( eILI9488_FONT_USER_1 )
+
+// Characters of built-in font
+#define TEST_FONT_FIRST					( 32U )
+#define TEST_FONT_LAST					( 126U )
+
+// Characters per row of test
+#define TEST_FONT_ROW_1_BPP				( 24U )
+#define TEST_FONT_ROW_2_BPP				( 40U )
+
+// Built-in font draws its character cell shifted by
+// ( 2 * width - 8 * line bytes ) pages, compiled font does not
+#define TEST_FONT_SHIFT					( 10U )
+
+// Colors of 2 bpp test, not equal in any channel
+#define TEST_FONT_FG					ILI9488_COLOR_RGB888( 0xF0U, 0x80U, 0x10U )
+#define TEST_FONT_BG					ILI9488_COLOR_RGB888( 0x10U, 0x24U, 0xC0U )
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Built-in and compiled font result
+static ili9488_test_gram_t g_builtin;
+static ili9488_test_gram_t g_compiled;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw all characters of built-in font in rows
+*
+*	param: 		font_opt - Font
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		row_num - Characters per row
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_font_draw_all(const ili9488_font_opt_t font_opt, const uint16_t page, const uint16_t col, const uint32_t row_num)
+{
+	char str[ TEST_FONT_LAST - TEST_FONT_FIRST + 2U ];
+	uint32_t c;
+	uint32_t i;
+	uint32_t num;
+
+	for ( c = TEST_FONT_FIRST; c <= TEST_FONT_LAST; c += row_num )
+	{
+		num = ((( c + row_num ) <= ( TEST_FONT_LAST + 1U )) ? ( row_num ) : ( TEST_FONT_LAST + 1U - c ));
+
+		memset( str, 0, sizeof( str ));
+
+		for ( i = 0; i < num; i++ )
+		{
+			str[i] = (char)( c + i );
+		}
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( str, page, col + ((( c - TEST_FONT_FIRST ) / row_num ) * ili9488_font_get_height( font_opt ))), "string %u", c );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compiled 1 bpp font against built-in font
+*
+*	Both fonts are drawn with same colors, so strips are
+*	same as well, including background of character cells.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_font_1_bpp(void)
+{
+	const ili9488_font_t * p_font = ili9488_font_get( TEST_FONT_1_BPP );
+	ili9488_emu_stats_t stats[2];
+	uint32_t num;
+	uint8_t max;
+
+	ILI9488_TEST_CHECK(( 1U == p_font -> bpp ) && ( false == p_font -> is_rle ), "1 bpp: font is %u bpp%s", p_font -> bpp, (( true == p_font -> is_rle ) ? ( " RLE" ) : ( "" )));
+	ILI9488_TEST_CHECK(( p_font -> width == ili9488_font_get_width( eILI9488_FONT_24 )) && ( p_font -> height == ili9488_font_get_height( eILI9488_FONT_24 )), "1 bpp: cell %ux%u", p_font -> width, p_font -> height );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLUE, eILI9488_FONT_24 ), "string pen" );
+	ili9488_test_measure( &stats[0] );
+
+	test_font_draw_all( eILI9488_FONT_24, 20U, 30U, TEST_FONT_ROW_1_BPP );
+	ili9488_test_measure( &stats[0] );
+	ili9488_test_snapshot( &g_builtin );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLUE, TEST_FONT_1_BPP ), "string pen" );
+	ili9488_test_measure( &stats[1] );
+
+	test_font_draw_all( TEST_FONT_1_BPP, 20U + TEST_FONT_SHIFT, 30U, TEST_FONT_ROW_1_BPP );
+	ili9488_test_measure( &stats[1] );
+	ili9488_test_snapshot( &g_compiled );
+
+	num = ili9488_test_compare( &g_builtin, &g_compiled, 0U, &max );
+
+	ILI9488_TEST_CHECK( 0U == num, "1 bpp: %u pixels differ from built-in font, by up to %u", num, max );
+	ILI9488_TEST_CHECK( stats[1].pixels == stats[0].pixels, "1 bpp: %u pixels, built-in font %u", stats[1].pixels, stats[0].pixels );
+	ILI9488_TEST_CHECK( stats[1].mem_writes == stats[0].mem_writes, "1 bpp: %u memory writes, built-in font %u", stats[1].mem_writes, stats[0].mem_writes );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Level of 2 bpp font pixel
+*
+*	Same as font compiler: coverage of 2x2 built-in pixels,
+*	quantized to 2 bits.
+*
+*	param: 		ch - Character
+*	param: 		j - Page in character cell
+*	param: 		i - Column in character cell
+*	return:		level - Pixel level, 0 - 3
+*/
+//////////////////////////////////////////////////////////////
+static uint8_t test_font_level(const char ch, const uint32_t j, const uint32_t i)
+{
+	const ili9488_font_t * p_font = ili9488_font_get( eILI9488_FONT_24 );
+	const uint32_t line_size_byte = (( p_font -> width / 8U ) + 1U );
+	const uint8_t * p_glyph = &p_font -> p_font[ ((uint8_t) ch - TEST_FONT_FIRST ) * line_size_byte * p_font -> height ];
+	uint32_t sum = 0;
+	uint32_t x;
+	uint32_t y;
+	uint32_t cov;
+
+	for ( x = ( 2U * j ); x < (( 2U * j ) + 2U ); x++ )
+	{
+		for ( y = ( 2U * i ); y < (( 2U * i ) + 2U ); y++ )
+		{
+			if (( x < p_font -> width ) && ( y < p_font -> height ) && ( 0U != ( p_glyph[ ( y * line_size_byte ) + ( x / 8U ) ] & ( 0x80U >> ( x % 8U )))))
+			{
+				sum += 255U;
+			}
+		}
+	}
+
+	cov = ( sum / 4U );
+
+	return (uint8_t)((( cov * 3U ) + 127U ) / 255U );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Blend channel as 18-bit GRAM keeps it
+*
+*	param: 		fg - Foreground channel
+*	param: 		bg - Background channel
+*	param: 		level - Pixel level, 0 - 3
+*	return:		Channel in GRAM
+*/
+//////////////////////////////////////////////////////////////
+static uint8_t test_font_blend(const uint8_t fg, const uint8_t bg, const uint8_t level)
+{
+	return (uint8_t)(( bg + ((((int32_t) fg - bg ) * level ) / 3 )) & 0xFCU );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compiled 2 bpp RLE font
+*
+*	Every pixel of strips and one pixel around them is
+*	checked against blended coverage of built-in font.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_font_2_bpp(void)
+{
+	const ili9488_font_t * p_font = ili9488_font_get( TEST_FONT_2_BPP );
+	const uint16_t page = 20U;
+	const uint16_t col = 30U;
+	uint32_t level_num[4] = { 0U, 0U, 0U, 0U };
+	uint32_t rows;
+	uint32_t num = 0;
+	uint32_t c;
+	uint32_t row;
+	uint32_t row_end;
+	uint8_t level;
+	ili9488_rgb_t exp;
+	ili9488_rgb_t rgb;
+	int32_t j;
+	int32_t i;
+
+	ILI9488_TEST_CHECK(( 2U == p_font -> bpp ) && ( true == p_font -> is_rle ), "2 bpp: font is %u bpp%s", p_font -> bpp, (( true == p_font -> is_rle ) ? ( " RLE" ) : ( "" )));
+	ILI9488_TEST_CHECK(( 9U == p_font -> width ) && ( 12U == p_font -> height ), "2 bpp: cell %ux%u", p_font -> width, p_font -> height );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( TEST_FONT_FG, TEST_FONT_BG, TEST_FONT_2_BPP ), "string pen" );
+
+	test_font_draw_all( TEST_FONT_2_BPP, page, col, TEST_FONT_ROW_2_BPP );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	rows = ((( TEST_FONT_LAST - TEST_FONT_FIRST ) / TEST_FONT_ROW_2_BPP ) + 1U );
+
+	for ( j = -1; j <= (int32_t)( TEST_FONT_ROW_2_BPP * p_font -> width ); j++ )
+	{
+		for ( i = -1; i <= (int32_t)( rows * p_font -> height ); i++ )
+		{
+			row = ((uint32_t) i / p_font -> height );
+			row_end = ( TEST_FONT_FIRST + (( row + 1U ) * TEST_FONT_ROW_2_BPP ));
+			row_end = (( row_end > ( TEST_FONT_LAST + 1U )) ? ( TEST_FONT_LAST + 1U ) : ( row_end ));
+			c = ( TEST_FONT_FIRST + ( row * TEST_FONT_ROW_2_BPP ) + ((uint32_t) j / p_font -> width ));
+
+			// Outside of strips display stays black
+			if (( j < 0 ) || ( i < 0 ) || ( row >= rows ) || ( c >= row_end ))
+			{
+				exp.R = 0U;
+				exp.G = 0U;
+				exp.B = 0U;
+			}
+			else
+			{
+				level = test_font_level((char) c, ((uint32_t) j % p_font -> width ), ((uint32_t) i % p_font -> height ));
+				level_num[ level ]++;
+
+				exp.R = test_font_blend( ILI9488_COLOR_R( TEST_FONT_FG ), ILI9488_COLOR_R( TEST_FONT_BG ), level );
+				exp.G = test_font_blend( ILI9488_COLOR_G( TEST_FONT_FG ), ILI9488_COLOR_G( TEST_FONT_BG ), level );
+				exp.B = test_font_blend( ILI9488_COLOR_B( TEST_FONT_FG ), ILI9488_COLOR_B( TEST_FONT_BG ), level );
+			}
+
+			ili9488_test_get_pixel((uint16_t)( page + j ), (uint16_t)( col + i ), &rgb );
+
+			if (( rgb.R != exp.R ) || ( rgb.G != exp.G ) || ( rgb.B != exp.B ))
+			{
+				num++;
+			}
+		}
+	}
+
+	ILI9488_TEST_CHECK( 0U == num, "2 bpp: %u pixels wrong", num );
+
+	// Every level is used, so every blend is checked
+	ILI9488_TEST_CHECK(( level_num[1] > 0U ) && ( level_num[2] > 0U ), "2 bpp: %u, %u pixels of middle levels", level_num[1], level_num[2] );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	test_font_1_bpp();
+	test_font_2_bpp();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
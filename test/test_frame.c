@@ -0,0 +1,300 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Frame renderer against direct drawing. Same scene is
+//	drawn directly and through frames, in every orientation,
+//	with blocking and non-blocking transport, and both GRAM
+//	results must be the same.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Size of test bitmap
+#define TEST_BITMAP_WIDTH				( 40U )
+#define TEST_BITMAP_HEIGHT				( 30U )
+
+// Allowed difference of anti-aliased pixels, one blend step
+#define TEST_AA_TOLERANCE				(( 255U / ILI9488_AA_LEVELS ) + 1U )
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Direct and frame result
+static ili9488_test_gram_t g_direct;
+static ili9488_test_gram_t g_frame;
+
+// Test bitmap
+static uint8_t gu8_bitmap_data[ TEST_BITMAP_WIDTH * TEST_BITMAP_HEIGHT * 3U ];
+static const ili9488_bitmap_t g_bitmap = { .p_data = gu8_bitmap_data, .width = TEST_BITMAP_WIDTH, .height = TEST_BITMAP_HEIGHT, .format = eILI9488_BITMAP_RGB888 };
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw test scene
+*
+*	Scene covers whole display, as frame must record
+*	complete scene.
+*
+*	param: 		k - Step of animation
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_scene(const uint16_t k)
+{
+	const ili9488_point_t tri[3] = {{ 20, 250 }, { 120, 230 }, { 60 + k, 310 }};
+	const ili9488_point_t star[5] = {{ 200, 230 }, { 230, 310 }, { 160, 260 }, { 240, 260 }, { 170, 310 }};
+	ili9488_point_t chart[8];
+	ili9488_rect_attr_t rect;
+	ili9488_circ_attr_t circ;
+	uint16_t i;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLUE ), "background" );
+
+	// Rounded rectangle with border
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = ( 10U + k );
+	rect.position.start_col = 20U;
+	rect.position.page_size = 100U;
+	rect.position.col_size = 50U;
+	rect.fill.enable = true;
+	rect.fill.color = ILI9488_COLOR_RED;
+	rect.border.enable = true;
+	rect.border.width = 3U;
+	rect.border.color = ILI9488_COLOR_WHITE;
+	rect.rounded.enable = true;
+	rect.rounded.radius = 12U;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+
+	// Plain rectangle
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = 230U;
+	rect.position.start_col = 20U;
+	rect.position.page_size = 80U;
+	rect.position.col_size = 37U;
+	rect.fill.enable = true;
+	rect.fill.color = ILI9488_COLOR_GRAY;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+
+	// Circles, with and without border
+	memset( &circ, 0, sizeof( circ ));
+	circ.position.start_page = ( 60U + k );
+	circ.position.start_col = 60U;
+	circ.position.radius = 40U;
+	circ.fill.enable = true;
+	circ.fill.color = ILI9488_COLOR_YELLOW;
+	circ.border.enable = true;
+	circ.border.width = 5U;
+	circ.border.color = ILI9488_COLOR_GREEN;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+
+	circ.border.enable = false;
+	circ.position.start_page = 250U;
+	circ.position.start_col = 150U;
+	circ.position.radius = 50U;
+	circ.fill.color = ILI9488_COLOR_TURQUOISE;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+
+	// Text
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_BLACK, ILI9488_COLOR_WHITE, eILI9488_FONT_24 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Hello World", 100U + k, 100U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_BLACK, ILI9488_COLOR_LIGHT_GRAY, eILI9488_FONT_12 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Grey text", 200U, 140U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_RED, ILI9488_COLOR_BLACK, eILI9488_FONT_8 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "tiny", 20U, 7U ), "string" );
+
+	// Bitmap
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &g_bitmap, 150U + k, 180U ), "bitmap" );
+
+	// Lines and polygons
+	for ( i = 0; i < 8U; i++ )
+	{
+		chart[i].page = ( 10U + ( i * 40U ));
+		chart[i].col = ( 200U + ((( i * 37U ) + k ) % 50U ));
+	}
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 0U, 0U, 300U, 170U + k, ILI9488_COLOR_WHITE ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_polyline( chart, 8U, ILI9488_COLOR_YELLOW ), "polyline" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_triangle( tri, ILI9488_COLOR_GREEN ), "triangle" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_polygon( star, 5U, eILI9488_FILL_EVEN_ODD, ILI9488_COLOR_PURPLE ), "polygon" );
+
+	// Gauge
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( 270U, 270U, 40U, 8U, 30U, 200U + k, ILI9488_COLOR_YELLOW ), "arc" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_pie( 270U, 270U, 25U, 300U, 60U, ILI9488_COLOR_RED ), "pie" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare direct drawing and frames
+*
+*	First frame redraws whole scene, second frame has no
+*	explicit invalidation, so only objects that changed are
+*	redrawn.
+*
+*	param: 		orientation - Display orientation
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_frame_vs_direct(const ili9488_orientation_t orientation)
+{
+	uint8_t max_diff;
+	uint32_t num;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( orientation ), "orientation %u", orientation );
+
+	// Reference
+	test_scene( 7U );
+	ili9488_test_snapshot( &g_direct );
+
+	// Full frame, then frame with changes only
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	test_scene( 0U );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	test_scene( 7U );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+	ili9488_test_snapshot( &g_frame );
+
+	num = ili9488_test_compare( &g_direct, &g_frame, 0U, &max_diff );
+	ILI9488_TEST_CHECK( 0U == num, "orientation %u: %u pixels differ, up to %u", orientation, num, max_diff );
+}
+
+
+#if ( ILI9488_AA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw anti-aliased test scene
+	*
+	*	Objects are drawn on black background and do not
+	*	overlap, so direct drawing blends with the same color
+	*	as frame does.
+	*	Circles of several sizes cross strip boundaries at
+	*	different places.
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_scene_aa(void)
+	{
+		uint16_t r;
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+
+		for ( r = 8U; r <= 40U; r += 8U )
+		{
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle_aa( 240U, 163U, r, ( 16U != r ), ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA circle %u", r );
+		}
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle_aa( 60U, 250U, 45U, false, ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLACK ), "AA circle" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 5U, 5U, 290U, 110U, ILI9488_COLOR_GREEN, ILI9488_COLOR_BLACK ), "AA line" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 300U, 10U, 315U, 310U, ILI9488_COLOR_RED, ILI9488_COLOR_BLACK ), "AA line" );
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK, eILI9488_FONT_24 ), "string pen" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_aa( "Smooth 0123", 120U, 280U ), "AA string" );
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Compare anti-aliased direct drawing and frame
+	*
+	*	Direct drawing blends through table of
+	*	ILI9488_AA_LEVELS steps, frame blends exactly, so
+	*	small differences are allowed.
+	*
+	*	param: 		orientation - Display orientation
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_frame_vs_direct_aa(const ili9488_orientation_t orientation)
+	{
+		uint8_t max_diff;
+		uint32_t num;
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( orientation ), "orientation %u", orientation );
+
+		test_scene_aa();
+		ili9488_test_snapshot( &g_direct );
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+		test_scene_aa();
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_invalidate( 0U, 0U, ili9488_get_width(), ili9488_get_height()), "frame invalidate" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+		ili9488_test_snapshot( &g_frame );
+
+		num = ili9488_test_compare( &g_direct, &g_frame, TEST_AA_TOLERANCE, &max_diff );
+		ILI9488_TEST_CHECK( 0U == num, "AA, orientation %u: %u pixels differ, up to %u", orientation, num, max_diff );
+	}
+
+#endif // ILI9488_AA_EN
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	uint32_t i;
+	uint8_t o;
+
+	for ( i = 0; i < sizeof( gu8_bitmap_data ); i += 3U )
+	{
+		gu8_bitmap_data[ i + 0U ] = (uint8_t)(( i / 3U ) % TEST_BITMAP_WIDTH * 6U );
+		gu8_bitmap_data[ i + 1U ] = (uint8_t)(( i / 3U ) / TEST_BITMAP_WIDTH * 8U );
+		gu8_bitmap_data[ i + 2U ] = 128U;
+	}
+
+	ili9488_test_init( async );
+
+	for ( o = 0; o < eILI9488_ORIENTATION_NUM_OF; o++ )
+	{
+		test_frame_vs_direct((ili9488_orientation_t) o );
+
+		#if ( ILI9488_AA_EN )
+			test_frame_vs_direct_aa((ili9488_orientation_t) o );
+		#endif
+	}
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
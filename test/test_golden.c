@@ -0,0 +1,692 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Golden images and throughput of drawing primitives.
+//
+//	Each primitive is drawn on black display and checksum
+//	of emulated GRAM is compared against reference, kept
+//	below. On mismatch image is dumped to build directory
+//	for inspection. Reference changes only when drawing is
+//	changed on purpose.
+//
+//	With blocking transport, primitives are drawn once more
+//	to transport which drops data, and time per call is
+//	reported. Emulator is left out of measure, so that only
+//	driver itself is measured.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Size of test bitmaps
+#define TEST_GOLDEN_BMP_WIDTH			( 40U )
+#define TEST_GOLDEN_BMP_HEIGHT			( 30U )
+
+// Minimum time of throughput measure for each primitive
+#define TEST_GOLDEN_MEASURE_NS			( 50000000ULL )
+
+// Directory of dumped images
+#define TEST_GOLDEN_DUMP_DIR			"build/"
+
+// Primitive
+typedef struct
+{
+	const char *	p_name;
+	void			(*pf_draw)(void);
+	uint32_t		crc;			// Checksum of reference image
+} test_golden_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// GRAM snapshot
+static ili9488_test_gram_t g_gram;
+
+// Test bitmaps
+static uint8_t gu8_rgb888[ TEST_GOLDEN_BMP_WIDTH * TEST_GOLDEN_BMP_HEIGHT * 3U ];
+static uint8_t gu8_rgb565[ TEST_GOLDEN_BMP_WIDTH * TEST_GOLDEN_BMP_HEIGHT * 2U ];
+static uint8_t gu8_mono[ TEST_GOLDEN_BMP_HEIGHT * (( TEST_GOLDEN_BMP_WIDTH + 7U ) / 8U )];
+static uint8_t gu8_index_4[ TEST_GOLDEN_BMP_HEIGHT * (( TEST_GOLDEN_BMP_WIDTH + 1U ) / 2U )];
+static uint8_t gu8_palette[ 16U * 3U ];
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static void test_golden_background	(void);
+static void test_golden_rect		(void);
+static void test_golden_round_rect	(void);
+static void test_golden_circle		(void);
+static void test_golden_bord_circle	(void);
+static void test_golden_string		(void);
+static void test_golden_bitmap		(void);
+static void test_golden_line		(void);
+static void test_golden_polyline	(void);
+static void test_golden_triangle	(void);
+static void test_golden_polygon		(void);
+static void test_golden_arc			(void);
+static void test_golden_pie			(void);
+
+#if ( ILI9488_AA_EN )
+	static void test_golden_line_aa		(void);
+	static void test_golden_circle_aa	(void);
+	static void test_golden_string_aa	(void);
+#endif
+
+
+//////////////////////////////////////////////////////////////
+//	Primitives and their references
+//////////////////////////////////////////////////////////////
+static const test_golden_t g_golden[] =
+{
+	// Name				Draw function				Reference
+	{ "background",		&test_golden_background,	0xC6DE7105UL },
+	{ "rectangle",		&test_golden_rect,			0x22861904UL },
+	{ "round rect",		&test_golden_round_rect,	0x3C2A6B64UL },
+	{ "circle",			&test_golden_circle,		0xC8192045UL },
+	{ "bord circle",	&test_golden_bord_circle,	0xB5CD9E9DUL },
+	{ "string",			&test_golden_string,		0xF92B5286UL },
+	{ "bitmap",			&test_golden_bitmap,		0x1BDB2067UL },
+	{ "line",			&test_golden_line,			0x1004B0E0UL },
+	{ "polyline",		&test_golden_polyline,		0x104E1FAFUL },
+	{ "triangle",		&test_golden_triangle,		0x3E548B9BUL },
+	{ "polygon",		&test_golden_polygon,		0xEA7B3697UL },
+	{ "arc",			&test_golden_arc,			0x713343D2UL },
+	{ "pie",			&test_golden_pie,			0xB3316591UL },
+
+#if ( ILI9488_AA_EN )
+	{ "line AA",		&test_golden_line_aa,		0x85C55581UL },
+	{ "circle AA",		&test_golden_circle_aa,		0x50FA9F96UL },
+	{ "string AA",		&test_golden_string_aa,		0x26B8D9C9UL },
+#endif
+};
+
+// Number of primitives
+#define TEST_GOLDEN_NUM					( sizeof( g_golden ) / sizeof( test_golden_t ))
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Fill test bitmaps
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_bitmap_fill(void)
+{
+	uint32_t i;
+	uint16_t x;
+	uint16_t y;
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+
+	for ( y = 0; y < TEST_GOLDEN_BMP_HEIGHT; y++ )
+	{
+		for ( x = 0; x < TEST_GOLDEN_BMP_WIDTH; x++ )
+		{
+			i = (( y * TEST_GOLDEN_BMP_WIDTH ) + x );
+			r = (uint8_t)( x * 6U );
+			g = (uint8_t)( y * 8U );
+			b = (uint8_t)(( x + y ) * 3U );
+
+			gu8_rgb888[ 3U * i + 0U ] = r;
+			gu8_rgb888[ 3U * i + 1U ] = g;
+			gu8_rgb888[ 3U * i + 2U ] = b;
+
+			gu8_rgb565[ 2U * i + 0U ] = (uint8_t)(( r & 0xF8U ) | ( g >> 5 ));
+			gu8_rgb565[ 2U * i + 1U ] = (uint8_t)((( g << 3 ) & 0xE0U ) | ( b >> 3 ));
+
+			if ( 0U != (( x ^ y ) & 4U ))
+			{
+				gu8_mono[( y * (( TEST_GOLDEN_BMP_WIDTH + 7U ) / 8U )) + ( x / 8U )] |= (uint8_t)( 0x80U >> ( x % 8U ));
+			}
+			else
+			{
+				// No actions...
+			}
+
+			gu8_index_4[( y * (( TEST_GOLDEN_BMP_WIDTH + 1U ) / 2U )) + ( x / 2U )] |= (uint8_t)((( x + y ) & 0x0FU ) << (( 0U == ( x % 2U )) ? ( 4U ) : ( 0U )));
+		}
+	}
+
+	for ( i = 0; i < 16U; i++ )
+	{
+		gu8_palette[ 3U * i + 0U ] = (uint8_t)( i * 17U );
+		gu8_palette[ 3U * i + 1U ] = (uint8_t)( 255U - ( i * 17U ));
+		gu8_palette[ 3U * i + 2U ] = (uint8_t)(( i & 1U ) * 255U );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Background
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_background(void)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_RGB888( 0x20U, 0x40U, 0x60U )), "background" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Rectangles, filled and hollow
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_rect(void)
+{
+	ili9488_rect_attr_t rect;
+
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = 10U;
+	rect.position.start_col = 20U;
+	rect.position.page_size = 200U;
+	rect.position.col_size = 100U;
+	rect.fill.enable = true;
+	rect.fill.color = ILI9488_COLOR_RED;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+
+	rect.position.start_page = 250U;
+	rect.position.start_col = 150U;
+	rect.position.page_size = 150U;
+	rect.position.col_size = 120U;
+	rect.fill.color = ILI9488_COLOR_GREEN;
+	rect.border.enable = true;
+	rect.border.width = 4U;
+	rect.border.color = ILI9488_COLOR_WHITE;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+
+	rect.position.start_page = 30U;
+	rect.position.start_col = 200U;
+	rect.fill.enable = false;
+	rect.border.color = ILI9488_COLOR_YELLOW;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Rounded rectangles, filled and hollow
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_round_rect(void)
+{
+	ili9488_rect_attr_t rect;
+
+	memset( &rect, 0, sizeof( rect ));
+	rect.position.start_page = 10U;
+	rect.position.start_col = 20U;
+	rect.position.page_size = 200U;
+	rect.position.col_size = 100U;
+	rect.fill.enable = true;
+	rect.fill.color = ILI9488_COLOR_RED;
+	rect.border.enable = true;
+	rect.border.width = 3U;
+	rect.border.color = ILI9488_COLOR_WHITE;
+	rect.rounded.enable = true;
+	rect.rounded.radius = 12U;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+
+	rect.position.start_page = 250U;
+	rect.position.start_col = 150U;
+	rect.position.page_size = 150U;
+	rect.position.col_size = 120U;
+	rect.fill.enable = false;
+	rect.border.width = 6U;
+	rect.border.color = ILI9488_COLOR_TURQUOISE;
+	rect.rounded.radius = 30U;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_rectangle( &rect ), "rectangle" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Filled circles
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_circle(void)
+{
+	ili9488_circ_attr_t circ;
+
+	memset( &circ, 0, sizeof( circ ));
+	circ.position.start_page = 100U;
+	circ.position.start_col = 100U;
+	circ.position.radius = 80U;
+	circ.fill.enable = true;
+	circ.fill.color = ILI9488_COLOR_YELLOW;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+
+	circ.position.start_page = 350U;
+	circ.position.start_col = 220U;
+	circ.position.radius = 7U;
+	circ.fill.color = ILI9488_COLOR_PURPLE;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Circles with border, filled and hollow
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_bord_circle(void)
+{
+	ili9488_circ_attr_t circ;
+
+	memset( &circ, 0, sizeof( circ ));
+	circ.position.start_page = 100U;
+	circ.position.start_col = 100U;
+	circ.position.radius = 80U;
+	circ.fill.enable = true;
+	circ.fill.color = ILI9488_COLOR_YELLOW;
+	circ.border.enable = true;
+	circ.border.width = 5U;
+	circ.border.color = ILI9488_COLOR_GREEN;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+
+	circ.position.start_page = 330U;
+	circ.position.start_col = 200U;
+	circ.position.radius = 60U;
+	circ.fill.enable = false;
+	circ.border.width = 2U;
+	circ.border.color = ILI9488_COLOR_WHITE;
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle( &circ ), "circle" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Strings in all built-in fonts
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_string(void)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_RED, ILI9488_COLOR_BLACK, eILI9488_FONT_8 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Font 8: 0123456789 !?", 10U, 10U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_GREEN, ILI9488_COLOR_BLACK, eILI9488_FONT_12 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Font 12: Hello World", 10U, 30U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_BLUE, ILI9488_COLOR_WHITE, eILI9488_FONT_16 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Font 16: abcdefgh", 10U, 60U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_GRAY, eILI9488_FONT_20 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Font 20: ABCDEFGH", 10U, 100U ), "string" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_BLACK, ILI9488_COLOR_LIGHT_GRAY, eILI9488_FONT_24 ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( "Font 24: {[()]}", 10U, 150U ), "string" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Bitmaps of uncompressed formats
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_bitmap(void)
+{
+	const ili9488_bitmap_t rgb888	= { .p_data = gu8_rgb888, .width = TEST_GOLDEN_BMP_WIDTH, .height = TEST_GOLDEN_BMP_HEIGHT, .format = eILI9488_BITMAP_RGB888 };
+	const ili9488_bitmap_t rgb565	= { .p_data = gu8_rgb565, .width = TEST_GOLDEN_BMP_WIDTH, .height = TEST_GOLDEN_BMP_HEIGHT, .format = eILI9488_BITMAP_RGB565 };
+	const ili9488_bitmap_t mono		= { .p_data = gu8_mono, .width = TEST_GOLDEN_BMP_WIDTH, .height = TEST_GOLDEN_BMP_HEIGHT, .format = eILI9488_BITMAP_MONO, .fg_color = ILI9488_COLOR_WHITE, .bg_color = ILI9488_COLOR_RED };
+	const ili9488_bitmap_t index_4	= { .p_data = gu8_index_4, .width = TEST_GOLDEN_BMP_WIDTH, .height = TEST_GOLDEN_BMP_HEIGHT, .format = eILI9488_BITMAP_INDEX_4, .p_palette = gu8_palette };
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &rgb888, 10U, 10U ), "bitmap" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &rgb565, 60U, 10U ), "bitmap" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &mono, 110U, 10U ), "bitmap" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &index_4, 160U, 10U ), "bitmap" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( &rgb888, 300U, 250U ), "bitmap" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Lines in all octants
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_line(void)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 470U, 160U, ILI9488_COLOR_WHITE ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 240U, 10U, ILI9488_COLOR_RED ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 100U, 300U, ILI9488_COLOR_GREEN ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 470U, 230U, ILI9488_COLOR_YELLOW ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 200U, 10U, ILI9488_COLOR_TURQUOISE ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 0U, 100U, ILI9488_COLOR_PURPLE ), "line" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( 240U, 160U, 280U, 319U, ILI9488_COLOR_BLUE ), "line" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Polyline
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_polyline(void)
+{
+	ili9488_point_t chart[12];
+	uint16_t i;
+
+	for ( i = 0; i < 12U; i++ )
+	{
+		chart[i].page = ( 10U + ( i * 40U ));
+		chart[i].col = ( 100U + (( i * 73U ) % 150U ));
+	}
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_polyline( chart, 12U, ILI9488_COLOR_YELLOW ), "polyline" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Triangles
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_triangle(void)
+{
+	const ili9488_point_t tri_a[3] = {{ 20, 250 }, { 220, 30 }, { 160, 310 }};
+	const ili9488_point_t tri_b[3] = {{ 300, 20 }, { 460, 20 }, { 380, 200 }};
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_triangle( tri_a, ILI9488_COLOR_GREEN ), "triangle" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_triangle( tri_b, ILI9488_COLOR_RED ), "triangle" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Star polygon with both fill rules
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_polygon(void)
+{
+	const ili9488_point_t star_a[5] = {{ 120, 20 }, { 190, 300 }, { 10, 120 }, { 230, 120 }, { 50, 300 }};
+	const ili9488_point_t star_b[5] = {{ 360, 20 }, { 430, 300 }, { 250, 120 }, { 470, 120 }, { 290, 300 }};
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_polygon( star_a, 5U, eILI9488_FILL_EVEN_ODD, ILI9488_COLOR_PURPLE ), "polygon" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_polygon( star_b, 5U, eILI9488_FILL_NON_ZERO, ILI9488_COLOR_TURQUOISE ), "polygon" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Arcs, across 0 degrees and full ring
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_arc(void)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( 120U, 160U, 100U, 12U, 30U, 250U, ILI9488_COLOR_YELLOW ), "arc" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( 120U, 160U, 80U, 5U, 300U, 60U, ILI9488_COLOR_RED ), "arc" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_arc( 360U, 160U, 90U, 20U, 0U, 360U, ILI9488_COLOR_GREEN ), "arc" );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Pies
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_pie(void)
+{
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_pie( 120U, 160U, 100U, 300U, 60U, ILI9488_COLOR_RED ), "pie" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_pie( 360U, 160U, 100U, 45U, 290U, ILI9488_COLOR_BLUE ), "pie" );
+}
+
+
+#if ( ILI9488_AA_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Anti-aliased lines
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_golden_line_aa(void)
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 240U, 160U, 470U, 230U, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA line" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 240U, 160U, 200U, 10U, ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLACK ), "AA line" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 240U, 160U, 0U, 100U, ILI9488_COLOR_RED, ILI9488_COLOR_BLACK ), "AA line" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line_aa( 240U, 160U, 280U, 319U, ILI9488_COLOR_TURQUOISE, ILI9488_COLOR_BLACK ), "AA line" );
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Anti-aliased circles, filled and outline
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_golden_circle_aa(void)
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle_aa( 120U, 160U, 90U, true, ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLACK ), "AA circle" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_circle_aa( 360U, 160U, 90U, false, ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK ), "AA circle" );
+	}
+
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Anti-aliased string
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_golden_string_aa(void)
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK, eILI9488_FONT_24 ), "string pen" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_aa( "Smooth AA text", 10U, 10U ), "AA string" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLACK, eILI9488_FONT_12 ), "string pen" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_aa( "Small AA text", 10U, 60U ), "AA string" );
+	}
+
+#endif // ILI9488_AA_EN
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare primitives against golden images
+*
+*	Reference of each primitive is checked in current
+*	orientation, on black display. 3-bit pixel format
+*	must give same images, so references are shared by
+*	all configurations.
+*
+*	param: 		async - Non-blocking transport is used
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_images(const bool async)
+{
+	ili9488_emu_stats_t stats;
+	char file[64];
+	uint32_t crc;
+	uint32_t i;
+
+	if ( false == async )
+	{
+		printf( "  %-12s %11s %10s %10s\n", "primitive", "pixels", "bytes", "commands" );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	for ( i = 0; i < TEST_GOLDEN_NUM; i++ )
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+		ili9488_emu_reset_stats();
+
+		g_golden[i].pf_draw();
+
+		ili9488_test_measure( &stats );
+		ili9488_test_snapshot( &g_gram );
+		crc = ili9488_test_checksum( &g_gram );
+
+		ILI9488_TEST_CHECK( crc == g_golden[i].crc, "%s: golden image, checksum 0x%08XUL instead of 0x%08XUL", g_golden[i].p_name, crc, g_golden[i].crc );
+
+		if ( crc != g_golden[i].crc )
+		{
+			(void) snprintf( file, sizeof( file ), "%sgolden_%u_%s.ppm", TEST_GOLDEN_DUMP_DIR, i, (( true == async ) ? ( "async" ) : ( "sync" )));
+			(void) ili9488_emu_dump_ppm( file );
+			printf( "    dumped to %s\n", file );
+		}
+		else
+		{
+			// No actions...
+		}
+
+		if ( false == async )
+		{
+			printf( "  %-12s %11u %10u %10u\n", g_golden[i].p_name, stats.pixels, stats.bytes, stats.commands );
+		}
+		else
+		{
+			// No actions...
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report throughput of primitives
+*
+*	Transport drops data, so emulator time is not counted.
+*	Each primitive is repeated for at least measure time.
+*	Emulated GRAM no longer follows driver afterwards, so
+*	this runs last.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_golden_throughput(void)
+{
+	uint64_t start;
+	uint64_t time;
+	uint32_t num;
+	uint32_t i;
+
+	ili9488_test_drop( true );
+
+	printf( "  %-12s %10s %10s\n", "primitive", "us/call", "calls/s" );
+
+	for ( i = 0; i < TEST_GOLDEN_NUM; i++ )
+	{
+		num = 0;
+		start = ili9488_test_time_ns();
+
+		do
+		{
+			g_golden[i].pf_draw();
+			num++;
+			time = ( ili9488_test_time_ns() - start );
+		}
+		while ( time < TEST_GOLDEN_MEASURE_NS );
+
+		printf( "  %-12s %10.1f %10.0f\n", g_golden[i].p_name, (( (double) time / 1000.0 ) / (double) num ), (( (double) num * 1e9 ) / (double) time ));
+	}
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	ili9488_test_drop( false );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Golden images and throughput test
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments
+*	return:		Exit code
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	test_golden_bitmap_fill();
+	ili9488_test_init( async );
+
+	test_golden_images( async );
+
+	// Throughput is reported once, with blocking transport
+	if ( false == async )
+	{
+		test_golden_throughput();
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
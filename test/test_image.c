@@ -0,0 +1,347 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Compressed images. Test image is compressed by host
+//	image compressor into RLE and LZ bitmaps, which must
+//	draw exactly as raw RGB888 bitmap, directly and inside
+//	frames, at the same transport cost. Truncated stream
+//	must be caught by failed assert instead of being read
+//	past its end. With blocking transport, decode speed of
+//	both formats is reported.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_image.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Image size, see gen_image.c
+#define TEST_IMAGE_WIDTH				( 160U )
+#define TEST_IMAGE_HEIGHT				( 100U )
+
+// Image position
+#define TEST_IMAGE_PAGE					( 30U )
+#define TEST_IMAGE_COL					( 20U )
+
+// Minimum time of decode speed measure
+#define TEST_IMAGE_MEASURE_NS			( 200000000ULL )
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Compressed images, generated by ili9488_imgconv
+extern const ili9488_bitmap_t image_rle;
+extern const ili9488_bitmap_t image_lz;
+
+// Raw image
+static uint8_t gu8_raw_data[ TEST_IMAGE_WIDTH * TEST_IMAGE_HEIGHT * 3U ];
+static const ili9488_bitmap_t g_raw = { .p_data = gu8_raw_data, .width = TEST_IMAGE_WIDTH, .height = TEST_IMAGE_HEIGHT, .format = eILI9488_BITMAP_RGB888 };
+
+// Raw and compressed result
+static ili9488_test_gram_t g_raw_gram;
+static ili9488_test_gram_t g_gram;
+
+// Number of decoded pixels
+static uint32_t gu32_put_pixels = 0;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read test image
+*
+*	param: 		none
+*	return:		True when image is read
+*/
+//////////////////////////////////////////////////////////////
+static bool test_image_read(void)
+{
+	FILE * p_f;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	bool is_ok = false;
+
+	p_f = fopen( TEST_IMAGE_PPM, "rb" );
+
+	if ( NULL != p_f )
+	{
+		is_ok = (	( 2 == fscanf( p_f, "P6 %u %u 255", &width, &height ))
+				&&	( TEST_IMAGE_WIDTH == width )
+				&&	( TEST_IMAGE_HEIGHT == height )
+				&&	( '\n' == fgetc( p_f ))
+				&&	( 1U == fread( gu8_raw_data, sizeof( gu8_raw_data ), 1U, p_f )));
+
+		(void) fclose( p_f );
+	}
+
+	return is_ok;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw image on background
+*
+*	param: 		p_bitmap - Pointer to bitmap
+*	param: 		frame_en - Draw inside frame
+*	param: 		p_stats - Pointer to transport statistics of image
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_image_draw(const ili9488_bitmap_t * const p_bitmap, const bool frame_en, ili9488_emu_stats_t * const p_stats)
+{
+	ili9488_emu_stats_t stats;
+
+	if ( true == frame_en )
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLUE ), "background" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_bitmap( p_bitmap, TEST_IMAGE_PAGE, TEST_IMAGE_COL ), "bitmap format %u", p_bitmap -> format );
+
+	if ( true == frame_en )
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	ili9488_test_measure( p_stats );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare compressed images with raw image
+*
+*	param: 		orientation - Display orientation
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_image_compare(const ili9488_orientation_t orientation)
+{
+	const ili9488_bitmap_t * const p_bitmaps[] = { &image_rle, &image_lz };
+	ili9488_emu_stats_t raw_stats;
+	ili9488_emu_stats_t stats;
+	uint8_t max_diff;
+	uint32_t num;
+	uint8_t i;
+	uint8_t k;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( orientation ), "orientation %u", orientation );
+
+	test_image_draw( &g_raw, false, &raw_stats );
+	ili9488_test_snapshot( &g_raw_gram );
+
+	ILI9488_TEST_CHECK( raw_stats.pixels == ( TEST_IMAGE_WIDTH * TEST_IMAGE_HEIGHT ), "raw: %u pixels", raw_stats.pixels );
+
+	for ( i = 0; i < ( sizeof( p_bitmaps ) / sizeof( p_bitmaps[0] )); i++ )
+	{
+		// Directly
+		test_image_draw( p_bitmaps[i], false, &stats );
+		ili9488_test_snapshot( &g_gram );
+
+		num = ili9488_test_compare( &g_raw_gram, &g_gram, 0U, &max_diff );
+		ILI9488_TEST_CHECK( 0U == num, "format %u, orientation %u: %u pixels differ, up to %u", p_bitmaps[i] -> format, orientation, num, max_diff );
+
+		ILI9488_TEST_CHECK( stats.pixels == raw_stats.pixels, "format %u: %u pixels, raw %u", p_bitmaps[i] -> format, stats.pixels, raw_stats.pixels );
+		ILI9488_TEST_CHECK( stats.bytes == raw_stats.bytes, "format %u: %u bytes, raw %u", p_bitmaps[i] -> format, stats.bytes, raw_stats.bytes );
+		ILI9488_TEST_CHECK( stats.mem_writes == raw_stats.mem_writes, "format %u: %u memory writes, raw %u", p_bitmaps[i] -> format, stats.mem_writes, raw_stats.mem_writes );
+
+		// Inside frame, raw image is replaced by compressed one
+		for ( k = 0; k < 2U; k++ )
+		{
+			test_image_draw((( 0U == k ) ? ( &g_raw ) : ( p_bitmaps[i] )), true, &stats );
+		}
+
+		ili9488_test_snapshot( &g_gram );
+
+		num = ili9488_test_compare( &g_raw_gram, &g_gram, 0U, &max_diff );
+		ILI9488_TEST_CHECK( 0U == num, "format %u, orientation %u, frame: %u pixels differ, up to %u", p_bitmaps[i] -> format, orientation, num, max_diff );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Count and drop decoded pixels
+*
+*	param: 		p_rgb - Color of pixels
+*	param: 		size - Number of pixels
+*	return:		status - Always Ok
+*/
+//////////////////////////////////////////////////////////////
+static ili9488_status_t test_image_put(const ili9488_rgb_t * const p_rgb, const uint32_t size)
+{
+	(void) p_rgb;
+
+	gu32_put_pixels += size;
+
+	return eILI9488_OK;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Decode truncated stream
+*
+*	Failed assert aborts, so stream is decoded in child
+*	process. Must be called before display init, as child
+*	gets no emulator thread.
+*
+*	param: 		p_bitmap - Pointer to compressed bitmap
+*	param: 		size - Size of truncated stream in bytes
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_image_truncated(const ili9488_bitmap_t * const p_bitmap, const uint32_t size)
+{
+	ili9488_bitmap_t bitmap = *p_bitmap;
+	int wstatus = 0;
+	pid_t pid;
+
+	bitmap.size = size;
+
+	fflush( stdout );
+	pid = fork();
+
+	if ( 0 == pid )
+	{
+		(void) ili9488_image_decode( &bitmap, test_image_put );
+		_exit( 0 );
+	}
+
+	(void) waitpid( pid, &wstatus, 0 );
+
+	ILI9488_TEST_CHECK( WIFSIGNALED( wstatus ) && ( SIGABRT == WTERMSIG( wstatus )), "format %u: stream truncated to %u B not detected", p_bitmap -> format, size );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report decode speed
+*
+*	Decoded pixels are dropped, so only decoder is timed.
+*
+*	param: 		p_bitmap - Pointer to compressed bitmap
+*	param: 		p_name - Name of format
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_image_throughput(const ili9488_bitmap_t * const p_bitmap, const char * const p_name)
+{
+	const uint32_t pixels = ( p_bitmap -> width * p_bitmap -> height );
+	ili9488_status_t status = eILI9488_OK;
+	uint64_t start;
+	uint64_t time;
+	uint32_t num = 0;
+
+	gu32_put_pixels = 0;
+	start = ili9488_test_time_ns();
+
+	do
+	{
+		status |= ili9488_image_decode( p_bitmap, test_image_put );
+
+		num++;
+		time = ( ili9488_test_time_ns() - start );
+	}
+	while ( time < TEST_IMAGE_MEASURE_NS );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == status, "%s: decode", p_name );
+	ILI9488_TEST_CHECK( gu32_put_pixels == ( num * pixels ), "%s: %u pixels decoded in %u decodes", p_name, gu32_put_pixels, num );
+
+	printf( "  %-3s %6u B: %8.1f us, %6.1f MB/s, %6.1f Mpixels/s\n", p_name, p_bitmap -> size, (( (double) time / 1000.0 ) / (double) num ),
+			((( (double) num * p_bitmap -> size ) * 1e3 ) / (double) time ), ((( (double) num * pixels ) * 1e3 ) / (double) time ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	const ili9488_bitmap_t * const p_bitmaps[] = { &image_rle, &image_lz };
+	const char * const p_names[] = { "RLE", "LZ" };
+	uint8_t i;
+	uint8_t o;
+
+	ILI9488_TEST_CHECK( true == test_image_read(), "read %s", TEST_IMAGE_PPM );
+	ILI9488_TEST_CHECK(( TEST_IMAGE_WIDTH == image_rle.width ) && ( TEST_IMAGE_HEIGHT == image_rle.height ), "RLE size" );
+	ILI9488_TEST_CHECK(( TEST_IMAGE_WIDTH == image_lz.width ) && ( TEST_IMAGE_HEIGHT == image_lz.height ), "LZ size" );
+
+	for ( i = 0; i < ( sizeof( p_bitmaps ) / sizeof( p_bitmaps[0] )); i++ )
+	{
+		gu32_put_pixels = 0;
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_image_decode( p_bitmaps[i], test_image_put ), "format %u: decode", p_bitmaps[i] -> format );
+		ILI9488_TEST_CHECK(( TEST_IMAGE_WIDTH * TEST_IMAGE_HEIGHT ) == gu32_put_pixels, "format %u: %u pixels decoded", p_bitmaps[i] -> format, gu32_put_pixels );
+
+		test_image_truncated( p_bitmaps[i], ( p_bitmaps[i] -> size - 1U ));
+		test_image_truncated( p_bitmaps[i], ( p_bitmaps[i] -> size / 2U ));
+		test_image_truncated( p_bitmaps[i], 0U );
+
+		// Speed is reported once, with blocking transport
+		if ( false == async )
+		{
+			test_image_throughput( p_bitmaps[i], p_names[i] );
+		}
+		else
+		{
+			// No actions...
+		}
+	}
+
+	ili9488_test_init( async );
+
+	for ( o = 0; o < eILI9488_ORIENTATION_NUM_OF; o++ )
+	{
+		test_image_compare((ili9488_orientation_t) o );
+	}
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
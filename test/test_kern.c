@@ -0,0 +1,306 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Proportional layout of compiled font. Test font of
+//	font_kern.c has solid box glyphs, so position of every
+//	glyph is known by hand:
+//
+//		'A' - 4x6 box at 1,1, advance 6
+//		'B' - 2x8 box at 0,0, advance 3
+//		'C' - 8x2 box at 0,6, advance 4, reaches into next
+//		'D' - empty, advance of font width 6
+//		'E' - first and last page of 8x8 box, advance 1
+//
+//	with kerning A-B -3, B-A +2, B-B -5 and C-A -2. Width of
+//	string, its area and drawn pixels are checked, directly
+//	and through frame. String of 'E' overlaps more glyphs
+//	than driver reads at once, those wait for free slot and
+//	lose pages passed meanwhile.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_font.h"
+
+#if ( ILI9488_RENDER_EN )
+	#include "ili9488_render.h"
+#endif
+
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Test font
+#define TEST_KERN_FONT					( eILI9488_FONT_USER_0 )
+
+// Font height
+#define TEST_KERN_HEIGHT				( 8U )
+
+// Position of strings
+#define TEST_KERN_PAGE					( 100U )
+#define TEST_KERN_COL					( 50U )
+
+// Most foreground boxes of string
+#define TEST_KERN_BOX_NUM				( 4U )
+
+// Foreground box of string, in pages and columns from
+// string start, end is excluded
+typedef struct
+{
+	uint8_t	page_s;
+	uint8_t	page_e;
+	uint8_t	col_s;
+	uint8_t	col_e;
+} test_kern_box_t;
+
+// String with hand computed layout
+typedef struct
+{
+	const char *	p_str;
+	uint32_t		width;
+	uint32_t		box_num;
+	test_kern_box_t	box[ TEST_KERN_BOX_NUM ];
+} test_kern_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Test strings
+static const test_kern_t g_kern[] =
+{
+	// A at 0, B at 0+6-3, C at 3+3, A at 6+4-2. C box ends at 6+8
+	{ "ABCA",	14U, 4U, {{ 1U, 5U, 1U, 7U }, { 3U, 5U, 0U, 8U }, { 6U, 14U, 6U, 8U }, { 9U, 13U, 1U, 7U }}},
+
+	// Empty D advances for font width
+	{ "DAD",	18U, 1U, {{ 7U, 11U, 1U, 7U }}},
+
+	// Advance of B with B kerning is clamped to 0
+	{ "BB",		3U, 1U, {{ 0U, 2U, 0U, 8U }}},
+
+	// Four glyphs over same page, every one has a slot
+	{ "EEEE",	11U, 2U, {{ 0U, 4U, 0U, 8U }, { 7U, 11U, 0U, 8U }}},
+
+	// Fifth and sixth glyph wait for slot until page 8 and 9,
+	// their first page 4 and 5 is lost
+	{ "EEEEEE",	13U, 2U, {{ 0U, 4U, 0U, 8U }, { 7U, 13U, 0U, 8U }}},
+};
+
+// Number of test strings
+#define TEST_KERN_NUM					( sizeof( g_kern ) / sizeof( test_kern_t ))
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check advances and fit of test font
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_kern_advance(void)
+{
+	const ili9488_font_t * p_font = ili9488_font_get( TEST_KERN_FONT );
+	uint32_t width;
+	uint32_t fit;
+	uint32_t i;
+
+	ILI9488_TEST_CHECK( -3 == ili9488_font_get_kerning( p_font, 'A', 'B' ), "kerning A-B" );
+	ILI9488_TEST_CHECK( 0 == ili9488_font_get_kerning( p_font, 'A', 'C' ), "kerning A-C" );
+	ILI9488_TEST_CHECK( -2 == ili9488_font_get_kerning( p_font, 'C', 'A' ), "kerning C-A" );
+
+	ILI9488_TEST_CHECK( 3U == ili9488_font_get_advance( p_font, 'A', 'B' ), "advance A-B" );
+	ILI9488_TEST_CHECK( 5U == ili9488_font_get_advance( p_font, 'B', 'A' ), "advance B-A" );
+	ILI9488_TEST_CHECK( 0U == ili9488_font_get_advance( p_font, 'B', 'B' ), "advance B-B" );
+	ILI9488_TEST_CHECK( 2U == ili9488_font_get_advance( p_font, 'C', 'A' ), "advance C-A" );
+	ILI9488_TEST_CHECK( 6U == ili9488_font_get_advance( p_font, 'A', '\0' ), "advance A" );
+	ILI9488_TEST_CHECK( 6U == ili9488_font_get_advance( p_font, 'D', 'A' ), "advance D" );
+	ILI9488_TEST_CHECK( 6U == ili9488_font_get_advance( p_font, 'x', 'A' ), "advance of missing character" );
+
+	for ( i = 0; i < TEST_KERN_NUM; i++ )
+	{
+		fit = ili9488_font_fit_string( p_font, g_kern[i].p_str, strlen( g_kern[i].p_str ), 480U, &width );
+
+		ILI9488_TEST_CHECK( fit == strlen( g_kern[i].p_str ), "%s: %u characters fit", g_kern[i].p_str, fit );
+		ILI9488_TEST_CHECK( width == g_kern[i].width, "%s: width %u instead of %u", g_kern[i].p_str, width, g_kern[i].width );
+	}
+
+	// C reaches to 14 with its box
+	fit = ili9488_font_fit_string( p_font, "ABCA", 4U, 13U, &width );
+	ILI9488_TEST_CHECK(( 2U == fit ) && ( 6U == width ), "ABCA in 13 pages: %u characters, width %u", fit, width );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check pixels of drawn string
+*
+*	Strip and one pixel around it are checked.
+*
+*	param: 		p_kern - Pointer to test string
+*	param: 		p_name - Name of check
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_kern_check_pixels(const test_kern_t * const p_kern, const char * const p_name)
+{
+	ili9488_rgb_t rgb;
+	ili9488_color_t exp;
+	uint32_t num = 0;
+	uint32_t b;
+	int32_t j;
+	int32_t i;
+	bool is_fg;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	for ( j = -1; j <= (int32_t) p_kern -> width; j++ )
+	{
+		for ( i = -1; i <= (int32_t) TEST_KERN_HEIGHT; i++ )
+		{
+			is_fg = false;
+
+			for ( b = 0; b < p_kern -> box_num; b++ )
+			{
+				is_fg = (	( true == is_fg )
+						||	(( j >= p_kern -> box[b].page_s ) && ( j < p_kern -> box[b].page_e ) && ( i >= p_kern -> box[b].col_s ) && ( i < p_kern -> box[b].col_e )));
+			}
+
+			if (( j < 0 ) || ( j >= (int32_t) p_kern -> width ) || ( i < 0 ) || ( i >= (int32_t) TEST_KERN_HEIGHT ))
+			{
+				exp = ILI9488_COLOR_BLACK;
+			}
+			else
+			{
+				exp = (( true == is_fg ) ? ( ILI9488_COLOR_YELLOW ) : ( ILI9488_COLOR_BLUE ));
+			}
+
+			ili9488_test_get_pixel((uint16_t)( TEST_KERN_PAGE + j ), (uint16_t)( TEST_KERN_COL + i ), &rgb );
+
+			// GRAM keeps 6 bits of channel
+			if (( rgb.R != ( ILI9488_COLOR_R( exp ) & 0xFCU )) || ( rgb.G != ( ILI9488_COLOR_G( exp ) & 0xFCU )) || ( rgb.B != ( ILI9488_COLOR_B( exp ) & 0xFCU )))
+			{
+				num++;
+			}
+		}
+	}
+
+	ILI9488_TEST_CHECK( 0U == num, "%s %s: %u pixels wrong", p_kern -> p_str, p_name, num );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Draw test strings directly
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_kern_direct(void)
+{
+	ili9488_emu_stats_t stats;
+	uint32_t i;
+
+	for ( i = 0; i < TEST_KERN_NUM; i++ )
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLUE, TEST_KERN_FONT ), "string pen" );
+		ili9488_test_measure( &stats );
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( g_kern[i].p_str, TEST_KERN_PAGE, TEST_KERN_COL ), "string" );
+		ili9488_test_measure( &stats );
+
+		// Packed strip only
+		ILI9488_TEST_CHECK( stats.pixels == ( g_kern[i].width * TEST_KERN_HEIGHT ), "%s: %u pixels", g_kern[i].p_str, stats.pixels );
+		ILI9488_TEST_CHECK( stats.mem_writes == 1U, "%s: %u memory writes", g_kern[i].p_str, stats.mem_writes );
+
+		test_kern_check_pixels( &g_kern[i], "direct" );
+	}
+}
+
+
+#if ( ILI9488_RENDER_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Draw test strings through frame
+	*
+	*	Area of text, which frame renderer invalidates, must
+	*	be packed strip as well.
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_kern_frame(void)
+	{
+		ili9488_region_t area;
+		uint32_t i;
+
+		for ( i = 0; i < TEST_KERN_NUM; i++ )
+		{
+			ili9488_render_get_text_area( g_kern[i].p_str, strlen( g_kern[i].p_str ), TEST_KERN_PAGE, TEST_KERN_COL, TEST_KERN_FONT, &area );
+
+			ILI9488_TEST_CHECK(( TEST_KERN_PAGE == area.page ) && ( TEST_KERN_COL == area.col ), "%s: area at %u, %u", g_kern[i].p_str, area.page, area.col );
+			ILI9488_TEST_CHECK(( g_kern[i].width == area.page_size ) && ( TEST_KERN_HEIGHT == area.col_size ), "%s: area %ux%u", g_kern[i].p_str, area.page_size, area.col_size );
+
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_BLUE, TEST_KERN_FONT ), "string pen" );
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( g_kern[i].p_str, TEST_KERN_PAGE, TEST_KERN_COL ), "string" );
+			ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+			test_kern_check_pixels( &g_kern[i], "frame" );
+		}
+	}
+
+#endif // ILI9488_RENDER_EN
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	test_kern_advance();
+	test_kern_direct();
+
+	#if ( ILI9488_RENDER_EN )
+		test_kern_frame();
+	#endif
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
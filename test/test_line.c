@@ -0,0 +1,316 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Line and polyline cost. Line is written as one window
+//	and one memory write per run of pixels on the same
+//	position of shorter axis, i.e. horizontal and vertical
+//	lines take one window, 45 degree line one per pixel.
+//	Points shared by polyline segments are written once.
+//	Pixels are checked against Bresenham reference.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stdlib.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Test line
+typedef struct
+{
+	const char *	p_name;
+	ili9488_point_t	s;
+	ili9488_point_t	e;
+} test_line_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Test lines
+static const test_line_t g_line[] =
+{
+	{ "horizontal",			{ 10, 20 },		{ 200, 20 }},
+	{ "horizontal back",	{ 200, 30 },	{ 10, 30 }},
+	{ "vertical",			{ 300, 10 },	{ 300, 200 }},
+	{ "vertical back",		{ 310, 200 },	{ 310, 10 }},
+	{ "45 deg",				{ 20, 50 },		{ 120, 150 }},
+	{ "45 deg back",		{ 120, 160 },	{ 20, 260 }},
+	{ "shallow",			{ 10, 250 },	{ 210, 270 }},
+	{ "shallow back",		{ 470, 300 },	{ 250, 290 }},
+	{ "steep",				{ 400, 10 },	{ 420, 300 }},
+	{ "point",				{ 450, 100 },	{ 450, 100 }},
+};
+
+// Number of test lines
+#define TEST_LINE_NUM					( sizeof( g_line ) / sizeof( test_line_t ))
+
+// Test polyline, segments horizontal, vertical and sloped
+static const ili9488_point_t g_polyline[] = {{ 10, 10 }, { 60, 10 }, { 60, 40 }, { 20, 70 }, { 20, 100 }};
+
+// Number of polyline points
+#define TEST_LINE_POLY_NUM				( sizeof( g_polyline ) / sizeof( ili9488_point_t ))
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reference pixel of line
+*
+*	Position on shorter axis is rounded, half down, from
+*	start point.
+*
+*	param: 		p_s - Start point
+*	param: 		p_e - End point
+*	param: 		page - Page of pixel
+*	param: 		col - Column of pixel
+*	return:		true if pixel belongs to line
+*/
+//////////////////////////////////////////////////////////////
+static bool test_line_is_on(const ili9488_point_t * const p_s, const ili9488_point_t * const p_e, const int32_t page, const int32_t col)
+{
+	const int32_t d_page = ((int32_t) p_e -> page - p_s -> page );
+	const int32_t d_col = ((int32_t) p_e -> col - p_s -> col );
+	int32_t d_major;
+	int32_t d_minor;
+	int32_t i;
+	int32_t k;
+	int32_t minor;
+	bool is_on = false;
+
+	if ( abs( d_page ) >= abs( d_col ))
+	{
+		d_major = abs( d_page );
+		d_minor = abs( d_col );
+		i = (( page - p_s -> page ) * (( d_page < 0 ) ? ( -1 ) : ( 1 )));
+		minor = col;
+	}
+	else
+	{
+		d_major = abs( d_col );
+		d_minor = abs( d_page );
+		i = (( col - p_s -> col ) * (( d_col < 0 ) ? ( -1 ) : ( 1 )));
+		minor = page;
+	}
+
+	if (( i >= 0 ) && ( i <= d_major ))
+	{
+		k = (( 0 == d_major ) ? ( 0 ) : (((( 2 * i * d_minor ) + d_major - 1 ) / ( 2 * d_major ))));
+
+		if ( abs( d_page ) >= abs( d_col ))
+		{
+			is_on = ( minor == ( p_s -> col + (( d_col < 0 ) ? ( -k ) : ( k ))));
+		}
+		else
+		{
+			is_on = ( minor == ( p_s -> page + (( d_page < 0 ) ? ( -k ) : ( k ))));
+		}
+	}
+
+	return is_on;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Count pixels differing from reference
+*
+*	Bounding box of points with one pixel border is checked.
+*
+*	param: 		p_points - Pointer to points of polyline
+*	param: 		num - Number of points, at least two
+*	return:		Number of wrong pixels
+*/
+//////////////////////////////////////////////////////////////
+static uint32_t test_line_check(const ili9488_point_t * const p_points, const uint32_t num)
+{
+	ili9488_rgb_t rgb;
+	const int32_t width = ili9488_get_width();
+	const int32_t height = ili9488_get_height();
+	int32_t page_s = width;
+	int32_t page_e = 0;
+	int32_t col_s = height;
+	int32_t col_e = 0;
+	int32_t page;
+	int32_t col;
+	uint32_t wrong = 0;
+	uint32_t i;
+	bool is_on;
+
+	for ( i = 0; i < num; i++ )
+	{
+		page_s = (( p_points[i].page < page_s ) ? ( p_points[i].page ) : ( page_s ));
+		page_e = (( p_points[i].page > page_e ) ? ( p_points[i].page ) : ( page_e ));
+		col_s = (( p_points[i].col < col_s ) ? ( p_points[i].col ) : ( col_s ));
+		col_e = (( p_points[i].col > col_e ) ? ( p_points[i].col ) : ( col_e ));
+	}
+
+	for ( page = (( page_s > 0 ) ? ( page_s - 1 ) : ( 0 )); page <= (( page_e < ( width - 1 )) ? ( page_e + 1 ) : ( page_e )); page++ )
+	{
+		for ( col = (( col_s > 0 ) ? ( col_s - 1 ) : ( 0 )); col <= (( col_e < ( height - 1 )) ? ( col_e + 1 ) : ( col_e )); col++ )
+		{
+			is_on = false;
+
+			for ( i = 1; i < num; i++ )
+			{
+				is_on |= test_line_is_on( &p_points[ i - 1U ], &p_points[i], page, col );
+			}
+
+			ili9488_test_get_pixel( page, col, &rgb );
+
+			wrong += (( is_on != ( 0U != rgb.G )) ? ( 1U ) : ( 0U ));
+		}
+	}
+
+	return wrong;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check lines
+*
+*	Every run takes one window and memory write, and run
+*	ends with every step on shorter axis.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_line_lines(void)
+{
+	const test_line_t * p_line;
+	ili9488_window_stats_t win;
+	ili9488_emu_stats_t stats;
+	ili9488_point_t points[2];
+	uint32_t pixels;
+	uint32_t runs;
+	uint32_t wrong;
+	uint32_t i;
+
+	for ( i = 0; i < TEST_LINE_NUM; i++ )
+	{
+		p_line = &g_line[i];
+
+		if ( abs((int32_t) p_line -> e.page - p_line -> s.page ) >= abs((int32_t) p_line -> e.col - p_line -> s.col ))
+		{
+			pixels = ( abs((int32_t) p_line -> e.page - p_line -> s.page ) + 1U );
+			runs = ( abs((int32_t) p_line -> e.col - p_line -> s.col ) + 1U );
+		}
+		else
+		{
+			pixels = ( abs((int32_t) p_line -> e.col - p_line -> s.col ) + 1U );
+			runs = ( abs((int32_t) p_line -> e.page - p_line -> s.page ) + 1U );
+		}
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+		ili9488_test_measure( &stats );
+		ili9488_reset_window_stats();
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_line( p_line -> s.page, p_line -> s.col, p_line -> e.page, p_line -> e.col, ILI9488_COLOR_GREEN ), "%s: draw", p_line -> p_name );
+		ili9488_test_measure( &stats );
+		ili9488_get_window_stats( &win );
+
+		ILI9488_TEST_CHECK( stats.pixels == pixels, "%s: %u pixels, expected %u", p_line -> p_name, stats.pixels, pixels );
+		ILI9488_TEST_CHECK( stats.mem_writes == runs, "%s: %u memory writes, expected %u", p_line -> p_name, stats.mem_writes, runs );
+		ILI9488_TEST_CHECK(( win.hits + win.misses ) == ( 2U * runs ), "%s: %u windows, expected %u", p_line -> p_name, (( win.hits + win.misses ) / 2U ), runs );
+
+		points[0] = p_line -> s;
+		points[1] = p_line -> e;
+
+		wrong = test_line_check( points, 2U );
+		ILI9488_TEST_CHECK( 0U == wrong, "%s: %u pixels differ from reference", p_line -> p_name, wrong );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check polyline
+*
+*	Every segment but first leaves out its start point, as
+*	it was written as end of previous segment.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_line_polyline(void)
+{
+	ili9488_emu_stats_t stats;
+	uint32_t pixels = 0;
+	uint32_t wrong;
+	uint32_t i;
+	int32_t d_page;
+	int32_t d_col;
+
+	for ( i = 1; i < TEST_LINE_POLY_NUM; i++ )
+	{
+		d_page = abs((int32_t) g_polyline[i].page - g_polyline[ i - 1U ].page );
+		d_col = abs((int32_t) g_polyline[i].col - g_polyline[ i - 1U ].col );
+
+		pixels += ((( d_page > d_col ) ? ( d_page ) : ( d_col )) + 1U );
+	}
+
+	// Shared points
+	pixels -= ( TEST_LINE_POLY_NUM - 2U );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_draw_polyline( g_polyline, TEST_LINE_POLY_NUM, ILI9488_COLOR_GREEN ), "polyline" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( stats.pixels == pixels, "polyline: %u pixels, expected %u", stats.pixels, pixels );
+
+	// Horizontal and vertical segments take single write. Sloped
+	// one has 31 runs, first of them only its left out start point.
+	ILI9488_TEST_CHECK( stats.mem_writes == ( 1U + 1U + 30U + 1U ), "polyline: %u memory writes", stats.mem_writes );
+
+	wrong = test_line_check( g_polyline, TEST_LINE_POLY_NUM );
+	ILI9488_TEST_CHECK( 0U == wrong, "polyline: %u pixels differ from reference", wrong );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	ili9488_test_init( async );
+
+	test_line_lines();
+	test_line_polyline();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
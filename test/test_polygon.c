@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Polygon fill against point in polygon reference. Every
+//	display pixel is inside when its center is, counted by
+//	edges crossed on the way to column 0, for even-odd and
+//	non-zero fill rule. Test polygons intersect themselves,
+//	so both rules give different result.
+//
+//	Every span of polygon must be single memory write. With
+//	blocking transport, spans filled per second are
+//	reported, without emulator.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+
+#include <stdio.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Most points of test polygon
+#define TEST_POLYGON_POINT_NUM			( 8U )
+
+// Minimum time of throughput measure
+#define TEST_POLYGON_MEASURE_NS			( 200000000ULL )
+
+// Test polygon
+typedef struct
+{
+	const char *	p_name;
+	uint32_t		num;
+	bool			is_rule_diff;	// Rules fill different pixels
+	ili9488_point_t	point[ TEST_POLYGON_POINT_NUM ];
+} test_polygon_t;
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// Test polygons
+static const test_polygon_t g_polygon[] =
+{
+	// Pentagram, center is wound twice
+	{ "star", 5U, true, {{ 120, 20 }, { 190, 300 }, { 10, 120 }, { 230, 120 }, { 50, 300 }}},
+
+	// Bow tie, halves wound in opposite directions
+	{ "bow tie", 4U, false, {{ 250, 20 }, { 470, 300 }, { 470, 20 }, { 250, 300 }}},
+
+	// Square inside square, both wound in same direction
+	{ "spiral", 8U, true, {{ 260, 20 }, { 460, 20 }, { 460, 300 }, { 260, 300 }, { 310, 80 }, { 410, 80 }, { 410, 240 }, { 310, 240 }}},
+
+	// Points on far edge of display, edges along pages
+	{ "edge", 6U, false, {{ 0, 0 }, { 480, 0 }, { 480, 320 }, { 300, 320 }, { 300, 100 }, { 0, 100 }}},
+};
+
+// Number of test polygons
+#define TEST_POLYGON_NUM				( sizeof( g_polygon ) / sizeof( test_polygon_t ))
+
+// Fill rules
+static const ili9488_fill_rule_t g_rule[2] = { eILI9488_FILL_EVEN_ODD, eILI9488_FILL_NON_ZERO };
+static const char * const gp_rule_name[2] = { "even-odd", "non-zero" };
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Reference point in polygon
+*
+*	Edge is crossed when it is on page of pixel center and
+*	on or left of pixel center, both in halves of pixel.
+*
+*	param: 		p_polygon - Pointer to polygon
+*	param: 		rule - Fill rule
+*	param: 		page - Page of pixel
+*	param: 		col - Column of pixel
+*	return:		true when pixel is inside
+*/
+//////////////////////////////////////////////////////////////
+static bool test_polygon_is_inside(const test_polygon_t * const p_polygon, const ili9488_fill_rule_t rule, const int32_t page, const int32_t col)
+{
+	const ili9488_point_t * p_a;
+	const ili9488_point_t * p_b;
+	int32_t winding = 0;
+	int32_t crossings = 0;
+	int32_t dir;
+	int32_t d_page;
+	uint32_t i;
+
+	for ( i = 0; i < p_polygon -> num; i++ )
+	{
+		p_a = &p_polygon -> point[i];
+		p_b = &p_polygon -> point[ ( i + 1U ) % p_polygon -> num ];
+		dir = 1;
+
+		if ( p_b -> page < p_a -> page )
+		{
+			p_a = p_b;
+			p_b = &p_polygon -> point[i];
+			dir = -1;
+		}
+
+		d_page = ((int32_t) p_b -> page - p_a -> page );
+
+		if 	(	( page >= p_a -> page ) && ( page < p_b -> page )
+			&&	((( 2 * d_page * p_a -> col ) + (((int32_t) p_b -> col - p_a -> col ) * (( 2 * ( page - p_a -> page )) + 1 ))) <= ( d_page * (( 2 * col ) + 1 ))))
+		{
+			winding += dir;
+			crossings++;
+		}
+	}
+
+	return (( eILI9488_FILL_NON_ZERO == rule ) ? ( 0 != winding ) : ( 0 != ( crossings % 2 )));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check polygon against reference
+*
+*	Whole display is checked. Spans are counted as runs of
+*	inside pixels of page.
+*
+*	param: 		p_polygon - Pointer to polygon
+*	param: 		r - Fill rule index
+*	param: 		p_spans - Number of spans of polygon
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_polygon_check(const test_polygon_t * const p_polygon, const uint32_t r, uint32_t * const p_spans)
+{
+	const uint16_t width = ili9488_get_width();
+	const uint16_t height = ili9488_get_height();
+	ili9488_emu_stats_t stats;
+	ili9488_rgb_t rgb;
+	uint32_t num = 0;
+	uint32_t inside = 0;
+	uint32_t spans = 0;
+	uint16_t page;
+	uint16_t col;
+	bool is_inside;
+	bool is_filled;
+	bool was_inside;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_fill_polygon( p_polygon -> point, p_polygon -> num, g_rule[r], ILI9488_COLOR_WHITE ), "%s %s: fill", p_polygon -> p_name, gp_rule_name[r] );
+	ili9488_test_measure( &stats );
+
+	for ( page = 0; page < width; page++ )
+	{
+		was_inside = false;
+
+		for ( col = 0; col < height; col++ )
+		{
+			is_inside = test_polygon_is_inside( p_polygon, g_rule[r], page, col );
+
+			ili9488_test_get_pixel( page, col, &rgb );
+			is_filled = ( 0U != rgb.R );
+
+			num += (( is_inside != is_filled ) ? ( 1U ) : ( 0U ));
+			inside += (( true == is_inside ) ? ( 1U ) : ( 0U ));
+			spans += ((( true == is_inside ) && ( false == was_inside )) ? ( 1U ) : ( 0U ));
+			was_inside = is_inside;
+		}
+	}
+
+	ILI9488_TEST_CHECK( 0U == num, "%s %s: %u pixels differ from reference", p_polygon -> p_name, gp_rule_name[r], num );
+
+	// 3-bit pixels are sent two per byte, odd span pads one pixel
+	#if ( ILI9488_PIXEL_FORMAT_3_BIT_EN )
+		ILI9488_TEST_CHECK(( stats.pixels >= inside ) && ( stats.pixels <= ( inside + spans )), "%s %s: %u pixels sent, %u inside", p_polygon -> p_name, gp_rule_name[r], stats.pixels, inside );
+	#else
+		ILI9488_TEST_CHECK( stats.pixels == inside, "%s %s: %u pixels sent, %u inside", p_polygon -> p_name, gp_rule_name[r], stats.pixels, inside );
+	#endif
+
+	ILI9488_TEST_CHECK( stats.mem_writes == spans, "%s %s: %u memory writes, %u spans", p_polygon -> p_name, gp_rule_name[r], stats.mem_writes, spans );
+
+	*p_spans += spans;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check every polygon with both rules
+*
+*	Rules must differ where polygon is wound twice.
+*
+*	param: 		p_spans - Number of spans of all polygons
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_polygon_reference(uint32_t * const p_spans)
+{
+	uint32_t diff;
+	uint32_t i;
+	uint32_t r;
+	uint16_t page;
+	uint16_t col;
+
+	*p_spans = 0;
+
+	for ( i = 0; i < TEST_POLYGON_NUM; i++ )
+	{
+		diff = 0;
+
+		for ( r = 0; r < 2U; r++ )
+		{
+			test_polygon_check( &g_polygon[i], r, p_spans );
+		}
+
+		for ( page = 0; page < ili9488_get_width(); page++ )
+		{
+			for ( col = 0; col < ili9488_get_height(); col++ )
+			{
+				diff += (( test_polygon_is_inside( &g_polygon[i], eILI9488_FILL_EVEN_ODD, page, col ) != test_polygon_is_inside( &g_polygon[i], eILI9488_FILL_NON_ZERO, page, col )) ? ( 1U ) : ( 0U ));
+			}
+		}
+
+		printf( "  %-8s %6u pixels differ between rules\n", g_polygon[i].p_name, diff );
+		ILI9488_TEST_CHECK( g_polygon[i].is_rule_diff == ( 0U != diff ), "%s: %u pixels differ between rules", g_polygon[i].p_name, diff );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Report spans filled per second
+*
+*	All test polygons are filled with both rules, to
+*	transport which drops data.
+*
+*	param: 		spans - Number of spans of test scene
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_polygon_throughput(const uint32_t spans)
+{
+	uint64_t start;
+	uint64_t time;
+	uint32_t num = 0;
+	uint32_t i;
+	uint32_t r;
+
+	ili9488_test_drop( true );
+	start = ili9488_test_time_ns();
+
+	do
+	{
+		for ( i = 0; i < TEST_POLYGON_NUM; i++ )
+		{
+			for ( r = 0; r < 2U; r++ )
+			{
+				(void) ili9488_fill_polygon( g_polygon[i].point, g_polygon[i].num, g_rule[r], ILI9488_COLOR_WHITE );
+			}
+		}
+
+		num++;
+		time = ( ili9488_test_time_ns() - start );
+	}
+	while ( time < TEST_POLYGON_MEASURE_NS );
+
+	ili9488_test_drop( false );
+
+	printf( "  scene of %u spans: %.1f us, %.0f spans/s\n", spans, (( (double) time / 1000.0 ) / (double) num ), ((( (double) num * spans ) * 1e9 ) / (double) time ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	uint32_t spans;
+
+	ili9488_test_init( async );
+
+	test_polygon_reference( &spans );
+
+	// Throughput is reported once, with blocking transport
+	if ( false == async )
+	{
+		test_polygon_throughput( spans );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	Region tracker of frame renderer, called directly.
+//	Adjacent and mostly overlapping rectangles must merge,
+//	far apart ones must stay separate, and rectangle added
+//	to full table must be merged with region adding least
+//	pixels. Saved and overdrawn pixels are checked per
+//	frame, and against pixels sent by frame renderer.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_region.h"
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Pixels of display
+#define TEST_REGION_DISPLAY				( 480U * 320U )
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Add area to tracker
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Width of area
+*	param: 		col_size - Height of area
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_add(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
+{
+	const ili9488_region_t area = { page, col, page_size, col_size };
+
+	ili9488_region_add( &area );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Find region in tracker
+*
+*	Order of regions is not kept, so whole table is searched.
+*
+*	param: 		page - Start page
+*	param: 		col - Start column
+*	param: 		page_size - Width of region
+*	param: 		col_size - Height of region
+*	return:		true if region is tracked
+*/
+//////////////////////////////////////////////////////////////
+static bool test_region_find(const uint16_t page, const uint16_t col, const uint16_t page_size, const uint16_t col_size)
+{
+	const ili9488_region_t * p_region;
+	bool is_found = false;
+	uint32_t i;
+
+	for ( i = 0; i < ili9488_region_get_num(); i++ )
+	{
+		p_region = ili9488_region_get( i );
+
+		if 	(	( page == p_region -> page ) && ( col == p_region -> col )
+			&&	( page_size == p_region -> page_size ) && ( col_size == p_region -> col_size ))
+		{
+			is_found = true;
+		}
+	}
+
+	return is_found;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			End frame and check its statistics
+*
+*	param: 		p_name - Name of case
+*	param: 		rects - Expected invalidated rectangles
+*	param: 		merges - Expected merges
+*	param: 		pixels - Expected redrawn pixels
+*	param: 		overdraw - Expected pixels redrawn, but not invalidated
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_end(const char * const p_name, const uint32_t rects, const uint32_t merges, const uint32_t pixels, const uint32_t overdraw)
+{
+	ili9488_region_stats_t stats;
+	const uint32_t regions = ili9488_region_get_num();
+
+	ili9488_region_end_frame( TEST_REGION_DISPLAY );
+	ili9488_region_get_stats( &stats );
+
+	ILI9488_TEST_CHECK(( 1U == stats.frames ) && ( rects == stats.rects ) && ( merges == stats.merges ) && ( regions == stats.regions ), "%s: %u frames, %u rects, %u merges, %u regions", p_name, stats.frames, stats.rects, stats.merges, stats.regions );
+	ILI9488_TEST_CHECK(( pixels == stats.pixels ) && ( pixels == stats.last_pixels ), "%s: %u pixels redrawn, expected %u", p_name, stats.pixels, pixels );
+	ILI9488_TEST_CHECK( overdraw == stats.overdraw, "%s: %u pixels overdrawn, expected %u", p_name, stats.overdraw, overdraw );
+	ILI9488_TEST_CHECK((( TEST_REGION_DISPLAY - pixels ) == stats.saved ) && ( stats.saved == stats.last_saved ), "%s: %u pixels saved", p_name, stats.saved );
+
+	ili9488_region_clear();
+	ili9488_region_reset_stats();
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check merging of two rectangles
+*
+*	Merge costs ILI9488_RENDER_AREA_COST of 64 pixels less,
+*	so two 20x20 rectangles merge when their bounding area
+*	has at most 864 pixels.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_pairs(void)
+{
+	ili9488_region_clear();
+	ili9488_region_reset_stats();
+
+	// Adjacent
+	test_region_add( 10U, 10U, 20U, 20U );
+	test_region_add( 30U, 10U, 20U, 20U );
+	ILI9488_TEST_CHECK(( 1U == ili9488_region_get_num()) && test_region_find( 10U, 10U, 40U, 20U ), "adjacent: %u regions", ili9488_region_get_num());
+	test_region_end( "adjacent", 2U, 1U, 800U, 0U );
+
+	// Overlapping, bounding area of 625 pixels
+	test_region_add( 10U, 10U, 20U, 20U );
+	test_region_add( 15U, 15U, 20U, 20U );
+	ILI9488_TEST_CHECK(( 1U == ili9488_region_get_num()) && test_region_find( 10U, 10U, 25U, 25U ), "overlapping: %u regions", ili9488_region_get_num());
+	test_region_end( "overlapping", 2U, 1U, 625U, 0U );
+
+	// Overlapping, bounding area of 900 pixels costs more
+	test_region_add( 10U, 10U, 20U, 20U );
+	test_region_add( 20U, 20U, 20U, 20U );
+	ILI9488_TEST_CHECK(( 2U == ili9488_region_get_num()) && test_region_find( 10U, 10U, 20U, 20U ) && test_region_find( 20U, 20U, 20U, 20U ), "barely overlapping: %u regions", ili9488_region_get_num());
+	test_region_end( "barely overlapping", 2U, 0U, 800U, 0U );
+
+	// Inside of other
+	test_region_add( 10U, 10U, 20U, 20U );
+	test_region_add( 12U, 12U, 2U, 2U );
+	ILI9488_TEST_CHECK(( 1U == ili9488_region_get_num()) && test_region_find( 10U, 10U, 20U, 20U ), "inside: %u regions", ili9488_region_get_num());
+	test_region_end( "inside", 2U, 1U, 400U, 0U );
+
+	// Far apart
+	test_region_add( 0U, 0U, 10U, 10U );
+	test_region_add( 400U, 300U, 10U, 10U );
+	ILI9488_TEST_CHECK(( 2U == ili9488_region_get_num()) && test_region_find( 0U, 0U, 10U, 10U ) && test_region_find( 400U, 300U, 10U, 10U ), "far apart: %u regions", ili9488_region_get_num());
+	test_region_end( "far apart", 2U, 0U, 200U, 0U );
+
+	// Third rectangle bridges first two, bounding area merges again
+	test_region_add( 0U, 0U, 10U, 10U );
+	test_region_add( 100U, 0U, 10U, 10U );
+	test_region_add( 10U, 0U, 90U, 10U );
+	ILI9488_TEST_CHECK(( 1U == ili9488_region_get_num()) && test_region_find( 0U, 0U, 110U, 10U ), "bridge: %u regions", ili9488_region_get_num());
+	test_region_end( "bridge", 3U, 2U, 1100U, 0U );
+
+	// Empty rectangle is ignored
+	test_region_add( 10U, 10U, 0U, 20U );
+	ILI9488_TEST_CHECK( 0U == ili9488_region_get_num(), "empty: %u regions", ili9488_region_get_num());
+	test_region_end( "empty", 0U, 0U, 0U, 0U );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check full table
+*
+*	ILI9488_RENDER_DIRTY_NUM single pixels on diagonal are
+*	too far apart to merge. One more pixel, 10 pages and
+*	columns from the last one, must be merged with it, as
+*	that adds fewest pixels.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_full(void)
+{
+	const uint16_t last = ( ILI9488_RENDER_DIRTY_NUM - 1U );
+	uint32_t i;
+
+	ili9488_region_clear();
+	ili9488_region_reset_stats();
+
+	for ( i = 0; i < ILI9488_RENDER_DIRTY_NUM; i++ )
+	{
+		test_region_add(( i * 28U ), ( i * 18U ), 1U, 1U );
+	}
+
+	ILI9488_TEST_CHECK( ILI9488_RENDER_DIRTY_NUM == ili9488_region_get_num(), "full: %u regions", ili9488_region_get_num());
+
+	test_region_add((( last * 28U ) + 10U ), (( last * 18U ) + 10U ), 1U, 1U );
+
+	ILI9488_TEST_CHECK( ILI9488_RENDER_DIRTY_NUM == ili9488_region_get_num(), "forced merge: %u regions", ili9488_region_get_num());
+	ILI9488_TEST_CHECK( test_region_find(( last * 28U ), ( last * 18U ), 11U, 11U ), "forced merge: not merged with nearest region" );
+	ILI9488_TEST_CHECK( test_region_find((( last - 1U ) * 28U ), (( last - 1U ) * 18U ), 1U, 1U ), "forced merge: other region changed" );
+
+	// 121 pixels redrawn instead of 2
+	test_region_end( "forced merge", ( ILI9488_RENDER_DIRTY_NUM + 1U ), 1U, ( ILI9488_RENDER_DIRTY_NUM - 1U + 121U ), 119U );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check statistics over frames
+*
+*	Statistics accumulate, last frame ones are replaced.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_frames(void)
+{
+	ili9488_region_stats_t stats;
+
+	ili9488_region_clear();
+	ili9488_region_reset_stats();
+
+	test_region_add( 0U, 0U, 10U, 10U );
+	test_region_add( 400U, 300U, 10U, 10U );
+	ili9488_region_end_frame( TEST_REGION_DISPLAY );
+	ili9488_region_clear();
+
+	test_region_add( 0U, 0U, 480U, 320U );
+	ili9488_region_end_frame( TEST_REGION_DISPLAY );
+	ili9488_region_clear();
+
+	ili9488_region_get_stats( &stats );
+
+	ILI9488_TEST_CHECK(( 2U == stats.frames ) && ( 3U == stats.rects ) && ( 3U == stats.regions ), "frames: %u frames, %u rects, %u regions", stats.frames, stats.rects, stats.regions );
+	ILI9488_TEST_CHECK(( 200U + TEST_REGION_DISPLAY ) == stats.pixels, "frames: %u pixels", stats.pixels );
+	ILI9488_TEST_CHECK((( TEST_REGION_DISPLAY - 200U ) == stats.saved ) && ( 0U == stats.last_saved ) && ( TEST_REGION_DISPLAY == stats.last_pixels ), "frames: %u saved, %u in last frame", stats.saved, stats.last_saved );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check statistics of rendered frame
+*
+*	Renderer must send exactly pixels of tracked regions.
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_region_render(void)
+{
+	ili9488_region_stats_t region;
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLUE ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+	ili9488_reset_region_stats();
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLUE ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_invalidate( 10U, 10U, 20U, 20U ), "invalidate" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_invalidate( 15U, 15U, 20U, 20U ), "invalidate" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_invalidate( 400U, 300U, 10U, 10U ), "invalidate" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+	ili9488_test_measure( &stats );
+	ili9488_get_region_stats( &region );
+
+	ILI9488_TEST_CHECK(( 1U == region.frames ) && ( 3U == region.rects ) && ( 1U == region.merges ) && ( 2U == region.regions ), "render: %u frames, %u rects, %u merges, %u regions", region.frames, region.rects, region.merges, region.regions );
+	ILI9488_TEST_CHECK(( 725U == region.last_pixels ) && (( TEST_REGION_DISPLAY - 725U ) == region.last_saved ), "render: %u pixels redrawn, %u saved", region.last_pixels, region.last_saved );
+	ILI9488_TEST_CHECK( stats.pixels == region.last_pixels, "render: %u pixels sent, %u tracked", stats.pixels, region.last_pixels );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+
+	test_region_pairs();
+	test_region_full();
+	test_region_frames();
+
+	ili9488_test_init( async );
+
+	test_region_render();
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
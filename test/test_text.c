@@ -0,0 +1,385 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//	String drawing cost. Glyphs must be streamed through
+//	single address window and single memory write, with
+//	every pixel sent once.
+//
+//	Terminal printf past the last line must scroll display
+//	with scrolling registers, at the cost of one text strip,
+//	one cleared line and one register write per line, and
+//	show the same frame as last lines drawn without scroll.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include "ili9488_test.h"
+#include "ili9488_config.h"
+#include "ili9488_font.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Test string
+#define TEST_TEXT_STRING				( "0123456789" )
+
+// Transfers of string besides pixel bursts
+// (address window and memory write command)
+#define TEST_TEXT_OVERHEAD				( 8U )
+
+// Bytes of string besides pixels
+#define TEST_TEXT_OVERHEAD_BYTES		( 16U )
+
+// Terminal lines printed past the last line of display
+#define TEST_TEXT_EXTRA_LINES			( 5U )
+
+// Terminal line text, fixed width
+#define TEST_TEXT_LINE					"line %03u"
+#define TEST_TEXT_LINE_CHARS			( 8U )
+
+// Directory of terminal frame dumps
+#define TEST_TEXT_DUMP_DIR				"build/"
+
+// Size of frame dump
+#define TEST_TEXT_PPM_SIZE				( ILI9488_EMU_WIDTH * ILI9488_EMU_HEIGHT * 3U )
+
+
+//////////////////////////////////////////////////////////////
+//	VARIABLES
+//////////////////////////////////////////////////////////////
+
+// String and separate characters result
+static ili9488_test_gram_t g_string;
+static ili9488_test_gram_t g_chars;
+
+// Terminal and reference frame dumps
+static uint8_t gu8_terminal_ppm[ TEST_TEXT_PPM_SIZE ];
+static uint8_t gu8_reference_ppm[ TEST_TEXT_PPM_SIZE ];
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check cost of string
+*
+*	param: 		font_opt - Font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_text_cost(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t num = strlen( TEST_TEXT_STRING );
+	const uint32_t size = ( num * ili9488_font_get_width( font_opt ) * ili9488_font_get_height( font_opt ));
+	ili9488_emu_stats_t stats;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_WHITE, ILI9488_COLOR_BLUE, font_opt ), "string pen" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( TEST_TEXT_STRING, 10U, 10U ), "string" );
+	ili9488_test_measure( &stats );
+
+	ILI9488_TEST_CHECK( stats.pixels == size, "font %u: %u pixels", font_opt, stats.pixels );
+	ILI9488_TEST_CHECK( stats.mem_writes == 1U, "font %u: %u memory writes", font_opt, stats.mem_writes );
+	ILI9488_TEST_CHECK( stats.bytes <= (( 3U * size ) + TEST_TEXT_OVERHEAD_BYTES ), "font %u: %u bytes", font_opt, stats.bytes );
+	ILI9488_TEST_CHECK( stats.transfers <= ((( size + ILI9488_GRAM_BUF_SIZE_PX - 1U ) / ILI9488_GRAM_BUF_SIZE_PX ) + TEST_TEXT_OVERHEAD ), "font %u: %u transfers", font_opt, stats.transfers );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check string against separate characters
+*
+*	param: 		font_opt - Font
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_text_chars(const ili9488_font_opt_t font_opt)
+{
+	const uint32_t num = strlen( TEST_TEXT_STRING );
+	char ch[2] = { 0 };
+	uint8_t max_diff;
+	uint32_t diff;
+	uint32_t i;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_RED, font_opt ), "string pen" );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( TEST_TEXT_STRING, 10U, 10U ), "string" );
+	ili9488_test_snapshot( &g_string );
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+
+	for ( i = 0; i < num; i++ )
+	{
+		ch[0] = TEST_TEXT_STRING[i];
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( ch, ( 10U + ( i * ili9488_font_get_width( font_opt ))), 10U ), "char" );
+	}
+
+	ili9488_test_snapshot( &g_chars );
+
+	diff = ili9488_test_compare( &g_string, &g_chars, 0U, &max_diff );
+	ILI9488_TEST_CHECK( 0U == diff, "font %u: %u pixels differ, up to %u", font_opt, diff, max_diff );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Dump displayed frame and read it back
+*
+*	param: 		p_file - Path to file
+*	param: 		p_ppm - Pointer to frame pixels
+*	return:		true when frame is read
+*/
+//////////////////////////////////////////////////////////////
+static bool test_text_dump(const char * const p_file, uint8_t * const p_ppm)
+{
+	bool is_read = false;
+	unsigned width = 0;
+	unsigned height = 0;
+	FILE * p_f;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_wait(), "wait" );
+
+	if ( eILI9488_OK == ili9488_emu_dump_ppm( p_file ))
+	{
+		p_f = fopen( p_file, "rb" );
+
+		if ( NULL != p_f )
+		{
+			is_read = 	(	( 2 == fscanf( p_f, "P6 %u %u 255", &width, &height ))
+						&&	( ILI9488_EMU_WIDTH == width )
+						&&	( ILI9488_EMU_HEIGHT == height )
+						&&	( EOF != fgetc( p_f ))
+						&&	( 1U == fread( p_ppm, TEST_TEXT_PPM_SIZE, 1U, p_f )));
+
+			fclose( p_f );
+		}
+	}
+
+	return is_read;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Check scrolling terminal
+*
+*	Lines are printed one by one, past the last line of
+*	display. New line after line printed on last line
+*	scrolls display, so last line is the one that came in
+*	last and stays empty.
+*
+*	param: 		orientation - Portrait orientation
+*	param: 		font_opt - Font
+*	param: 		async - Non-blocking transport
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void test_text_terminal(const ili9488_orientation_t orientation, const ili9488_font_opt_t font_opt, const bool async)
+{
+	const uint16_t line = ili9488_font_get_height( font_opt );
+	const uint32_t strip = ( TEST_TEXT_LINE_CHARS * ili9488_font_get_width( font_opt ) * line );
+	ili9488_emu_scroll_t scroll;
+	ili9488_emu_stats_t stats;
+	char file[2][64];
+	char str[16];
+	uint16_t size;
+	uint16_t lines;
+	uint16_t offset;
+	uint16_t tfa;
+	uint16_t vsp;
+	uint32_t num;
+	uint32_t scrolls = 0;
+	uint32_t i;
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( orientation ), "orientation" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_WHITE, ILI9488_COLOR_BLACK, font_opt ), "string pen" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_terminal( true ), "terminal" );
+
+	size = (( ili9488_get_height() / line ) * line );
+	lines = ( size / line );
+	num = ( lines + TEST_TEXT_EXTRA_LINES );
+
+	ili9488_test_measure( &stats );
+
+	for ( i = 0; i < num; i++ )
+	{
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_printf( TEST_TEXT_LINE "\n", i ), "terminal printf" );
+		ili9488_test_measure( &stats );
+
+		// Line scrolls display, once display is full
+		if (( i + 1U ) >= lines )
+		{
+			scrolls++;
+
+			ILI9488_TEST_CHECK( stats.mem_writes == 2U, "terminal line %u: %u memory writes", i, stats.mem_writes );
+			ILI9488_TEST_CHECK( stats.pixels == ( strip + ( ili9488_get_width() * line )), "terminal line %u: %u pixels", i, stats.pixels );
+			ILI9488_TEST_CHECK(( stats.commands - stats.addr_cmds - stats.mem_writes ) == 1U, "terminal line %u: %u register writes", i, ( stats.commands - stats.addr_cmds - stats.mem_writes ));
+		}
+		else
+		{
+			ILI9488_TEST_CHECK( stats.mem_writes == 1U, "terminal line %u: %u memory writes", i, stats.mem_writes );
+			ILI9488_TEST_CHECK( stats.pixels == strip, "terminal line %u: %u pixels", i, stats.pixels );
+			ILI9488_TEST_CHECK( stats.commands == ( stats.addr_cmds + stats.mem_writes ), "terminal line %u: %u register writes", i, ( stats.commands - stats.addr_cmds - stats.mem_writes ));
+		}
+	}
+
+	ILI9488_TEST_CHECK(( TEST_TEXT_EXTRA_LINES + 1U ) == scrolls, "terminal: %u scrolls", scrolls );
+
+	// Scrolling area starts at frame memory row shown first
+	offset = (( scrolls * line ) % size );
+
+	if 	(	( eILI9488_ORIENTATION_PORTRAIT_FLIP == orientation )
+		||	( eILI9488_ORIENTATION_PORTRAIT_FLIP_MIRROR == orientation ))
+	{
+		tfa = ( ILI9488_EMU_HEIGHT - size );
+		vsp = ( tfa + (( size - offset ) % size ));
+	}
+	else
+	{
+		tfa = 0U;
+		vsp = offset;
+	}
+
+	ili9488_emu_get_scroll( &scroll );
+
+	ILI9488_TEST_CHECK(( tfa == scroll.tfa ) && ( size == scroll.vsa ) && (( ILI9488_EMU_HEIGHT - size - tfa ) == scroll.bfa ), "terminal: VSCRDEF %u %u %u", scroll.tfa, scroll.vsa, scroll.bfa );
+	ILI9488_TEST_CHECK( vsp == scroll.vsp, "terminal: VSCRSADD %u, expected %u", scroll.vsp, vsp );
+
+	(void) snprintf( file[0], sizeof( file[0] ), "%sterminal_%u_%u_%s.ppm", TEST_TEXT_DUMP_DIR, orientation, font_opt, (( true == async ) ? ( "async" ) : ( "sync" )));
+	(void) snprintf( file[1], sizeof( file[1] ), "%sterminal_ref_%u_%u_%s.ppm", TEST_TEXT_DUMP_DIR, orientation, font_opt, (( true == async ) ? ( "async" ) : ( "sync" )));
+
+	ILI9488_TEST_CHECK( true == test_text_dump( file[0], gu8_terminal_ppm ), "dump %s", file[0] );
+
+	// Reference: visible lines drawn without scrolling
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_terminal( false ), "terminal" );
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+
+	for ( i = 0; i < ( lines - 1U ); i++ )
+	{
+		(void) snprintf( str, sizeof( str ), TEST_TEXT_LINE, ( num - ( lines - 1U ) + i ));
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string( str, 0U, ( i * line )), "string" );
+	}
+
+	ili9488_emu_get_scroll( &scroll );
+	ILI9488_TEST_CHECK( scroll.vsp == tfa, "terminal off: VSCRSADD %u", scroll.vsp );
+
+	ILI9488_TEST_CHECK( true == test_text_dump( file[1], gu8_reference_ppm ), "dump %s", file[1] );
+	ILI9488_TEST_CHECK( 0 == memcmp( gu8_terminal_ppm, gu8_reference_ppm, TEST_TEXT_PPM_SIZE ), "terminal orientation %u font %u: %s differs from %s", orientation, font_opt, file[0], file[1] );
+}
+
+
+#if ( ILI9488_RENDER_EN )
+
+	//////////////////////////////////////////////////////////////
+	/*
+	*			Check printf inside frame
+	*
+	*	Recorded printf must give the same result as direct
+	*	one. Terminal can not be used inside frame.
+	*
+	*	param: 		none
+	*	return:		none
+	*/
+	//////////////////////////////////////////////////////////////
+	static void test_text_printf_frame(void)
+	{
+		uint8_t max_diff;
+		uint32_t diff;
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_string_pen( ILI9488_COLOR_YELLOW, ILI9488_COLOR_RED, eILI9488_FONT_16 ), "string pen" );
+
+		// Direct
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_cursor( 10U, 10U ), "cursor" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_printf( "%s\n%d", TEST_TEXT_STRING, 42 ), "printf" );
+		ili9488_test_snapshot( &g_string );
+
+		// Recorded
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLUE ), "background" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_background( ILI9488_COLOR_BLACK ), "background" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_cursor( 10U, 10U ), "cursor" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_printf( "%s\n%d", TEST_TEXT_STRING, 42 ), "printf" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+		ili9488_test_snapshot( &g_chars );
+
+		diff = ili9488_test_compare( &g_string, &g_chars, 0U, &max_diff );
+		ILI9488_TEST_CHECK( 0U == diff, "printf in frame: %u pixels differ, up to %u", diff, max_diff );
+
+		// Terminal
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( eILI9488_ORIENTATION_PORTRAIT ), "orientation" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_terminal( true ), "terminal" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_begin(), "frame begin" );
+		ILI9488_TEST_CHECK( eILI9488_ERROR == ili9488_printf( "%s\n", TEST_TEXT_STRING ), "terminal printf in frame" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_frame_end(), "frame end" );
+		ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_terminal( false ), "terminal" );
+	}
+
+#endif
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments, "async" for non-blocking transport
+*	return:		0 when all checks passed
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+	const bool async = ili9488_test_is_async( argc, argv );
+	const ili9488_orientation_t orientations[] = { eILI9488_ORIENTATION_PORTRAIT, eILI9488_ORIENTATION_PORTRAIT_FLIP, eILI9488_ORIENTATION_PORTRAIT_MIRROR, eILI9488_ORIENTATION_PORTRAIT_FLIP_MIRROR };
+	uint8_t f;
+	uint8_t o;
+
+	ili9488_test_init( async );
+
+	for ( f = eILI9488_FONT_8; f <= eILI9488_FONT_24; f++ )
+	{
+		test_text_cost((ili9488_font_opt_t) f );
+		test_text_chars((ili9488_font_opt_t) f );
+	}
+
+	for ( o = 0; o < ( sizeof( orientations ) / sizeof( orientations[0] )); o++ )
+	{
+		for ( f = eILI9488_FONT_8; f <= eILI9488_FONT_24; f++ )
+		{
+			test_text_terminal( orientations[o], (ili9488_font_opt_t) f, async );
+		}
+	}
+
+	ILI9488_TEST_CHECK( eILI9488_OK == ili9488_set_orientation( eILI9488_ORIENTATION_LANDSCAPE ), "orientation" );
+
+	#if ( ILI9488_RENDER_EN )
+		test_text_printf_frame();
+	#endif
+
+	return ili9488_test_result( argv[0], async );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
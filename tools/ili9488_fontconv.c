@@ -0,0 +1,1265 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+//
+//	Host tool for compiling fonts into compiled font format
+//	of ILI9488 driver. Reads BDF, or TTF/OTF when built with
+//	FreeType, and writes C source with font, e.g.:
+//
+//		gcc -O2 -o ili9488_fontconv ili9488_fontconv.c
+//		./ili9488_fontconv -n g_font_user_0 -b 1 font.bdf font.c
+//
+//		gcc -O2 -DFONTCONV_FREETYPE $(pkg-config --cflags freetype2) -o ili9488_fontconv ili9488_fontconv.c -lfreetype
+//		./ili9488_fontconv -n g_font_user_0 -b 4 -p 32 -k -t "0123456789.-" font.ttf font.c
+//
+//	Glyphs are placed in character cells of largest advance
+//	width and ascent plus descent height, grown to fit glyphs
+//	reaching out of it. Coverage of every cell pixel is
+//	quantized to 1, 2 or 4 bits, only bounding box of glyph
+//	is stored. Glyphs keep their own advance, unless font is
+//	compiled monospaced, and with FreeType kerning pairs of
+//	selected characters can be added. BDF is bitmap font, so
+//	its 2 and 4 bit coverage comes from downsampling, e.g.
+//	BDF of 96 px font with -s 4 gives 24 px font. Glyph data
+//	is decoded back and checked before output is written.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#ifdef FONTCONV_FREETYPE
+	#include <ft2build.h>
+	#include FT_FREETYPE_H
+#endif
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Token codes, see ili9488_font.h
+#define FONTCONV_TOKEN_BG			( 0x00U )
+#define FONTCONV_TOKEN_FG			( 0x40U )
+#define FONTCONV_TOKEN_PIX			( 0x80U )
+
+// Pixels in one token
+#define FONTCONV_TOKEN_MAX			( 64U )
+
+// Number of character codes
+#define FONTCONV_CHAR_NUM			( 256U )
+
+// Glyph data offset limit
+#define FONTCONV_OFFSET_MAX			( 0xFFFFU )
+
+// Size of glyph and kerning pair in font table
+#define FONTCONV_GLYPH_SIZE			( 8U )
+#define FONTCONV_KERN_SIZE			( 3U )
+
+// Glyph data compression
+typedef enum
+{
+	eFONTCONV_AUTO = 0,
+	eFONTCONV_RAW,
+	eFONTCONV_RLE,
+} fontconv_format_t;
+
+// Source glyph
+//
+// NOTE: In source pixels, which are scale times smaller
+// than font pixels.
+typedef struct
+{
+	uint8_t *	p_pix;		// Coverage, 0 - 255, row by row
+	int32_t		width;
+	int32_t		height;
+	int32_t		left;		// Offset from pen position
+	int32_t		top;		// Offset from top of cell
+	int32_t		advance;
+	bool		is_present;
+} fontconv_src_t;
+
+// Source font
+typedef struct
+{
+	fontconv_src_t	glyph[ FONTCONV_CHAR_NUM ];
+	int32_t			kern[ FONTCONV_CHAR_NUM ][ FONTCONV_CHAR_NUM ];	// Added to advance of left character
+	int32_t			ascent;
+	int32_t			descent;
+	bool			has_kern;
+} fontconv_font_t;
+
+// Compiled glyph
+typedef struct
+{
+	uint32_t	offset;
+	uint32_t	width;
+	uint32_t	height;
+	uint32_t	page_ofs;
+	uint32_t	col_ofs;
+	uint32_t	advance;
+} fontconv_glyph_t;
+
+// Compiled kerning pair
+typedef struct
+{
+	uint32_t	left;
+	uint32_t	right;
+	int32_t		offset;
+} fontconv_kern_t;
+
+// Output stream
+typedef struct
+{
+	uint8_t *	p_data;
+	uint32_t	size;
+	uint32_t	shift;		// Bits already used in last byte
+} fontconv_stream_t;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static bool		fontconv_read_bdf		(const char * const p_file, const bool * const p_sel, fontconv_font_t * const p_font);
+static bool		fontconv_read_ft		(const char * const p_file, const uint32_t size, const uint32_t bpp, const bool is_kern, const bool * const p_sel, fontconv_font_t * const p_font);
+static bool		fontconv_parse_ranges	(const char * p_str, bool * const p_sel);
+static void		fontconv_rasterize		(const fontconv_src_t * const p_src, const uint32_t scale, const uint32_t bpp, const uint32_t width, const uint32_t height, uint8_t * const p_level);
+static void		fontconv_encode			(const uint8_t * const p_level, const uint32_t width, const uint32_t height, const uint32_t bpp, const bool is_rle, fontconv_glyph_t * const p_glyph, fontconv_stream_t * const p_out);
+static void		fontconv_put_bits		(fontconv_stream_t * const p_out, const uint32_t value, const uint32_t bpp);
+static void		fontconv_align			(fontconv_stream_t * const p_out);
+static bool		fontconv_decode			(const uint8_t * const p_data, const uint32_t size, const uint32_t bpp, const bool is_rle, const fontconv_glyph_t * const p_glyph, const uint32_t width, const uint32_t height, uint8_t * const p_level);
+static bool		fontconv_write_c		(const char * const p_file, const char * const p_name, const char * const p_src, const uint32_t width, const uint32_t height, const uint32_t bpp, const bool is_rle, const uint32_t first, const uint32_t num, const fontconv_glyph_t * const p_glyph, const fontconv_stream_t * const p_out, const fontconv_kern_t * const p_kern, const uint32_t kern_num);
+static void		fontconv_usage			(void);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments
+*	return:		0 on success
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	static fontconv_font_t font;
+	static fontconv_glyph_t glyph[2][ FONTCONV_CHAR_NUM ];
+	static bool sel[ FONTCONV_CHAR_NUM ];
+	static fontconv_kern_t kern[ FONTCONV_CHAR_NUM * FONTCONV_CHAR_NUM ];
+	fontconv_stream_t out[2];
+	fontconv_format_t format = eFONTCONV_AUTO;
+	const char * p_name = "font";
+	const char * p_ranges = NULL;
+	const char * p_text = NULL;
+	const char * p_ext;
+	uint32_t bpp = 1U;
+	uint32_t scale = 1U;
+	uint32_t size = 0U;
+	uint32_t width;
+	uint32_t height;
+	uint32_t first;
+	uint32_t last;
+	uint32_t kern_num = 0;
+	uint32_t advance;
+	int32_t cell[4];
+	int32_t offset;
+	uint32_t r;
+	uint32_t c;
+	uint8_t * p_level;
+	uint8_t * p_check;
+	bool is_mono = false;
+	bool is_kern = false;
+	bool is_ok;
+	int i;
+
+	for ( i = 1; ( i < argc ) && ( '-' == argv[i][0] ); i++ )
+	{
+		if (( 0 == strcmp( argv[i], "-b" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			bpp = (uint32_t) strtoul( argv[i], NULL, 0 );
+
+			if (( 1U != bpp ) && ( 2U != bpp ) && ( 4U != bpp ))
+			{
+				fontconv_usage();
+				return 1;
+			}
+		}
+		else if (( 0 == strcmp( argv[i], "-s" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			scale = (uint32_t) strtoul( argv[i], NULL, 0 );
+
+			if (( scale < 1U ) || ( scale > 16U ))
+			{
+				fontconv_usage();
+				return 1;
+			}
+		}
+		else if (( 0 == strcmp( argv[i], "-p" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			size = (uint32_t) strtoul( argv[i], NULL, 0 );
+		}
+		else if (( 0 == strcmp( argv[i], "-f" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+
+			if ( 0 == strcmp( argv[i], "raw" ))
+			{
+				format = eFONTCONV_RAW;
+			}
+			else if ( 0 == strcmp( argv[i], "rle" ))
+			{
+				format = eFONTCONV_RLE;
+			}
+			else if ( 0 == strcmp( argv[i], "auto" ))
+			{
+				format = eFONTCONV_AUTO;
+			}
+			else
+			{
+				fontconv_usage();
+				return 1;
+			}
+		}
+		else if (( 0 == strcmp( argv[i], "-r" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			p_ranges = argv[i];
+		}
+		else if (( 0 == strcmp( argv[i], "-t" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			p_text = argv[i];
+		}
+		else if (( 0 == strcmp( argv[i], "-n" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			p_name = argv[i];
+		}
+		else if ( 0 == strcmp( argv[i], "-m" ))
+		{
+			is_mono = true;
+		}
+		else if ( 0 == strcmp( argv[i], "-k" ))
+		{
+			is_kern = true;
+		}
+		else
+		{
+			fontconv_usage();
+			return 1;
+		}
+	}
+
+	if (( i + 2 ) != argc )
+	{
+		fontconv_usage();
+		return 1;
+	}
+
+	// Kerning changes advance, which monospaced font does not have
+	if (( true == is_mono ) && ( true == is_kern ))
+	{
+		fprintf( stderr, "Kerning (-k) is not used with monospaced font (-m)\n" );
+		return 1;
+	}
+
+	// Character subset, printable ASCII by default
+	if ( NULL != p_ranges )
+	{
+		if ( false == fontconv_parse_ranges( p_ranges, sel ))
+		{
+			fontconv_usage();
+			return 1;
+		}
+	}
+
+	if ( NULL != p_text )
+	{
+		for ( c = 0; '\0' != p_text[c]; c++ )
+		{
+			sel[ (uint8_t) p_text[c] ] = true;
+		}
+	}
+
+	if (( NULL == p_ranges ) && ( NULL == p_text ))
+	{
+		fontconv_parse_ranges( "32-126", sel );
+	}
+
+	// Read source
+	p_ext = strrchr( argv[i], '.' );
+
+	if (( NULL != p_ext ) && ( 0 == strcmp( p_ext, ".bdf" )))
+	{
+		is_ok = fontconv_read_bdf( argv[i], sel, &font );
+
+		if (( true == is_ok ) && ( true == is_kern ))
+		{
+			fprintf( stderr, "BDF has no kerning, -k ignored\n" );
+		}
+	}
+	else if ( 0U == size )
+	{
+		fprintf( stderr, "Pixel size (-p) is required for %s\n", argv[i] );
+		is_ok = false;
+	}
+	else
+	{
+		is_ok = fontconv_read_ft( argv[i], ( size * scale ), bpp, is_kern, sel, &font );
+	}
+
+	if ( false == is_ok )
+	{
+		return 1;
+	}
+
+	// Glyph table covers selected characters present in font
+	first = FONTCONV_CHAR_NUM;
+	last = 0;
+
+	// Cell from pen position and top, grown by glyphs reaching out of it
+	cell[0] = 0;
+	cell[1] = 0;
+	cell[2] = 0;
+	cell[3] = ( font.ascent + font.descent );
+
+	for ( c = 0; c < FONTCONV_CHAR_NUM; c++ )
+	{
+		if (( true == sel[c] ) && ( false == font.glyph[c].is_present ))
+		{
+			fprintf( stderr, "Character %u not in font, left blank\n", c );
+		}
+		else if ( true == sel[c] )
+		{
+			first = (( c < first ) ? ( c ) : ( first ));
+			last = c;
+
+			cell[2] = (( font.glyph[c].advance > cell[2] ) ? ( font.glyph[c].advance ) : ( cell[2] ));
+
+			if (( font.glyph[c].width > 0 ) && ( font.glyph[c].height > 0 ))
+			{
+				cell[0] = (( font.glyph[c].left < cell[0] ) ? ( font.glyph[c].left ) : ( cell[0] ));
+				cell[1] = (( font.glyph[c].top < cell[1] ) ? ( font.glyph[c].top ) : ( cell[1] ));
+				cell[2] = ((( font.glyph[c].left + font.glyph[c].width ) > cell[2] ) ? ( font.glyph[c].left + font.glyph[c].width ) : ( cell[2] ));
+				cell[3] = ((( font.glyph[c].top + font.glyph[c].height ) > cell[3] ) ? ( font.glyph[c].top + font.glyph[c].height ) : ( cell[3] ));
+			}
+		}
+		else
+		{
+			// Not selected...
+		}
+	}
+
+	if ( first > last )
+	{
+		fprintf( stderr, "No characters selected\n" );
+		return 1;
+	}
+
+	width = ((uint32_t)( cell[2] - cell[0] ) + scale - 1U ) / scale;
+	height = ((uint32_t)( cell[3] - cell[1] ) + scale - 1U ) / scale;
+
+	for ( c = 0; c < FONTCONV_CHAR_NUM; c++ )
+	{
+		font.glyph[c].left -= cell[0];
+		font.glyph[c].top -= cell[1];
+	}
+
+	if (( 0U == width ) || ( width > 255U ) || ( 0U == height ) || ( height > 255U ))
+	{
+		fprintf( stderr, "Character cell %ux%u out of range\n", width, height );
+		return 1;
+	}
+
+	p_level = malloc( width * height );
+	p_check = malloc( width * height );
+
+	for ( r = 0; r < 2U; r++ )
+	{
+		// Worst case is one token per pixel
+		out[r].p_data = malloc(( last - first + 1U ) * width * height * 2U );
+		out[r].size = 0;
+		out[r].shift = 0;
+	}
+
+	if (( NULL == p_level ) || ( NULL == p_check ) || ( NULL == out[0].p_data ) || ( NULL == out[1].p_data ))
+	{
+		fprintf( stderr, "Out of memory\n" );
+		return 1;
+	}
+
+	// Encode raw and RLE, check both
+	for ( c = first; c <= last; c++ )
+	{
+		memset( p_level, 0, width * height );
+
+		// Font width for missing characters and monospaced font
+		advance = 0;
+
+		if (( false == is_mono ) && ( true == sel[c] ) && ( true == font.glyph[c].is_present ))
+		{
+			advance = (((uint32_t) font.glyph[c].advance + ( scale / 2U )) / scale );
+			advance = (( advance < 1U ) ? ( 1U ) : ( advance ));
+		}
+
+		if (( true == sel[c] ) && ( true == font.glyph[c].is_present ))
+		{
+			fontconv_rasterize( &font.glyph[c], scale, bpp, width, height, p_level );
+		}
+
+		for ( r = 0; r < 2U; r++ )
+		{
+			fontconv_encode( p_level, width, height, bpp, ( 1U == r ), &glyph[r][ c - first ], &out[r] );
+			glyph[r][ c - first ].advance = advance;
+
+			if 	(	( false == fontconv_decode( out[r].p_data, out[r].size, bpp, ( 1U == r ), &glyph[r][ c - first ], width, height, p_check ))
+				||	( 0 != memcmp( p_check, p_level, width * height )))
+			{
+				fprintf( stderr, "Glyph check failed for character %u\n", c );
+				return 1;
+			}
+		}
+	}
+
+	// Kerning pairs of selected characters, sorted
+	for ( c = first; ( c <= last ) && ( true == font.has_kern ); c++ )
+	{
+		for ( r = first; ( r <= last ) && ( true == sel[c] ); r++ )
+		{
+			offset = (( font.kern[c][r] >= 0 ) ? (( font.kern[c][r] + (int32_t)( scale / 2U )) / (int32_t) scale ) : -(( -font.kern[c][r] + (int32_t)( scale / 2U )) / (int32_t) scale ));
+			offset = (( offset < -128 ) ? ( -128 ) : (( offset > 127 ) ? ( 127 ) : ( offset )));
+
+			if (( true == sel[r] ) && ( 0 != offset ))
+			{
+				kern[ kern_num ].left = c;
+				kern[ kern_num ].right = r;
+				kern[ kern_num ].offset = offset;
+				kern_num++;
+			}
+		}
+	}
+
+	// Smaller one by default
+	r = (( eFONTCONV_AUTO == format ) ? (( out[1].size < out[0].size ) ? ( 1U ) : ( 0U )) : (( eFONTCONV_RLE == format ) ? ( 1U ) : ( 0U )));
+
+	if ( glyph[r][ last - first ].offset > FONTCONV_OFFSET_MAX )
+	{
+		fprintf( stderr, "Glyph data of %u B too large, select less characters\n", out[r].size );
+		return 1;
+	}
+
+	if ( false == fontconv_write_c( argv[ i + 1 ], p_name, argv[i], width, height, bpp, ( 1U == r ), first, ( last - first + 1U ), glyph[r], &out[r], kern, kern_num ))
+	{
+		return 1;
+	}
+
+	printf( "%s: %u glyphs, %s cell %ux%u, %u bpp %s, data %u B (raw %u B, RLE %u B) + table %u B, %u kerning pairs\n",
+			p_name, ( last - first + 1U ), (( true == is_mono ) ? ( "monospaced" ) : ( "proportional" )), width, height, bpp, (( 1U == r ) ? ( "RLE" ) : ( "raw" )),
+			out[r].size, out[0].size, out[1].size, ((( last - first + 1U ) * FONTCONV_GLYPH_SIZE ) + ( kern_num * FONTCONV_KERN_SIZE )), kern_num );
+
+	free( p_level );
+	free( p_check );
+	free( out[0].p_data );
+	free( out[1].p_data );
+
+	return 0;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read BDF font
+*
+*	param: 		p_file - Path to font
+*	param: 		p_sel - Selected characters
+*	param: 		p_font - Pointer to source font
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool fontconv_read_bdf(const char * const p_file, const bool * const p_sel, fontconv_font_t * const p_font)
+{
+	FILE * p_f;
+	char line[ 512 ];
+	fontconv_src_t * p_src = NULL;
+	unsigned int hex;
+	int bbx[4];
+	int code = -1;
+	int dwidth = 0;
+	int32_t x;
+	int32_t y = -1;
+	bool is_ok = true;
+
+	p_f = fopen( p_file, "r" );
+
+	if ( NULL == p_f )
+	{
+		fprintf( stderr, "Cannot open %s\n", p_file );
+		return false;
+	}
+
+	p_font -> ascent = -1;
+	p_font -> descent = -1;
+
+	while (( NULL != fgets( line, sizeof( line ), p_f )) && ( true == is_ok ))
+	{
+		// Bitmap rows
+		if (( NULL != p_src ) && ( y >= 0 ) && ( y < p_src -> height ))
+		{
+			for ( x = 0; x < p_src -> width; x++ )
+			{
+				is_ok = ( 1 == sscanf( &line[ ( x / 8 ) * 2 ], "%2x", &hex ));
+
+				if ( true == is_ok )
+				{
+					p_src -> p_pix[ ( y * p_src -> width ) + x ] = (( 0U != ( hex & ( 0x80U >> ( x % 8 )))) ? ( 255U ) : ( 0U ));
+				}
+			}
+
+			y++;
+		}
+		else if ( 1 == sscanf( line, "FONT_ASCENT %d", &bbx[0] ))
+		{
+			p_font -> ascent = bbx[0];
+		}
+		else if ( 1 == sscanf( line, "FONT_DESCENT %d", &bbx[0] ))
+		{
+			p_font -> descent = bbx[0];
+		}
+		else if (( 4 == sscanf( line, "FONTBOUNDINGBOX %d %d %d %d", &bbx[0], &bbx[1], &bbx[2], &bbx[3] )) && ( p_font -> ascent < 0 ))
+		{
+			// Until properties tell otherwise
+			p_font -> ascent = ( bbx[1] + bbx[3] );
+			p_font -> descent = -bbx[3];
+		}
+		else if ( 1 == sscanf( line, "ENCODING %d", &code ))
+		{
+			dwidth = 0;
+		}
+		else if ( 1 == sscanf( line, "DWIDTH %d", &dwidth ))
+		{
+			// Advance width...
+		}
+		else if (( 4 == sscanf( line, "BBX %d %d %d %d", &bbx[0], &bbx[1], &bbx[2], &bbx[3] )) && ( code >= 0 ) && ( code < (int) FONTCONV_CHAR_NUM ) && ( true == p_sel[ code ] ))
+		{
+			p_src = &p_font -> glyph[ code ];
+			p_src -> width = bbx[0];
+			p_src -> height = bbx[1];
+			p_src -> left = bbx[2];
+			p_src -> top = -( bbx[1] + bbx[3] );
+			p_src -> advance = (( dwidth > 0 ) ? ( dwidth ) : ( bbx[0] + bbx[2] ));
+			p_src -> p_pix = calloc((size_t)( bbx[0] * bbx[1] ) + 1U, 1U );
+			p_src -> is_present = ( NULL != p_src -> p_pix );
+			is_ok = p_src -> is_present;
+		}
+		else if ( 0 == strncmp( line, "BITMAP", 6U ))
+		{
+			y = 0;
+		}
+		else if ( 0 == strncmp( line, "ENDCHAR", 7U ))
+		{
+			p_src = NULL;
+			code = -1;
+			y = -1;
+		}
+		else
+		{
+			// Other properties...
+		}
+	}
+
+	fclose( p_f );
+
+	if (( false == is_ok ) || ( p_font -> ascent < 0 ) || ( p_font -> descent < 0 ))
+	{
+		fprintf( stderr, "%s is not valid BDF\n", p_file );
+		is_ok = false;
+	}
+	else
+	{
+		// Top is relative to baseline until now
+		for ( code = 0; code < (int) FONTCONV_CHAR_NUM; code++ )
+		{
+			p_font -> glyph[ code ].top += p_font -> ascent;
+		}
+	}
+
+	return is_ok;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read TTF/OTF font with FreeType
+*
+*	param: 		p_file - Path to font
+*	param: 		size - Pixel size of source
+*	param: 		bpp - Bits per pixel, 1 renders monochrome
+*	param: 		is_kern - Read kerning
+*	param: 		p_sel - Selected characters
+*	param: 		p_font - Pointer to source font
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool fontconv_read_ft(const char * const p_file, const uint32_t size, const uint32_t bpp, const bool is_kern, const bool * const p_sel, fontconv_font_t * const p_font)
+{
+#ifdef FONTCONV_FREETYPE
+	FT_Library lib;
+	FT_Face face;
+	FT_Bitmap * p_bmp;
+	FT_Vector delta;
+	fontconv_src_t * p_src;
+	uint32_t c;
+	uint32_t r;
+	int32_t x;
+	int32_t y;
+	bool is_ok = true;
+
+	if (( 0 != FT_Init_FreeType( &lib )) || ( 0 != FT_New_Face( lib, p_file, 0, &face )))
+	{
+		fprintf( stderr, "Cannot open %s\n", p_file );
+		return false;
+	}
+
+	FT_Set_Pixel_Sizes( face, 0, size );
+
+	p_font -> ascent = (int32_t)(( face -> size -> metrics.ascender + 63 ) / 64 );
+	p_font -> descent = (int32_t)(( -face -> size -> metrics.descender + 63 ) / 64 );
+
+	for ( c = 0; ( c < FONTCONV_CHAR_NUM ) && ( true == is_ok ); c++ )
+	{
+		if (( true == p_sel[c] ) && ( 0U != FT_Get_Char_Index( face, c )))
+		{
+			is_ok = ( 0 == FT_Load_Char( face, c, ( FT_LOAD_RENDER | (( 1U == bpp ) ? ( FT_LOAD_TARGET_MONO ) : ( FT_LOAD_TARGET_NORMAL )))));
+			p_bmp = &face -> glyph -> bitmap;
+			p_src = &p_font -> glyph[c];
+
+			if ( true == is_ok )
+			{
+				p_src -> width = (int32_t) p_bmp -> width;
+				p_src -> height = (int32_t) p_bmp -> rows;
+				p_src -> left = face -> glyph -> bitmap_left;
+				p_src -> top = ( p_font -> ascent - face -> glyph -> bitmap_top );
+				p_src -> advance = (int32_t)(( face -> glyph -> advance.x + 63 ) / 64 );
+				p_src -> p_pix = calloc((size_t)( p_src -> width * p_src -> height ) + 1U, 1U );
+				p_src -> is_present = ( NULL != p_src -> p_pix );
+				is_ok = p_src -> is_present;
+			}
+
+			for ( y = 0; ( y < p_src -> height ) && ( true == is_ok ); y++ )
+			{
+				for ( x = 0; x < p_src -> width; x++ )
+				{
+					if ( FT_PIXEL_MODE_MONO == p_bmp -> pixel_mode )
+					{
+						p_src -> p_pix[ ( y * p_src -> width ) + x ] = (( 0U != ( p_bmp -> buffer[ ( y * p_bmp -> pitch ) + ( x / 8 ) ] & ( 0x80U >> ( x % 8 )))) ? ( 255U ) : ( 0U ));
+					}
+					else
+					{
+						p_src -> p_pix[ ( y * p_src -> width ) + x ] = p_bmp -> buffer[ ( y * p_bmp -> pitch ) + x ];
+					}
+				}
+			}
+		}
+	}
+
+	// Kerning of selected pairs, rounded to pixels of source
+	if (( true == is_ok ) && ( true == is_kern ) && ( false == FT_HAS_KERNING( face )))
+	{
+		fprintf( stderr, "%s has no kerning table, -k ignored\n", p_file );
+	}
+	else if (( true == is_ok ) && ( true == is_kern ))
+	{
+		for ( c = 0; c < FONTCONV_CHAR_NUM; c++ )
+		{
+			for ( r = 0; ( r < FONTCONV_CHAR_NUM ) && ( true == p_sel[c] ); r++ )
+			{
+				if (( true == p_sel[r] ) && ( 0 == FT_Get_Kerning( face, FT_Get_Char_Index( face, c ), FT_Get_Char_Index( face, r ), FT_KERNING_DEFAULT, &delta )))
+				{
+					p_font -> kern[c][r] = (int32_t)(( delta.x >= 0 ) ? (( delta.x + 32 ) / 64 ) : -(( -delta.x + 32 ) / 64 ));
+				}
+			}
+		}
+
+		p_font -> has_kern = true;
+	}
+	else
+	{
+		// No kerning...
+	}
+
+	FT_Done_Face( face );
+	FT_Done_FreeType( lib );
+
+	if ( false == is_ok )
+	{
+		fprintf( stderr, "Cannot render %s\n", p_file );
+	}
+
+	return is_ok;
+#else
+	(void) size;
+	(void) bpp;
+	(void) is_kern;
+	(void) p_sel;
+	(void) p_font;
+
+	fprintf( stderr, "%s: only BDF is supported, build with FONTCONV_FREETYPE for TTF/OTF\n", p_file );
+
+	return false;
+#endif
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Parse character ranges
+*
+*	Comma separated codes or ranges, e.g. "32-126,176".
+*
+*	param: 		p_str - Ranges
+*	param: 		p_sel - Selected characters
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool fontconv_parse_ranges(const char * p_str, bool * const p_sel)
+{
+	char * p_end;
+	unsigned long s;
+	unsigned long e;
+
+	while ( '\0' != *p_str )
+	{
+		s = strtoul( p_str, &p_end, 0 );
+		e = s;
+
+		if ( p_end == p_str )
+		{
+			return false;
+		}
+
+		p_str = p_end;
+
+		if ( '-' == *p_str )
+		{
+			p_str++;
+			e = strtoul( p_str, &p_end, 0 );
+
+			if ( p_end == p_str )
+			{
+				return false;
+			}
+
+			p_str = p_end;
+		}
+
+		if (( s > e ) || ( e >= FONTCONV_CHAR_NUM ))
+		{
+			return false;
+		}
+
+		for ( ; s <= e; s++ )
+		{
+			p_sel[s] = true;
+		}
+
+		if ( ',' == *p_str )
+		{
+			p_str++;
+		}
+		else if ( '\0' != *p_str )
+		{
+			return false;
+		}
+		else
+		{
+			// End of ranges...
+		}
+	}
+
+	return true;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Rasterize glyph into character cell
+*
+*	Coverage of cell pixel is average of scale x scale
+*	source pixels. Pixels outside of cell are dropped.
+*
+*	param: 		p_src - Pointer to source glyph
+*	param: 		scale - Source pixels per font pixel
+*	param: 		bpp - Bits per pixel
+*	param: 		width - Cell width
+*	param: 		height - Cell height
+*	param: 		p_level - Levels of cell pixels, in GRAM order
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void fontconv_rasterize(const fontconv_src_t * const p_src, const uint32_t scale, const uint32_t bpp, const uint32_t width, const uint32_t height, uint8_t * const p_level)
+{
+	const uint32_t max = (( 1U << bpp ) - 1U );
+	uint32_t sum;
+	uint32_t cov;
+	int32_t x;
+	int32_t y;
+	int32_t sx;
+	int32_t sy;
+	uint32_t i;
+	uint32_t j;
+	bool is_clipped = false;
+
+	for ( j = 0; j < width; j++ )
+	{
+		for ( i = 0; i < height; i++ )
+		{
+			sum = 0;
+
+			for ( x = 0; x < (int32_t) scale; x++ )
+			{
+				for ( y = 0; y < (int32_t) scale; y++ )
+				{
+					sx = (( (int32_t) j * (int32_t) scale ) + x - p_src -> left );
+					sy = (( (int32_t) i * (int32_t) scale ) + y - p_src -> top );
+
+					if (( sx >= 0 ) && ( sx < p_src -> width ) && ( sy >= 0 ) && ( sy < p_src -> height ))
+					{
+						sum += p_src -> p_pix[ ( sy * p_src -> width ) + sx ];
+					}
+				}
+			}
+
+			cov = ( sum / ( scale * scale ));
+			p_level[ ( j * height ) + i ] = (uint8_t)((( cov * max ) + 127U ) / 255U );
+		}
+	}
+
+	// Check for dropped pixels
+	for ( sy = 0; sy < p_src -> height; sy++ )
+	{
+		for ( sx = 0; sx < p_src -> width; sx++ )
+		{
+			x = ( p_src -> left + sx );
+			y = ( p_src -> top + sy );
+
+			if 	(	( 0U != p_src -> p_pix[ ( sy * p_src -> width ) + sx ] )
+				&&	(( x < 0 ) || ( x >= (int32_t)( width * scale )) || ( y < 0 ) || ( y >= (int32_t)( height * scale ))))
+			{
+				is_clipped = true;
+			}
+		}
+	}
+
+	if ( true == is_clipped )
+	{
+		fprintf( stderr, "Glyph exceeds character cell, clipped\n" );
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Encode glyph
+*
+*	Only bounding box of non background pixels is encoded.
+*	Run token is used where packed pixels would take at
+*	least a byte. Packed pixels are broken only for runs of
+*	at least two bytes, as next token and padding cost more.
+*
+*	param: 		p_level - Levels of cell pixels, in GRAM order
+*	param: 		width - Cell width
+*	param: 		height - Cell height
+*	param: 		bpp - Bits per pixel
+*	param: 		is_rle - Run-length encode
+*	param: 		p_glyph - Pointer to compiled glyph
+*	param: 		p_out - Pointer to output stream
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void fontconv_encode(const uint8_t * const p_level, const uint32_t width, const uint32_t height, const uint32_t bpp, const bool is_rle, fontconv_glyph_t * const p_glyph, fontconv_stream_t * const p_out)
+{
+	static uint8_t pix[ 255U * 255U ];
+	const uint32_t max = (( 1U << bpp ) - 1U );
+	uint32_t num = 0;
+	uint32_t pos;
+	uint32_t run;
+	uint32_t lit;
+	uint32_t j_s = 255U;
+	uint32_t j_e = 0;
+	uint32_t i_s = 255U;
+	uint32_t i_e = 0;
+	uint32_t i;
+	uint32_t j;
+
+	// Bounding box
+	for ( j = 0; j < width; j++ )
+	{
+		for ( i = 0; i < height; i++ )
+		{
+			if ( 0U != p_level[ ( j * height ) + i ] )
+			{
+				j_s = (( j < j_s ) ? ( j ) : ( j_s ));
+				j_e = j;
+				i_s = (( i < i_s ) ? ( i ) : ( i_s ));
+				i_e = (( i > i_e ) ? ( i ) : ( i_e ));
+			}
+		}
+	}
+
+	// Empty glyph has no data
+	p_glyph -> offset = p_out -> size;
+	p_glyph -> width = (( j_s <= j_e ) ? ( j_e - j_s + 1U ) : ( 0U ));
+	p_glyph -> height = (( j_s <= j_e ) ? ( i_e - i_s + 1U ) : ( 0U ));
+	p_glyph -> page_ofs = (( j_s <= j_e ) ? ( j_s ) : ( 0U ));
+	p_glyph -> col_ofs = (( j_s <= j_e ) ? ( i_s ) : ( 0U ));
+
+	for ( j = 0; j < p_glyph -> width; j++ )
+	{
+		for ( i = 0; i < p_glyph -> height; i++ )
+		{
+			pix[ num++ ] = p_level[ (( p_glyph -> page_ofs + j ) * height ) + p_glyph -> col_ofs + i ];
+		}
+	}
+
+	pos = 0;
+
+	while ( pos < num )
+	{
+		// Count run
+		for ( run = 1U; (( pos + run ) < num ) && ( pix[ pos + run ] == pix[ pos ] ) && ( run < FONTCONV_TOKEN_MAX ); run++ )
+		{
+			// Count...
+		}
+
+		if ( false == is_rle )
+		{
+			fontconv_put_bits( p_out, pix[ pos++ ], bpp );
+		}
+		else if ((( 0U == pix[ pos ] ) || ( max == pix[ pos ] )) && (( run * bpp ) >= 8U ))
+		{
+			p_out -> p_data[ p_out -> size++ ] = ((( 0U == pix[ pos ] ) ? ( FONTCONV_TOKEN_BG ) : ( FONTCONV_TOKEN_FG )) | ( run - 1U ));
+			pos += run;
+		}
+		else
+		{
+			// Packed pixels up to next run worth a token
+			for ( lit = 1U; (( pos + lit ) < num ) && ( lit < FONTCONV_TOKEN_MAX ); lit++ )
+			{
+				for ( run = 1U; (( pos + lit + run ) < num ) && ( pix[ pos + lit + run ] == pix[ pos + lit ] ) && ( run < FONTCONV_TOKEN_MAX ); run++ )
+				{
+					// Count...
+				}
+
+				if ((( 0U == pix[ pos + lit ] ) || ( max == pix[ pos + lit ] )) && (( run * bpp ) >= 16U ))
+				{
+					break;
+				}
+			}
+
+			p_out -> p_data[ p_out -> size++ ] = ( FONTCONV_TOKEN_PIX | ( lit - 1U ));
+
+			for ( i = 0; i < lit; i++ )
+			{
+				fontconv_put_bits( p_out, pix[ pos++ ], bpp );
+			}
+
+			fontconv_align( p_out );
+		}
+	}
+
+	// Glyph starts on byte boundary
+	fontconv_align( p_out );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Put packed pixel, MSB first
+*
+*	param: 		p_out - Pointer to output stream
+*	param: 		value - Pixel level
+*	param: 		bpp - Bits per pixel
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void fontconv_put_bits(fontconv_stream_t * const p_out, const uint32_t value, const uint32_t bpp)
+{
+	if ( 0U == p_out -> shift )
+	{
+		p_out -> p_data[ p_out -> size++ ] = 0U;
+	}
+
+	p_out -> shift += bpp;
+	p_out -> p_data[ p_out -> size - 1U ] |= (uint8_t)( value << ( 8U - p_out -> shift ));
+
+	if ( 8U == p_out -> shift )
+	{
+		p_out -> shift = 0;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Continue stream on byte boundary
+*
+*	param: 		p_out - Pointer to output stream
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void fontconv_align(fontconv_stream_t * const p_out)
+{
+	p_out -> shift = 0;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Decode glyph
+*
+*	Follows reader of driver, but checks stream bounds as
+*	well.
+*
+*	param: 		p_data - Stream
+*	param: 		size - Size of stream
+*	param: 		bpp - Bits per pixel
+*	param: 		is_rle - Run-length encoded
+*	param: 		p_glyph - Pointer to compiled glyph
+*	param: 		width - Cell width
+*	param: 		height - Cell height
+*	param: 		p_level - Decoded levels of cell pixels
+*	return:		true if glyph is valid
+*/
+//////////////////////////////////////////////////////////////
+static bool fontconv_decode(const uint8_t * const p_data, const uint32_t size, const uint32_t bpp, const bool is_rle, const fontconv_glyph_t * const p_glyph, const uint32_t width, const uint32_t height, uint8_t * const p_level)
+{
+	const uint32_t max = (( 1U << bpp ) - 1U );
+	uint32_t pos = p_glyph -> offset;
+	uint32_t shift = 0;
+	uint32_t left = 0;
+	uint32_t token = FONTCONV_TOKEN_PIX;
+	uint32_t level = 0;
+	uint32_t i;
+	uint32_t j;
+	bool is_ok;
+
+	memset( p_level, 0, width * height );
+
+	is_ok 	= 	((( p_glyph -> page_ofs + p_glyph -> width ) <= width )
+			&&	(( p_glyph -> col_ofs + p_glyph -> height ) <= height ));
+
+	for ( j = 0; ( j < p_glyph -> width ) && ( true == is_ok ); j++ )
+	{
+		for ( i = 0; ( i < p_glyph -> height ) && ( true == is_ok ); i++ )
+		{
+			if (( true == is_rle ) && ( 0U == left ))
+			{
+				is_ok = (( pos < size ) && ( 0xC0U != ( p_data[ pos ] & 0xC0U )));
+
+				if ( true == is_ok )
+				{
+					token = ( p_data[ pos ] & 0xC0U );
+					left = (( p_data[ pos ] & 0x3FU ) + 1U );
+					pos++;
+				}
+			}
+
+			if ( FONTCONV_TOKEN_BG == token )
+			{
+				level = 0;
+			}
+			else if ( FONTCONV_TOKEN_FG == token )
+			{
+				level = max;
+			}
+			else if ( pos < size )
+			{
+				shift += bpp;
+				level = (( p_data[ pos ] >> ( 8U - shift )) & max );
+
+				if ( 8U == shift )
+				{
+					pos++;
+					shift = 0;
+				}
+			}
+			else
+			{
+				is_ok = false;
+			}
+
+			if ( true == is_rle )
+			{
+				left--;
+
+				if (( 0U == left ) && ( 0U != shift ))
+				{
+					pos++;
+					shift = 0;
+				}
+			}
+
+			p_level[ (( p_glyph -> page_ofs + j ) * height ) + p_glyph -> col_ofs + i ] = (uint8_t) level;
+		}
+	}
+
+	return (( true == is_ok ) && ( 0U == left ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write C source with font
+*
+*	param: 		p_file - Path to output
+*	param: 		p_name - Name of font
+*	param: 		p_src - Path to source font
+*	param: 		width - Cell width
+*	param: 		height - Cell height
+*	param: 		bpp - Bits per pixel
+*	param: 		is_rle - Run-length encoded
+*	param: 		first - First character
+*	param: 		num - Number of glyphs
+*	param: 		p_glyph - Compiled glyphs
+*	param: 		p_out - Pointer to stream
+*	param: 		p_kern - Kerning pairs
+*	param: 		kern_num - Number of kerning pairs
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool fontconv_write_c(const char * const p_file, const char * const p_name, const char * const p_src, const uint32_t width, const uint32_t height, const uint32_t bpp, const bool is_rle, const uint32_t first, const uint32_t num, const fontconv_glyph_t * const p_glyph, const fontconv_stream_t * const p_out, const fontconv_kern_t * const p_kern, const uint32_t kern_num)
+{
+	FILE * p_f;
+	uint32_t i;
+	uint32_t c;
+
+	p_f = fopen( p_file, "w" );
+
+	if ( NULL == p_f )
+	{
+		fprintf( stderr, "Cannot create %s\n", p_file );
+		return false;
+	}
+
+	fprintf( p_f, "// Generated by ili9488_fontconv from %s, %u bpp %s\n", p_src, bpp, (( true == is_rle ) ? ( "RLE" ) : ( "raw" )));
+	fprintf( p_f, "#include \"ili9488_font.h\"\n\n" );
+	fprintf( p_f, "static const uint8_t %s_data[ %u ] =\n{", p_name, (( p_out -> size > 0U ) ? ( p_out -> size ) : ( 1U )));
+
+	for ( i = 0; i < p_out -> size; i++ )
+	{
+		fprintf( p_f, "%s0x%02X,", (( 0U == ( i % 16U )) ? ( "\n\t" ) : ( " " )), p_out -> p_data[i] );
+	}
+
+	fprintf( p_f, "\n};\n\n" );
+	fprintf( p_f, "static const ili9488_glyph_t %s_glyph[ %u ] =\n{\n", p_name, num );
+
+	for ( i = 0; i < num; i++ )
+	{
+		c = ( first + i );
+
+		fprintf( p_f, "\t{ %5u, %3u, %3u, %3u, %3u, %3u },", p_glyph[i].offset, p_glyph[i].width, p_glyph[i].height, p_glyph[i].page_ofs, p_glyph[i].col_ofs, p_glyph[i].advance );
+
+		if (( c > 32U ) && ( c < 127U ) && ( '\\' != c ))
+		{
+			fprintf( p_f, "\t// '%c'\n", (char) c );
+		}
+		else
+		{
+			fprintf( p_f, "\t// %u\n", c );
+		}
+	}
+
+	fprintf( p_f, "};\n\n" );
+
+	if ( kern_num > 0U )
+	{
+		fprintf( p_f, "static const ili9488_kern_t %s_kern[ %u ] =\n{\n", p_name, kern_num );
+
+		for ( i = 0; i < kern_num; i++ )
+		{
+			fprintf( p_f, "\t{ %3u, %3u, %4d },", p_kern[i].left, p_kern[i].right, p_kern[i].offset );
+
+			if 	(	( p_kern[i].left > 32U ) && ( p_kern[i].left < 127U ) && ( '\\' != p_kern[i].left )
+				&&	( p_kern[i].right > 32U ) && ( p_kern[i].right < 127U ) && ( '\\' != p_kern[i].right ))
+			{
+				fprintf( p_f, "\t// '%c' '%c'\n", (char) p_kern[i].left, (char) p_kern[i].right );
+			}
+			else
+			{
+				fprintf( p_f, "\n" );
+			}
+		}
+
+		fprintf( p_f, "};\n\n" );
+	}
+
+	fprintf( p_f, "const ili9488_font_t %s =\n{\n", p_name );
+	fprintf( p_f, "\t.width = %u,\n", width );
+	fprintf( p_f, "\t.height = %u,\n", height );
+	fprintf( p_f, "\t.p_glyph = %s_glyph,\n", p_name );
+	fprintf( p_f, "\t.p_data = %s_data,\n", p_name );
+	fprintf( p_f, "\t.bpp = %u,\n", bpp );
+	fprintf( p_f, "\t.is_rle = %s,\n", (( true == is_rle ) ? ( "true" ) : ( "false" )));
+	fprintf( p_f, "\t.first = %u,\n", first );
+	fprintf( p_f, "\t.num = %u,\n", num );
+
+	if ( kern_num > 0U )
+	{
+		fprintf( p_f, "\t.p_kern = %s_kern,\n", p_name );
+		fprintf( p_f, "\t.kern_num = %u,\n", kern_num );
+	}
+
+	fprintf( p_f, "};\n" );
+
+	return ( 0 == fclose( p_f ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Print usage
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void fontconv_usage(void)
+{
+	fprintf( stderr,
+			"Usage: ili9488_fontconv [options] input.bdf|ttf|otf output.c\n"
+			"  -n name      Name of font, default font\n"
+			"  -b 1|2|4     Bits per pixel, default 1\n"
+			"  -p pixels    Pixel size of TTF/OTF font\n"
+			"  -s scale     Downsample source by scale, e.g. 4 for BDF four times bigger than font, default 1\n"
+			"  -r ranges    Characters, e.g. 32-126,176, default 32-126\n"
+			"  -t text      Characters of text, added to ranges\n"
+			"  -m           Monospaced, every character advances for cell width\n"
+			"  -k           Add kerning pairs of selected characters, TTF/OTF only\n"
+			"  -f auto|raw|rle\n"
+			"               Glyph data compression, default is smaller of both\n" );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////
@@ -0,0 +1,555 @@
+//////////////////////////////////////////////////////////////
+//
+//	project:		ILI9488 EVALUATION
+//	date:			17.10.2026
+//
+//	author:			Ziga Miklosic
+//
+//////////////////////////////////////////////////////////////
+//
+//	Host tool for compressing images into RLE or LZ bitmaps
+//	of ILI9488 driver. Reads binary PPM (P6) and writes C
+//	source with bitmap, e.g.:
+//
+//		gcc -O2 -o ili9488_imgconv ili9488_imgconv.c
+//		./ili9488_imgconv -f lz -n splash splash.ppm splash.c
+//
+//	Pixels are written in GRAM order, image x along pages
+//	and y along columns. Stream is decoded back and checked
+//	before output is written.
+//
+//////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////
+//	INCLUDES
+//////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////
+//	DEFINITIONS
+//////////////////////////////////////////////////////////////
+
+// Token codes, see ili9488_image.c
+#define IMGCONV_TOKEN_RUN			( 0x80U )
+#define IMGCONV_TOKEN_COPY			( 0xC0U )
+
+// Token limits
+#define IMGCONV_LITERAL_MAX			( 128U )
+#define IMGCONV_RLE_RUN_MAX			( 32768U )
+#define IMGCONV_LZ_RUN_MAX			( 16384U )
+#define IMGCONV_LZ_DIST_MAX			( 65536U )
+
+// Default LZ window, same as ILI9488_IMAGE_LZ_WINDOW
+#define IMGCONV_LZ_WINDOW			( 512U )
+
+// Image
+typedef struct
+{
+	uint8_t *	p_pix;		// Pixels in GRAM order, 3 bytes each
+	uint32_t	width;
+	uint32_t	height;
+} imgconv_image_t;
+
+// Output stream
+typedef struct
+{
+	uint8_t *	p_data;
+	uint32_t	size;
+	uint32_t	lit_start;	// First pending literal pixel
+	uint32_t	lit_num;	// Number of pending literal pixels
+} imgconv_stream_t;
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS PROTOTYPES
+//////////////////////////////////////////////////////////////
+static bool		imgconv_read_ppm		(const char * const p_file, const bool quantize, imgconv_image_t * const p_img);
+static void		imgconv_encode			(const imgconv_image_t * const p_img, const bool is_lz, const uint32_t window, imgconv_stream_t * const p_out);
+static void		imgconv_flush_literal	(const imgconv_image_t * const p_img, imgconv_stream_t * const p_out);
+static bool		imgconv_decode			(const uint8_t * p_data, const uint32_t size, const bool is_lz, const uint32_t window, uint8_t * const p_pix, const uint32_t num);
+static bool		imgconv_write_c			(const char * const p_file, const char * const p_name, const bool is_lz, const imgconv_image_t * const p_img, const imgconv_stream_t * const p_out);
+static bool		imgconv_is_same			(const uint8_t * const p_pix, const uint32_t a, const uint32_t b);
+static void		imgconv_usage			(void);
+
+
+//////////////////////////////////////////////////////////////
+// FUNCTIONS
+//////////////////////////////////////////////////////////////
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Main
+*
+*	param: 		argc - Number of arguments
+*	param: 		argv - Arguments
+*	return:		0 on success
+*/
+//////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	imgconv_image_t img;
+	imgconv_stream_t out;
+	const char * p_name = "image";
+	uint32_t window = IMGCONV_LZ_WINDOW;
+	uint32_t num;
+	uint8_t * p_check;
+	bool is_lz = true;
+	bool quantize = true;
+	int i;
+
+	for ( i = 1; ( i < argc ) && ( '-' == argv[i][0] ); i++ )
+	{
+		if (( 0 == strcmp( argv[i], "-f" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			is_lz = ( 0 == strcmp( argv[i], "lz" ));
+
+			if (( false == is_lz ) && ( 0 != strcmp( argv[i], "rle" )))
+			{
+				imgconv_usage();
+				return 1;
+			}
+		}
+		else if (( 0 == strcmp( argv[i], "-w" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			window = (uint32_t) strtoul( argv[i], NULL, 0 );
+
+			if (( window < 1U ) || ( window > IMGCONV_LZ_DIST_MAX ))
+			{
+				imgconv_usage();
+				return 1;
+			}
+		}
+		else if (( 0 == strcmp( argv[i], "-n" )) && (( i + 1 ) < argc ))
+		{
+			i++;
+			p_name = argv[i];
+		}
+		else if ( 0 == strcmp( argv[i], "-k" ))
+		{
+			quantize = false;
+		}
+		else
+		{
+			imgconv_usage();
+			return 1;
+		}
+	}
+
+	if (( i + 2 ) != argc )
+	{
+		imgconv_usage();
+		return 1;
+	}
+
+	if ( false == imgconv_read_ppm( argv[i], quantize, &img ))
+	{
+		return 1;
+	}
+
+	imgconv_encode( &img, is_lz, window, &out );
+
+	// Check stream
+	num = ( img.width * img.height );
+	p_check = malloc( num * 3U );
+
+	if 	(	( NULL == p_check )
+		||	( false == imgconv_decode( out.p_data, out.size, is_lz, window, p_check, num ))
+		||	( 0 != memcmp( p_check, img.p_pix, num * 3U )))
+	{
+		fprintf( stderr, "Stream check failed\n" );
+		return 1;
+	}
+
+	if ( false == imgconv_write_c( argv[ i + 1 ], p_name, is_lz, &img, &out ))
+	{
+		return 1;
+	}
+
+	printf( "%s: %ux%u, %u B -> %u B (%.1f %%)\n", p_name, img.width, img.height, num * 3U, out.size, ( 100.0 * out.size ) / ( num * 3U ));
+
+	free( p_check );
+	free( out.p_data );
+	free( img.p_pix );
+
+	return 0;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Read binary PPM image
+*
+*	param: 		p_file - Path to image
+*	param: 		quantize - Drop 2 LSBs not shown in 18-bit format
+*	param: 		p_img - Pointer to image
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool imgconv_read_ppm(const char * const p_file, const bool quantize, imgconv_image_t * const p_img)
+{
+	FILE * p_f;
+	uint8_t * p_row;
+	unsigned int width;
+	unsigned int height;
+	unsigned int max;
+	uint32_t x;
+	uint32_t y;
+	uint32_t c;
+	bool is_ok = false;
+
+	p_f = fopen( p_file, "rb" );
+
+	if ( NULL == p_f )
+	{
+		fprintf( stderr, "Cannot open %s\n", p_file );
+	}
+	else if (( 3 != fscanf( p_f, "P6 %u %u %u", &width, &height, &max )) || ( 255U != max ) || ( 0U == width ) || ( 0U == height ) || ( width > 0xFFFFU ) || ( height > 0xFFFFU ))
+	{
+		fprintf( stderr, "%s is not 8-bit binary PPM\n", p_file );
+		fclose( p_f );
+	}
+	else
+	{
+		// Single white space before pixels
+		fgetc( p_f );
+
+		p_img -> width = width;
+		p_img -> height = height;
+		p_img -> p_pix = malloc((size_t) width * height * 3U );
+		p_row = malloc((size_t) width * 3U );
+
+		is_ok = (( NULL != p_img -> p_pix ) && ( NULL != p_row ));
+
+		// Rows of image are columns of GRAM
+		for ( y = 0; ( y < height ) && ( true == is_ok ); y++ )
+		{
+			is_ok = ( width == fread( p_row, 3U, width, p_f ));
+
+			for ( x = 0; ( x < width ) && ( true == is_ok ); x++ )
+			{
+				for ( c = 0; c < 3U; c++ )
+				{
+					p_img -> p_pix[ ((( x * height ) + y ) * 3U ) + c ] = (( true == quantize ) ? ( p_row[ ( x * 3U ) + c ] & 0xFCU ) : ( p_row[ ( x * 3U ) + c ] ));
+				}
+			}
+		}
+
+		if ( false == is_ok )
+		{
+			fprintf( stderr, "%s is truncated\n", p_file );
+		}
+
+		free( p_row );
+		fclose( p_f );
+	}
+
+	return is_ok;
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Encode image
+*
+*	Greedy encoder, at each pixel longest of run and copy
+*	is taken, pixels covered by neither are sent as literals.
+*
+*	param: 		p_img - Pointer to image
+*	param: 		is_lz - LZ or RLE stream
+*	param: 		window - LZ window in pixels
+*	param: 		p_out - Pointer to output stream
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void imgconv_encode(const imgconv_image_t * const p_img, const bool is_lz, const uint32_t window, imgconv_stream_t * const p_out)
+{
+	const uint32_t num = ( p_img -> width * p_img -> height );
+	const uint32_t run_max = (( true == is_lz ) ? ( IMGCONV_LZ_RUN_MAX ) : ( IMGCONV_RLE_RUN_MAX ));
+	uint32_t pos = 0;
+	uint32_t run;
+	uint32_t copy;
+	uint32_t copy_dist;
+	uint32_t len;
+	uint32_t dist;
+	uint32_t max;
+	uint8_t mask;
+
+	// Worst case is all literals
+	p_out -> p_data = malloc(( num * 3U ) + ( num / IMGCONV_LITERAL_MAX ) + 1U );
+	p_out -> size = 0;
+	p_out -> lit_num = 0;
+
+	if ( NULL == p_out -> p_data )
+	{
+		fprintf( stderr, "Out of memory\n" );
+		exit( 1 );
+	}
+
+	while ( pos < num )
+	{
+		max = ((( num - pos ) < run_max ) ? ( num - pos ) : ( run_max ));
+
+		for ( run = 1U; ( run < max ) && ( true == imgconv_is_same( p_img -> p_pix, pos, pos + run )); run++ )
+		{
+			// Count run...
+		}
+
+		copy = 0;
+		copy_dist = 0;
+
+		// Distance 1 is covered by run
+		for ( dist = 2U; ( true == is_lz ) && ( dist <= window ) && ( dist <= pos ); dist++ )
+		{
+			for ( len = 0; ( len < max ) && ( true == imgconv_is_same( p_img -> p_pix, pos - dist + len, pos + len )); len++ )
+			{
+				// Count match...
+			}
+
+			if ( len > copy )
+			{
+				copy = len;
+				copy_dist = dist;
+			}
+		}
+
+		if (( copy >= 2U ) && ( copy > run ))
+		{
+			imgconv_flush_literal( p_img, p_out );
+
+			p_out -> p_data[ p_out -> size++ ] = ( IMGCONV_TOKEN_COPY | (( copy - 1U ) >> 8U ));
+			p_out -> p_data[ p_out -> size++ ] = (( copy - 1U ) & 0xFFU );
+			p_out -> p_data[ p_out -> size++ ] = (( copy_dist - 1U ) >> 8U );
+			p_out -> p_data[ p_out -> size++ ] = (( copy_dist - 1U ) & 0xFFU );
+			pos += copy;
+		}
+		else if ( run >= 2U )
+		{
+			imgconv_flush_literal( p_img, p_out );
+
+			mask = (( true == is_lz ) ? ( 0x3FU ) : ( 0x7FU ));
+
+			p_out -> p_data[ p_out -> size++ ] = ( IMGCONV_TOKEN_RUN | ((( run - 1U ) >> 8U ) & mask ));
+			p_out -> p_data[ p_out -> size++ ] = (( run - 1U ) & 0xFFU );
+			memcpy( &p_out -> p_data[ p_out -> size ], &p_img -> p_pix[ pos * 3U ], 3U );
+			p_out -> size += 3U;
+			pos += run;
+		}
+		else
+		{
+			if ( 0U == p_out -> lit_num )
+			{
+				p_out -> lit_start = pos;
+			}
+
+			p_out -> lit_num++;
+			pos++;
+
+			if ( IMGCONV_LITERAL_MAX == p_out -> lit_num )
+			{
+				imgconv_flush_literal( p_img, p_out );
+			}
+		}
+	}
+
+	imgconv_flush_literal( p_img, p_out );
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write pending literal pixels
+*
+*	param: 		p_img - Pointer to image
+*	param: 		p_out - Pointer to output stream
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void imgconv_flush_literal(const imgconv_image_t * const p_img, imgconv_stream_t * const p_out)
+{
+	if ( p_out -> lit_num > 0U )
+	{
+		p_out -> p_data[ p_out -> size++ ] = ( p_out -> lit_num - 1U );
+		memcpy( &p_out -> p_data[ p_out -> size ], &p_img -> p_pix[ p_out -> lit_start * 3U ], p_out -> lit_num * 3U );
+		p_out -> size += ( p_out -> lit_num * 3U );
+		p_out -> lit_num = 0;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Decode stream
+*
+*	Follows decoder of driver, but checks stream bounds as
+*	well.
+*
+*	param: 		p_data - Stream
+*	param: 		size - Size of stream
+*	param: 		is_lz - LZ or RLE stream
+*	param: 		window - LZ window in pixels
+*	param: 		p_pix - Decoded pixels
+*	param: 		num - Number of pixels
+*	return:		true if stream is valid
+*/
+//////////////////////////////////////////////////////////////
+static bool imgconv_decode(const uint8_t * p_data, const uint32_t size, const bool is_lz, const uint32_t window, uint8_t * const p_pix, const uint32_t num)
+{
+	const uint8_t * const p_end = ( p_data + size );
+	uint32_t pos = 0;
+	uint32_t len;
+	uint32_t dist;
+	uint32_t i;
+	uint8_t token;
+	bool is_ok = true;
+
+	while (( pos < num ) && ( p_data < p_end ) && ( true == is_ok ))
+	{
+		token = *p_data++;
+
+		if ( token < IMGCONV_TOKEN_RUN )
+		{
+			len = ( token + 1U );
+			is_ok = ((( pos + len ) <= num ) && (( p_data + ( len * 3U )) <= p_end ));
+
+			for ( i = 0; ( i < len ) && ( true == is_ok ); i++ )
+			{
+				memcpy( &p_pix[ ( pos++ ) * 3U ], p_data, 3U );
+				p_data += 3U;
+			}
+		}
+		else if (( true == is_lz ) && ( token >= IMGCONV_TOKEN_COPY ))
+		{
+			is_ok = (( p_data + 3U ) <= p_end );
+
+			if ( true == is_ok )
+			{
+				len = ((( token & 0x3FU ) << 8U ) | p_data[0] ) + 1U;
+				dist = ((( p_data[1] << 8U ) | p_data[2] ) + 1U );
+				p_data += 3U;
+
+				is_ok = ((( pos + len ) <= num ) && ( dist <= pos ) && ( dist <= window ));
+
+				for ( i = 0; ( i < len ) && ( true == is_ok ); i++ )
+				{
+					memcpy( &p_pix[ pos * 3U ], &p_pix[ ( pos - dist ) * 3U ], 3U );
+					pos++;
+				}
+			}
+		}
+		else
+		{
+			is_ok = (( p_data + 4U ) <= p_end );
+
+			if ( true == is_ok )
+			{
+				len = ((( token & (( true == is_lz ) ? ( 0x3FU ) : ( 0x7FU ))) << 8U ) | p_data[0] ) + 1U;
+				is_ok = (( pos + len ) <= num );
+
+				for ( i = 0; ( i < len ) && ( true == is_ok ); i++ )
+				{
+					memcpy( &p_pix[ ( pos++ ) * 3U ], &p_data[1], 3U );
+				}
+
+				p_data += 4U;
+			}
+		}
+	}
+
+	return (( true == is_ok ) && ( pos == num ) && ( p_data == p_end ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Write C source with bitmap
+*
+*	param: 		p_file - Path to output
+*	param: 		p_name - Name of bitmap
+*	param: 		is_lz - LZ or RLE stream
+*	param: 		p_img - Pointer to image
+*	param: 		p_out - Pointer to stream
+*	return:		true on success
+*/
+//////////////////////////////////////////////////////////////
+static bool imgconv_write_c(const char * const p_file, const char * const p_name, const bool is_lz, const imgconv_image_t * const p_img, const imgconv_stream_t * const p_out)
+{
+	FILE * p_f;
+	uint32_t i;
+
+	p_f = fopen( p_file, "w" );
+
+	if ( NULL == p_f )
+	{
+		fprintf( stderr, "Cannot create %s\n", p_file );
+		return false;
+	}
+
+	fprintf( p_f, "// Generated by ili9488_imgconv, %s compressed\n", (( true == is_lz ) ? ( "LZ" ) : ( "RLE" )));
+	fprintf( p_f, "#include \"ili9488.h\"\n\n" );
+	fprintf( p_f, "static const uint8_t %s_data[ %u ] =\n{", p_name, p_out -> size );
+
+	for ( i = 0; i < p_out -> size; i++ )
+	{
+		fprintf( p_f, "%s0x%02X,", (( 0U == ( i % 16U )) ? ( "\n\t" ) : ( " " )), p_out -> p_data[i] );
+	}
+
+	fprintf( p_f, "\n};\n\n" );
+	fprintf( p_f, "const ili9488_bitmap_t %s =\n{\n", p_name );
+	fprintf( p_f, "\t.p_data = %s_data,\n", p_name );
+	fprintf( p_f, "\t.width = %u,\n", p_img -> width );
+	fprintf( p_f, "\t.height = %u,\n", p_img -> height );
+	fprintf( p_f, "\t.format = %s,\n", (( true == is_lz ) ? ( "eILI9488_BITMAP_LZ" ) : ( "eILI9488_BITMAP_RLE" )));
+	fprintf( p_f, "\t.size = sizeof( %s_data ),\n", p_name );
+	fprintf( p_f, "};\n" );
+
+	return ( 0 == fclose( p_f ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Compare two pixels
+*
+*	param: 		p_pix - Pixels
+*	param: 		a - First pixel
+*	param: 		b - Second pixel
+*	return:		true if same color
+*/
+//////////////////////////////////////////////////////////////
+static bool imgconv_is_same(const uint8_t * const p_pix, const uint32_t a, const uint32_t b)
+{
+	return ( 0 == memcmp( &p_pix[ a * 3U ], &p_pix[ b * 3U ], 3U ));
+}
+
+
+//////////////////////////////////////////////////////////////
+/*
+*			Print usage
+*
+*	param: 		none
+*	return:		none
+*/
+//////////////////////////////////////////////////////////////
+static void imgconv_usage(void)
+{
+	fprintf( stderr,
+			"Usage: ili9488_imgconv [options] input.ppm output.c\n"
+			"  -f rle|lz    Compression, default lz\n"
+			"  -w pixels    LZ window, at most ILI9488_IMAGE_LZ_WINDOW, default %u\n"
+			"  -n name      Name of bitmap, default image\n"
+			"  -k           Keep 2 LSBs of colors, dropped by default as 18-bit format does\n",
+			IMGCONV_LZ_WINDOW );
+}
+
+
+//////////////////////////////////////////////////////////////
+// END OF FILE
+//////////////////////////////////////////////////////////////